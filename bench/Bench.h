@@ -0,0 +1,213 @@
+/**
+ * @file Bench.h
+ * @date October 2026
+ * @author Omophagic Content Reader contributors
+ * @brief Timing and accuracy helpers shared by the benchmark programs.
+ * @version $Id$
+ */
+/*
+ * Copyright 2026 Omophagic Content Reader contributors
+ *
+ * This file is part of Omophagic Content Reader.
+ *
+ * Omophagic Content Reader is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Omophagic Content Reader is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Omophagic Content Reader.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef OCR_BENCH_H_
+#define OCR_BENCH_H_
+#include <string>
+#include <vector>
+#include <fstream>
+#include <sstream>
+#include <chrono>
+#include <cctype>
+#include <cmath>
+#include <algorithm>
+#include <cstdlib>
+#include <unistd.h>
+
+namespace Bench
+{
+
+/**
+ * Get the current time
+ * @return seconds since an arbitrary point
+ */
+inline double now()
+{
+	return std::chrono::duration<double>(
+	        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+/**
+ * The time taken by repeated measurements of some code
+ */
+struct Summary
+{
+	/// Number of measurements
+	unsigned samples;
+	/// Number of calls in each measurement
+	unsigned long long calls;
+	/// Nanoseconds per item: mean, standard deviation, smallest,
+	/// median and largest of the measurements
+	double mean, deviation, min, median, max;
+};
+
+/**
+ * Times some code. It is first called for a while without timing, which
+ * also finds how many calls take about the target time; then that many
+ * calls are timed, repeatedly.
+ * @param body        code to time, called with no arguments
+ * @param items       number of items each call processes, to report
+ *                    the time per item
+ * @param repetitions number of measurements
+ * @param target      seconds each measurement should take, at least
+ * @return the time per item
+ */
+template<typename Body>
+Summary measure(Body body, unsigned long long items = 1,
+        unsigned repetitions = 15, double target = 0.01)
+{
+	// Warm up for at least a few calls and the target time
+	unsigned long long warm = 0;
+	const double start = now();
+	double elapsed;
+	do
+	{
+		body();
+		++warm;
+		elapsed = now() - start;
+	} while (warm < 3 || elapsed < target);
+
+	Summary summary;
+	summary.samples = repetitions;
+	summary.calls = std::max(1.0, std::ceil(target * warm / elapsed));
+	std::vector<double> times;
+	for (unsigned r = 0; r < repetitions; ++r)
+	{
+		const double begin = now();
+		for (unsigned long long c = 0; c < summary.calls; ++c)
+			body();
+		times.push_back((now() - begin) * 1e9 / (summary.calls
+		        * std::max(items, 1ULL)));
+	}
+
+	std::sort(times.begin(), times.end());
+	double sum = 0, squares = 0;
+	for (unsigned r = 0; r < times.size(); ++r)
+		sum += times[r];
+	summary.mean = sum / times.size();
+	for (unsigned r = 0; r < times.size(); ++r)
+		squares += (times[r] - summary.mean) * (times[r] - summary.mean);
+	summary.deviation = times.size() > 1 ? std::sqrt(squares / (times.size()
+	        - 1)) : 0;
+	summary.min = times.front();
+	summary.median = times[times.size() / 2];
+	summary.max = times.back();
+	return summary;
+}
+
+/**
+ * Makes a new, empty directory for files written only while a benchmark
+ * runs, in the directory named by TMPDIR or else /tmp
+ * @return directory name, or an empty string if it cannot be made
+ */
+inline std::string temporaryDirectory()
+{
+	const char * parent = std::getenv("TMPDIR");
+	std::string name = std::string(parent && *parent ? parent : "/tmp")
+	        + "/ocr-bench-XXXXXX";
+	std::vector<char> buffer(name.begin(), name.end());
+	buffer.push_back('\0');
+	return mkdtemp(&buffer[0]) ? std::string(&buffer[0]) : "";
+}
+
+/**
+ * Reads the ground truth for an image: the file with the same name,
+ * but the suffix .txt instead of .bmp
+ * @param image file name of the image
+ * @return text of the image, or an empty string if there is none
+ */
+inline std::string groundTruth(const std::string & image)
+{
+	std::string name = image.substr(0, image.rfind('.')) + ".txt";
+	std::ifstream infile(name.c_str());
+	std::ostringstream text;
+	text << infile.rdbuf();
+	return text.str();
+}
+
+/**
+ * Removes all whitespace from text
+ * @param text some text
+ * @return text without spaces or line breaks
+ */
+inline std::string withoutSpace(const std::string & text)
+{
+	std::string result;
+	for (unsigned i = 0; i < text.size(); ++i)
+		if (!isspace((unsigned char) text[i]))
+			result += text[i];
+	return result;
+}
+
+/**
+ * Counts the insertions, deletions and substitutions
+ * needed to change one string into another
+ * @param a a string
+ * @param b another string
+ * @return Levenshtein distance
+ */
+inline unsigned editDistance(const std::string & a, const std::string & b)
+{
+	std::vector<unsigned> previous(b.size() + 1), current(b.size() + 1);
+	for (unsigned j = 0; j <= b.size(); ++j)
+		previous[j] = j;
+	for (unsigned i = 1; i <= a.size(); ++i)
+	{
+		current[0] = i;
+		for (unsigned j = 1; j <= b.size(); ++j)
+		{
+			unsigned cost = previous[j - 1] + (a[i - 1] != b[j - 1]);
+			if (previous[j] + 1 < cost)
+				cost = previous[j] + 1;
+			if (current[j - 1] + 1 < cost)
+				cost = current[j - 1] + 1;
+			current[j] = cost;
+		}
+		previous.swap(current);
+	}
+	return previous[b.size()];
+}
+
+/**
+ * Measures how much of the ground truth was recognized,
+ * ignoring whitespace
+ * @param recognized text that was read
+ * @param truth      correct text
+ * @return 1 - (edit distance / characters in truth)
+ */
+inline double accuracy(const std::string & recognized, const std::string & truth)
+{
+	std::string expected = withoutSpace(truth);
+	if (expected.empty())
+		return 0;
+	return 1 - editDistance(withoutSpace(recognized), expected)
+	        / (double) expected.size();
+}
+
+} // namespace Bench
+
+#endif /*OCR_BENCH_H_*/
@@ -0,0 +1,171 @@
+/**
+ * @file engines.cpp
+ * @date October 2026
+ * @author Omophagic Content Reader contributors
+ * @brief Compares the speed and accuracy of the matching engines.
+ * @version $Id$
+ */
+/*
+ * Copyright 2026 Omophagic Content Reader contributors
+ *
+ * This file is part of Omophagic Content Reader.
+ *
+ * Omophagic Content Reader is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Omophagic Content Reader is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Omophagic Content Reader.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <vector>
+#include "EasyBMP/EasyBMP.h"
+#include "Font.h"
+#include "GlyphCache.h"
+#include "Page.h"
+#include "Bench.h"
+
+/// Number of times each page is read
+const unsigned PAGE_REPEAT = 20;
+/// Number of times each character is matched
+const unsigned MATCH_REPEAT = 200;
+
+int main(int argc, char * argv[])
+{
+	if (argc < 3)
+	{
+		std::cerr << "Usage: " << argv[0] << " <font name> <bitmap name>...\n"
+		        << "Each bitmap may have its text in a .txt file of the same "
+		        << "name.\n";
+		return 1;
+	}
+
+	OCR::Font font(argv[1]);
+	const OCR::Font::Engine engines[] =
+	{ OCR::Font::STATISTICS, OCR::Font::TEMPLATE, OCR::Font::ZONING,
+	        OCR::Font::QUANTIZED, OCR::Font::CASCADE, OCR::Font::NORMALIZED };
+	const char * names[] =
+	{ "statistics", "template", "zoning", "quantized", "cascade",
+	        "normalized" };
+	const char * stageNames[] =
+	{ "density", "holes", "template" };
+	const unsigned ENGINES = sizeof(engines) / sizeof(engines[0]);
+
+	std::cout << std::left << std::setw(12) << "engine" << std::right
+	        << std::setw(12) << "ms/page" << std::setw(14) << "match ns/char"
+	        << std::setw(12) << "accuracy" << std::setw(12) << "evals/char"
+	        << '\n';
+	for (unsigned e = 0; e < ENGINES; ++e)
+	{
+		if (!font.supports(engines[e]))
+		{
+			std::cout << std::left << std::setw(12) << names[e]
+			        << "font has no data for this engine\n";
+			continue;
+		}
+		font.setEngine(engines[e]);
+
+		double pageTime = 0, matchTime = 0, accuracy = 0;
+		unsigned pages = 0, characters = 0, truths = 0;
+		for (int fileNum = 2; fileNum < argc; ++fileNum)
+		{
+			BMP img;
+			img.ReadFromFile(argv[fileNum]);
+			OCR::Page page(img, font);
+
+			// Whole pages, without help from the cache
+			std::string text;
+			if (fileNum == 2)
+				font.clearStats();
+			double start = Bench::now();
+			for (unsigned r = 0; r < PAGE_REPEAT; ++r)
+			{
+				font.cache().clear();
+				text = page.Read();
+			}
+			pageTime += Bench::now() - start;
+			pages += PAGE_REPEAT;
+
+			std::string truth = Bench::groundTruth(argv[fileNum]);
+			if (!truth.empty())
+			{
+				accuracy += Bench::accuracy(text, truth);
+				++truths;
+			}
+
+			// Matching alone, except by the cascade, which extracts
+			// features as it matches
+			if (engines[e] == OCR::Font::CASCADE)
+				continue;
+			OCR::FeatureBatch features(OCR::FeatureBatch::RASTER
+			        | OCR::FeatureBatch::ZONES | OCR::FeatureBatch::QUANTIZED,
+			        font.zoneGrid());
+			page.Read(NULL, &features);
+			std::vector<OCR::Font::Symbol> symbols;
+			for (unsigned i = 0; i < features.size(); ++i)
+				symbols.push_back(features.symbol(i));
+			volatile char sink = 0;
+			font.clearStats();
+			start = Bench::now();
+			for (unsigned r = 0; r < MATCH_REPEAT; ++r)
+				for (unsigned i = 0; i < features.size(); ++i)
+					switch (engines[e])
+					{
+					case OCR::Font::TEMPLATE:
+						sink ^= font.bestMatch(features.templates[i]);
+						break;
+					case OCR::Font::ZONING:
+						sink ^= font.bestMatch(features.zones[i]);
+						break;
+					case OCR::Font::QUANTIZED:
+						sink ^= font.bestMatch(features.quantized[i]);
+						break;
+					case OCR::Font::NORMALIZED:
+						sink ^= font.matchNormalized(symbols[i], 1).best();
+						break;
+					default:
+						sink ^= font.bestMatch(symbols[i]);
+					}
+			matchTime += Bench::now() - start;
+			characters += MATCH_REPEAT * features.size();
+		}
+
+		std::cout << std::left << std::setw(12) << names[e] << std::right
+		        << std::fixed << std::setprecision(3) << std::setw(12)
+		        << pageTime * 1000 / pages << std::setprecision(1)
+		        << std::setw(14);
+		if (characters)
+			std::cout << matchTime * 1e9 / characters;
+		else
+			std::cout << "-";
+		if (truths)
+			std::cout << std::setprecision(2) << std::setw(11) << accuracy
+			        * 100 / truths << '%';
+		else
+			std::cout << std::setw(12) << "";
+		const OCR::Font::Stats stats = font.stats();
+		std::cout << std::setprecision(1) << std::setw(12)
+		        << stats.evaluationsPerSearch() << '\n';
+
+		// How far the cascade went before deciding
+		if (engines[e] == OCR::Font::CASCADE && stats.searches)
+		{
+			std::cout << std::left << std::setw(12) << "  reached";
+			for (unsigned s = 0; s < OCR::Font::STAGES; ++s)
+				std::cout << (s ? ", " : "") << stageNames[s] << ' '
+				        << stats.reached[s] * 100.0 / stats.searches << '%';
+			std::cout << '\n' << std::right;
+		}
+	}
+	return 0;
+}
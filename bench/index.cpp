@@ -0,0 +1,225 @@
+/**
+ * @file index.cpp
+ * @date October 2026
+ * @author Omophagic Content Reader contributors
+ * @brief Compares the symbol index to comparing every symbol,
+ *        for fonts with many symbols per character.
+ * @version $Id$
+ */
+/*
+ * Copyright 2026 Omophagic Content Reader contributors
+ *
+ * This file is part of Omophagic Content Reader.
+ *
+ * Omophagic Content Reader is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Omophagic Content Reader is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Omophagic Content Reader.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include <cstdio>
+#include <iostream>
+#include <iomanip>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <random>
+#include "EasyBMP/EasyBMP.h"
+#include "Font.h"
+#include "FontRegistry.h"
+#include "Page.h"
+#include "Bench.h"
+
+/// Number of times each character is matched
+const unsigned MATCH_REPEAT = 20;
+
+/// A symbol and its character
+typedef std::pair<char, OCR::Font::Symbol> Prototype;
+
+/**
+ * Reads the symbols of a font file
+ * @param name file name
+ * @return each symbol and its character, in file order
+ */
+static std::vector<Prototype> readPrototypes(const std::string & name)
+{
+	std::ifstream infile(name.c_str());
+	std::vector<Prototype> prototypes;
+	std::string line;
+	Prototype p;
+	while (std::getline(infile, line))
+	{
+		std::istringstream fields(line);
+		if (fields >> p.first >> p.second)
+			prototypes.push_back(p);
+	}
+	return prototypes;
+}
+
+/**
+ * Changes a density slightly, keeping it between 0 and 1
+ * @param value  density
+ * @param random random number generator
+ * @return changed density
+ */
+static double jitter(double value, std::mt19937 & random)
+{
+	value += std::uniform_real_distribution<double>(-0.05, 0.05)(random);
+	return value < 0 ? 0 : value > 1 ? 1 : value;
+}
+
+/**
+ * Writes a font with the symbols of another and jittered copies of them
+ * @param name     file name
+ * @param original symbols of the other font
+ * @param count    total number of symbols
+ */
+static void writeFont(const std::string & name,
+        const std::vector<Prototype> & original, unsigned count)
+{
+	std::mt19937 random(count);
+	std::ofstream outfile(name.c_str());
+	for (unsigned i = 0; i < count; ++i)
+	{
+		Prototype p = original[i % original.size()];
+		if (i >= original.size())
+		{
+			OCR::Font::Symbol & s = p.second;
+			s.proportion *= std::uniform_real_distribution<double>(0.9, 1.1)(
+			        random);
+			s.density.total = jitter(s.density.total, random);
+			s.density.border = jitter(s.density.border, random);
+			s.density.q1 = jitter(s.density.q1, random);
+			s.density.q2 = jitter(s.density.q2, random);
+			s.density.q3 = jitter(s.density.q3, random);
+			s.density.q4 = jitter(s.density.q4, random);
+		}
+		outfile << p.first << ' ' << p.second << '\n';
+	}
+}
+
+/**
+ * Finds the best match by comparing every symbol, breaking ties
+ * toward the earlier character like Font does
+ * @param prototypes each symbol and its character
+ * @param u          statistics on an unknown symbol
+ * @return best matching character
+ */
+static char linearMatch(const std::vector<Prototype> & prototypes,
+        const OCR::Font::Symbol & u)
+{
+	char best = '\0';
+	unsigned bestScore = 0;
+	for (unsigned i = 0; i < prototypes.size(); ++i)
+	{
+		unsigned score = prototypes[i].second.match(u);
+		if (!i || score < bestScore || (score == bestScore
+		        && prototypes[i].first < best))
+		{
+			best = prototypes[i].first;
+			bestScore = score;
+		}
+	}
+	return best;
+}
+
+int main(int argc, char * argv[])
+{
+	if (argc < 3)
+	{
+		std::cerr << "Usage: " << argv[0] << " <font name> <bitmap name>...\n"
+		        << "Characters from the bitmaps are matched against fonts "
+		        << "made from\njittered copies of the font's symbols.\n";
+		return 1;
+	}
+
+	const std::string text = OCR::FontRegistry::textFile(argv[1]);
+	const std::vector<Prototype> original = readPrototypes(text);
+	if (original.empty())
+	{
+		std::cerr << argv[0] << ": font " << argv[1] << " has no symbols\n";
+		return 1;
+	}
+	const std::string directory = Bench::temporaryDirectory();
+	if (directory.empty())
+	{
+		std::cerr << argv[0] << ": cannot make a temporary directory\n";
+		return 1;
+	}
+
+	// Unknown symbols to match
+	OCR::Font font(argv[1]);
+	std::vector<OCR::Font::Symbol> symbols;
+	for (int fileNum = 2; fileNum < argc; ++fileNum)
+	{
+		BMP img;
+		img.ReadFromFile(argv[fileNum]);
+		OCR::Page page(img, font);
+		OCR::FeatureBatch features;
+		page.Read(NULL, &features);
+		for (unsigned i = 0; i < features.size(); ++i)
+			symbols.push_back(features.symbol(i));
+	}
+
+	std::cout << std::setw(10) << "symbols" << std::setw(14) << "linear ns"
+	        << std::setw(14) << "index ns" << std::setw(10) << "speedup"
+	        << std::setw(12) << "evals/char" << std::setw(10) << "differ"
+	        << '\n';
+	const unsigned counts[] =
+	{ (unsigned) original.size(), 1000, 10000 };
+	for (unsigned c = 0; c < sizeof(counts) / sizeof(counts[0]); ++c)
+	{
+		std::ostringstream file;
+		file << directory << "/bench-index-" << counts[c] << ".font";
+		writeFont(file.str(), original, counts[c]);
+		const std::vector<Prototype> prototypes = readPrototypes(file.str());
+		OCR::Font indexed = OCR::Font::fromText(file.str());
+		std::remove(file.str().c_str());
+		if (prototypes.empty())
+		{
+			std::cerr << argv[0] << ": cannot write " << file.str() << '\n';
+			rmdir(directory.c_str());
+			return 1;
+		}
+
+		volatile char sink = 0;
+		double start = Bench::now();
+		for (unsigned r = 0; r < MATCH_REPEAT; ++r)
+			for (unsigned i = 0; i < symbols.size(); ++i)
+				sink ^= linearMatch(prototypes, symbols[i]);
+		double linearTime = Bench::now() - start;
+
+		indexed.clearStats();
+		start = Bench::now();
+		for (unsigned r = 0; r < MATCH_REPEAT; ++r)
+			for (unsigned i = 0; i < symbols.size(); ++i)
+				sink ^= indexed.bestMatch(symbols[i]);
+		double indexTime = Bench::now() - start;
+
+		unsigned differ = 0;
+		for (unsigned i = 0; i < symbols.size(); ++i)
+			differ += linearMatch(prototypes, symbols[i])
+			        != indexed.bestMatch(symbols[i]);
+
+		const double matches = MATCH_REPEAT * (double) symbols.size();
+		std::cout << std::setw(10) << prototypes.size() << std::fixed
+		        << std::setprecision(1) << std::setw(14) << linearTime * 1e9
+		        / matches << std::setw(14) << indexTime * 1e9 / matches
+		        << std::setw(9) << linearTime / indexTime << 'x'
+		        << std::setw(12) << indexed.stats().evaluationsPerSearch()
+		        << std::setw(10) << differ << '\n';
+	}
+	rmdir(directory.c_str());
+	return 0;
+}
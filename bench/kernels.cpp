@@ -0,0 +1,287 @@
+/**
+ * @file kernels.cpp
+ * @date October 2026
+ * @author Omophagic Content Reader contributors
+ * @brief Measures the small routines that reading a page spends its time in,
+ *        each on its own, over the lines and characters of real pages.
+ * @version $Id$
+ */
+/*
+ * Copyright 2026 Omophagic Content Reader contributors
+ *
+ * This file is part of Omophagic Content Reader.
+ *
+ * Omophagic Content Reader is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Omophagic Content Reader is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Omophagic Content Reader.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include <iostream>
+#include <iomanip>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <unistd.h>
+#include "EasyBMP/EasyBMP.h"
+#include "OCR.h"
+#include "Font.h"
+#include "BinaryImage.h"
+#include "FeatureBatch.h"
+#include "Grapheme.h"
+#include "Line.h"
+#include "Page.h"
+#include "Bench.h"
+
+/**
+ * A line of text found on one of the pages
+ */
+struct TextLine
+{
+	/// Index of the page holding the line
+	unsigned page;
+	/// The part of the page holding the line
+	OCR::Box area;
+	/// The characters, before and after paring down
+	std::vector<OCR::Box> parts, pared;
+};
+
+/**
+ * Collects the symbols of a font, wherever it was loaded from
+ * @param font a font
+ * @return each symbol, in the order of its index
+ */
+static std::vector<OCR::Font::Symbol> fontSymbols(const OCR::Font & font)
+{
+	std::vector<OCR::Font::Symbol> symbols;
+	for (unsigned i = 0; i < font.symbolCount(); ++i)
+		if (font.character(i))
+			symbols.push_back(font.symbol(i));
+	return symbols;
+}
+
+/**
+ * Writes one row of the results
+ * @param name    what was measured
+ * @param items   number of items each call processes
+ * @param unit    what an item is
+ * @param summary the time per item
+ */
+static void report(const std::string & name, unsigned long long items,
+        const std::string & unit, const Bench::Summary & summary)
+{
+	std::cout << std::left << std::setw(24) << name << std::right
+	        << std::setw(9) << items << ' ' << std::left << std::setw(8)
+	        << unit << std::right << std::fixed << std::setprecision(1)
+	        << std::setw(12) << summary.mean << " ±" << std::setw(9)
+	        << summary.deviation << std::setw(12) << summary.min
+	        << std::setw(12) << summary.median << std::setw(12)
+	        << summary.max << '\n';
+}
+
+/// Keeps results computed only to be timed from being optimized away
+static volatile unsigned long long sink;
+
+int main(int argc, char * argv[])
+{
+	// Number of measurements of each routine
+	unsigned repetitions = 15;
+	int option;
+	while ((option = getopt(argc, argv, "r:")) != -1)
+	{
+		std::istringstream value(optarg ? optarg : "");
+		if (option != 'r' || !(value >> repetitions) || !repetitions)
+			argc = 0;
+	}
+	if (argc - optind < 2)
+	{
+		std::cerr << "Usage: " << argv[0] << " [-r <repetitions>]"
+		        << " <font name> <bitmap name>...\n"
+		        << "Each routine is timed over every line or character of "
+		        << "the bitmaps,\nin nanoseconds per item.\n";
+		return 1;
+	}
+
+	OCR::Font font(argv[optind]);
+	const std::vector<OCR::Font::Symbol> references = fontSymbols(font);
+	std::vector<std::string> names(argv + optind + 1, argv + argc);
+	std::vector<BMP> pages(names.size());
+	unsigned long long rows = 0;
+	for (unsigned i = 0; i < pages.size(); ++i)
+	{
+		pages[i].ReadFromFile(names[i].c_str());
+		rows += pages[i].TellHeight();
+	}
+
+	// Find the lines and characters the way pages are read
+	std::vector<TextLine> lines;
+	std::vector<OCR::BinaryImage> binarized;
+	std::vector<OCR::Font::Symbol> symbols;
+	unsigned glyphs = 0, widest = 1, tallest = 1;
+	for (unsigned i = 0; i < pages.size(); ++i)
+	{
+		std::vector<OCR::Box> areas = OCR::Page::findLines(pages[i]);
+		for (unsigned l = 0; l < areas.size(); ++l)
+		{
+			TextLine line;
+			line.page = i;
+			line.area = areas[l];
+			binarized.push_back(OCR::BinaryImage(pages[i], line.area));
+			line.parts = line.pared = OCR::Line::split(binarized.back(),
+			        line.area);
+			for (unsigned g = 0; g < line.pared.size(); ++g)
+			{
+				binarized.back().pareDown(line.pared[g]);
+				widest = std::max(widest, (unsigned) line.pared[g].width());
+				tallest = std::max(tallest, (unsigned) line.pared[g].height());
+			}
+			OCR::FeatureBatch batch;
+			batch.extract(binarized.back(), line.parts);
+			for (unsigned g = 0; g < batch.size(); ++g)
+				symbols.push_back(batch.symbol(g));
+			glyphs += line.parts.size();
+			lines.push_back(line);
+		}
+	}
+	if (!glyphs || references.empty())
+	{
+		std::cerr << argv[0] << ": no characters found, or font "
+		        << argv[optind] << " has no symbols\n";
+		return 1;
+	}
+
+	// Room for the widest and tallest character, allocated once
+	std::vector<bool *> columns(widest);
+	for (unsigned x = 0; x < widest; ++x)
+		columns[x] = new bool[tallest];
+	bool ** visited = &columns[0];
+
+	std::cout << pages.size() << " pages, " << lines.size() << " lines, "
+	        << glyphs << " characters, " << references.size()
+	        << " symbols in " << argv[optind] << "\n\n"
+	        << std::left << std::setw(24) << "routine" << std::right
+	        << std::setw(18) << "items" << std::setw(23) << "mean ns/item"
+	        << std::setw(12) << "min" << std::setw(12) << "median"
+	        << std::setw(12) << "max" << '\n';
+
+	report("BMP::ReadFromFile", pages.size(), "pages", Bench::measure([&]()
+	{
+		BMP decoded;
+		for (unsigned i = 0; i < names.size(); ++i)
+			decoded.ReadFromFile(names[i].c_str());
+	}, pages.size(), repetitions));
+
+	report("isForeground row scan", rows, "rows", Bench::measure([&]()
+	{
+		for (unsigned i = 0; i < pages.size(); ++i)
+			sink = OCR::Page::findLines(pages[i]).size();
+	}, rows, repetitions));
+
+	report("BinaryImage", lines.size(), "lines", Bench::measure([&]()
+	{
+		for (unsigned l = 0; l < lines.size(); ++l)
+			OCR::BinaryImage(pages[lines[l].page], lines[l].area);
+	}, lines.size(), repetitions));
+
+	report("Line::split", lines.size(), "lines", Bench::measure([&]()
+	{
+		for (unsigned l = 0; l < lines.size(); ++l)
+			sink = OCR::Line::split(binarized[l], lines[l].area).size();
+	}, lines.size(), repetitions));
+
+	// A fill of the background from the top left corner, as countHoles
+	// begins, including clearing the pixels it may visit
+	report("floodFill", glyphs, "chars", Bench::measure([&]()
+	{
+		for (unsigned l = 0; l < lines.size(); ++l)
+			for (unsigned g = 0; g < lines[l].pared.size(); ++g)
+			{
+				const OCR::Box & part = lines[l].pared[g];
+				for (int x = 0; x < part.width(); ++x)
+					for (int y = 0; y < part.height(); ++y)
+						visited[x][y] = false;
+				sink = OCR::floodFill(pages[lines[l].page], part.low, true,
+				        visited, part).area();
+			}
+	}, glyphs, repetitions));
+
+	report("Grapheme::pareDown", glyphs, "chars", Bench::measure([&]()
+	{
+		for (unsigned l = 0; l < lines.size(); ++l)
+			for (unsigned g = 0; g < lines[l].parts.size(); ++g)
+				OCR::Grapheme(pages[lines[l].page], lines[l].parts[g],
+				        font).pareDown();
+	}, glyphs, repetitions));
+
+	report("Grapheme::countHoles", glyphs, "chars", Bench::measure([&]()
+	{
+		for (unsigned l = 0; l < lines.size(); ++l)
+			for (unsigned g = 0; g < lines[l].pared.size(); ++g)
+				sink = OCR::Grapheme(pages[lines[l].page], lines[l].pared[g],
+				        font).countHoles();
+	}, glyphs, repetitions));
+
+	report("Grapheme::areaDensity", glyphs, "chars", Bench::measure([&]()
+	{
+		for (unsigned l = 0; l < lines.size(); ++l)
+			for (unsigned g = 0; g < lines[l].pared.size(); ++g)
+				sink = 1000 * OCR::Grapheme(pages[lines[l].page],
+				        lines[l].pared[g], font).areaDensity(lines[l].pared[g]);
+	}, glyphs, repetitions));
+
+	report("BinaryImage::pareDown", glyphs, "chars", Bench::measure([&]()
+	{
+		for (unsigned l = 0; l < lines.size(); ++l)
+			for (unsigned g = 0; g < lines[l].parts.size(); ++g)
+			{
+				OCR::Box part = lines[l].parts[g];
+				binarized[l].pareDown(part);
+				sink = part.low.x;
+			}
+	}, glyphs, repetitions));
+
+	report("BinaryImage::countHoles", glyphs, "chars", Bench::measure([&]()
+	{
+		for (unsigned l = 0; l < lines.size(); ++l)
+			for (unsigned g = 0; g < lines[l].pared.size(); ++g)
+				sink = binarized[l].countHoles(lines[l].pared[g]);
+	}, glyphs, repetitions));
+
+	report("FeatureBatch::extract", glyphs, "chars", Bench::measure([&]()
+	{
+		OCR::FeatureBatch batch;
+		for (unsigned l = 0; l < lines.size(); ++l)
+			batch.extract(binarized[l], lines[l].parts);
+	}, glyphs, repetitions));
+
+	const unsigned long long pairs = symbols.size() * references.size();
+	report("Symbol::match", pairs, "pairs", Bench::measure([&]()
+	{
+		unsigned long long total = 0;
+		for (unsigned i = 0; i < symbols.size(); ++i)
+			for (unsigned r = 0; r < references.size(); ++r)
+				total += symbols[i].match(references[r]);
+		sink = total;
+	}, pairs, repetitions));
+
+	report("Font::bestMatch", symbols.size(), "chars", Bench::measure([&]()
+	{
+		for (unsigned i = 0; i < symbols.size(); ++i)
+			sink = font.bestMatch(symbols[i]);
+	}, symbols.size(), repetitions));
+
+	for (unsigned x = 0; x < widest; ++x)
+		delete[] columns[x];
+	return 0;
+}
@@ -0,0 +1,138 @@
+/**
+ * @file prototypes.cpp
+ * @date October 2026
+ * @author Omophagic Content Reader contributors
+ * @brief Measures how matching slows and accuracy changes as ocr-learn
+ *        keeps more prototypes of each character.
+ * @version $Id$
+ */
+/*
+ * Copyright 2026 Omophagic Content Reader contributors
+ *
+ * This file is part of Omophagic Content Reader.
+ *
+ * Omophagic Content Reader is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Omophagic Content Reader is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Omophagic Content Reader.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include <cstdio>
+#include <iostream>
+#include <iomanip>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <map>
+#include "EasyBMP/EasyBMP.h"
+#include "Font.h"
+#include "Line.h"
+#include "Bench.h"
+
+/// Number of times each character is matched
+const unsigned MATCH_REPEAT = 200;
+
+/// Characters of the font images, in order, as ocr-learn expects
+const std::string ALPHABET =
+        "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789.,?!/@_";
+
+int main(int argc, char * argv[])
+{
+	if (argc < 2)
+	{
+		std::cerr << "Usage: " << argv[0] << " <font image>...\n"
+		        << "Fonts are learned from the images with more and more "
+		        << "prototypes\nof each character, and the same characters "
+		        << "matched against them.\n";
+		return 1;
+	}
+	const std::string directory = Bench::temporaryDirectory();
+	if (directory.empty())
+	{
+		std::cerr << argv[0] << ": cannot make a temporary directory\n";
+		return 1;
+	}
+
+	// Statistics of each character in each image, as ocr-learn reads them
+	OCR::Font bogus("BOGUS");
+	std::map<char, std::vector<OCR::Font::Symbol> > samples;
+	std::vector<OCR::Font::Symbol> symbols;
+	std::string expected;
+	for (int fileNum = 1; fileNum < argc; ++fileNum)
+	{
+		BMP img;
+		img.ReadFromFile(argv[fileNum]);
+		OCR::Line line(img, bogus);
+		OCR::FeatureBatch features;
+		line.Read(NULL, &features);
+		for (unsigned i = 0; i < features.size() && i < ALPHABET.size(); ++i)
+		{
+			samples[ALPHABET[i]].push_back(features.symbol(i));
+			symbols.push_back(features.symbol(i));
+			expected += ALPHABET[i];
+		}
+	}
+
+	std::cout << std::setw(12) << "prototypes" << std::setw(10) << "symbols"
+	        << std::setw(14) << "ns/match" << std::setw(12) << "evals/char"
+	        << std::setw(10) << "correct" << '\n';
+	const unsigned counts[] =
+	{ 1, 2, 4, 8, 16, 32 };
+	for (unsigned c = 0; c < sizeof(counts) / sizeof(counts[0]); ++c)
+	{
+		std::ostringstream name;
+		name << directory << "/bench-prototypes-" << counts[c] << ".font";
+		const std::string file = name.str();
+		std::ofstream outfile(file.c_str());
+		unsigned total = 0;
+		for (std::map<char, std::vector<OCR::Font::Symbol> >::iterator itr =
+		        samples.begin(); itr != samples.end(); ++itr)
+		{
+			std::vector<OCR::Font::Symbol> clusters =
+			        OCR::Font::Symbol::cluster(itr->second, counts[c]);
+			for (unsigned p = 0; p < clusters.size(); ++p, ++total)
+				outfile << itr->first << ' ' << clusters[p] << '\n';
+		}
+		outfile.close();
+		if (outfile.fail())
+		{
+			std::cerr << argv[0] << ": cannot write " << file << '\n';
+			std::remove(file.c_str());
+			rmdir(directory.c_str());
+			return 1;
+		}
+		OCR::Font font = OCR::Font::fromText(file);
+		std::remove(file.c_str());
+
+		volatile char sink = 0;
+		font.clearStats();
+		const double start = Bench::now();
+		for (unsigned r = 0; r < MATCH_REPEAT; ++r)
+			for (unsigned i = 0; i < symbols.size(); ++i)
+				sink ^= font.bestMatch(symbols[i]);
+		const double time = Bench::now() - start;
+
+		unsigned correct = 0;
+		for (unsigned i = 0; i < symbols.size(); ++i)
+			correct += font.bestMatch(symbols[i]) == expected[i];
+
+		std::cout << std::setw(12) << counts[c] << std::setw(10) << total
+		        << std::fixed << std::setprecision(1) << std::setw(14) << time
+		        * 1e9 / (MATCH_REPEAT * (double) symbols.size()) << std::setw(12)
+		        << font.stats().evaluationsPerSearch() << std::setw(9)
+		        << 100.0 * correct / symbols.size() << "%\n";
+	}
+	rmdir(directory.c_str());
+	return 0;
+}
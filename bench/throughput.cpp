@@ -0,0 +1,277 @@
+/**
+ * @file throughput.cpp
+ * @date October 2026
+ * @author Omophagic Content Reader contributors
+ * @brief Measures how fast whole pages are read, on one or more threads.
+ * @version $Id$
+ */
+/*
+ * Copyright 2026 Omophagic Content Reader contributors
+ *
+ * This file is part of Omophagic Content Reader.
+ *
+ * Omophagic Content Reader is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Omophagic Content Reader is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Omophagic Content Reader.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include <iostream>
+#include <iomanip>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <deque>
+#include <algorithm>
+#include <thread>
+#include <atomic>
+#include <unistd.h>
+#include "EasyBMP/EasyBMP.h"
+#include "Font.h"
+#include "GlyphCache.h"
+#include "Page.h"
+#include "Profile.h"
+#include "Bench.h"
+
+/**
+ * A page to read, already decoded
+ */
+struct Image
+{
+	/// File name
+	std::string name;
+	/// The decoded image
+	BMP bitmap;
+	/// Size in pixels
+	unsigned width, height;
+	/// Number of characters read on the page, not counting spaces
+	unsigned glyphs;
+};
+
+/**
+ * The results of reading every page on some number of threads
+ */
+struct Run
+{
+	/// Number of threads reading
+	unsigned threads;
+	/// Number of pages read
+	unsigned pages;
+	/// Seconds from the first page started to the last finished
+	double seconds;
+	/// Megapixels and characters in all the pages read
+	double megapixels, glyphs;
+	/// Seconds taken by each page
+	std::vector<double> latency;
+
+	/**
+	 * Get a percentile of the time taken per page
+	 * @param p percentile, from 0 to 1
+	 * @return seconds, by the nearest rank
+	 */
+	double percentile(double p) const
+	{
+		std::vector<double> sorted(latency);
+		std::sort(sorted.begin(), sorted.end());
+		unsigned rank = p * sorted.size() + 0.999999;
+		return sorted.empty() ? 0 : sorted[rank ? rank - 1 : 0];
+	}
+};
+
+/**
+ * Reads pages until none are left, on one of several threads
+ * @param[in]     images  the pages, read in turn
+ * @param[in]     reads   total number of pages to read
+ * @param[in,out] next    index of the next read no thread has taken
+ * @param[in]     font    font to read with
+ * @param[in]     clear   whether to empty the cache of the font before
+ *                        each page, as if it were the first; only for a
+ *                        font no other thread reads with
+ * @param[out]    latency seconds taken by each read
+ */
+static void readPages(std::vector<Image> * images, unsigned reads,
+        std::atomic<unsigned> * next, OCR::Font * font, bool clear,
+        std::vector<double> * latency)
+{
+	for (unsigned r = (*next)++; r < reads; r = (*next)++)
+	{
+		Image & image = (*images)[r % images->size()];
+		if (clear)
+			font->cache().clear();
+		const double start = Bench::now();
+		OCR::Page page(image.bitmap, *font);
+		page.Read();
+		(*latency)[r] = Bench::now() - start;
+	}
+}
+
+/**
+ * Writes the results as JSON
+ * @param outs   output stream
+ * @param font   font name
+ * @param shared whether every thread read with one font
+ * @param images the pages
+ * @param runs   the results on each number of threads
+ */
+static void writeJSON(std::ostream & outs, const std::string & font,
+        bool shared, const std::vector<Image> & images,
+        const std::vector<Run> & runs)
+{
+	outs << "{\n  \"font\": \"" << font << "\",\n  \"shared_font\": "
+	        << (shared ? "true" : "false") << ",\n  \"images\": [";
+	for (unsigned i = 0; i < images.size(); ++i)
+		outs << (i ? "," : "") << "\n    { \"name\": \"" << images[i].name
+		        << "\", \"width\": " << images[i].width << ", \"height\": "
+		        << images[i].height
+		        << ", \"glyphs\": " << images[i].glyphs << " }";
+	outs << "\n  ],\n  \"runs\": [";
+	for (unsigned i = 0; i < runs.size(); ++i)
+	{
+		const Run & run = runs[i];
+		outs << (i ? "," : "") << "\n    { \"threads\": " << run.threads
+		        << ", \"pages\": " << run.pages << ", \"seconds\": "
+		        << run.seconds << ", \"pages_per_s\": " << run.pages
+		        / run.seconds << ", \"megapixels_per_s\": " << run.megapixels
+		        / run.seconds << ", \"glyphs_per_s\": " << run.glyphs
+		        / run.seconds << ", \"p50_ms\": " << run.percentile(0.5)
+		        * 1000 << ", \"p99_ms\": " << run.percentile(0.99) * 1000
+		        << " }";
+	}
+	outs << "\n  ]\n}\n";
+}
+
+int main(int argc, char * argv[])
+{
+	// Most threads to read on
+	unsigned maxThreads = std::thread::hardware_concurrency();
+	// Number of times each page is read on each number of threads
+	unsigned repeat = 5;
+	// File to write JSON to, if any
+	std::string json;
+	// File to write a trace of the run on the most threads to, if any
+	std::string trace;
+	// Whether every thread reads with one font and its one cache
+	bool shared = false;
+	int option;
+	while ((option = getopt(argc, argv, "j:o:r:st:")) != -1)
+	{
+		std::istringstream value(optarg ? optarg : "");
+		if (option == 'o')
+			json = optarg;
+		else if (option == 's')
+			shared = true;
+		else if (option == 't')
+			trace = optarg;
+		else if (option == 'j' ? !(value >> maxThreads) || !maxThreads
+		        : option != 'r' || !(value >> repeat) || !repeat)
+			argc = 0;
+	}
+	if (argc - optind < 2)
+	{
+		std::cerr << "Usage: " << argv[0] << " [-j <most threads>]"
+		        << " [-r <repeats>] [-s] [-o <JSON file>] [-t <trace file>]"
+		        << " <font name> <bitmap name>...\n"
+		        << "Every page is read on 1, 2, ... up to the most threads,"
+		        << " each thread with its\nown copy of the font and every"
+		        << " page with an empty cache, or with -s,\nevery thread"
+		        << " with the one font and its cache, emptied before each"
+		        << " run.\n";
+		return 1;
+	}
+
+	// Decode the pages and read each once, untimed, to count its characters
+	OCR::Font font(argv[optind]);
+	std::vector<Image> images(argc - optind - 1);
+	double megapixels = 0, glyphs = 0;
+	for (unsigned i = 0; i < images.size(); ++i)
+	{
+		Image & image = images[i];
+		image.name = argv[optind + 1 + i];
+		image.bitmap.ReadFromFile(image.name.c_str());
+		image.width = image.bitmap.TellWidth();
+		image.height = image.bitmap.TellHeight();
+		OCR::Page page(image.bitmap, font);
+		page.Read();
+		image.glyphs = 0;
+		const std::deque<OCR::Line> & lines = page.textLines();
+		for (unsigned l = 0; l < lines.size(); ++l)
+			image.glyphs += lines[l].glyphConfidence().size();
+		megapixels += image.width * image.height / 1e6;
+		glyphs += image.glyphs;
+	}
+
+	std::cout << std::setw(8) << "threads" << std::setw(10) << "pages/s"
+	        << std::setw(10) << "MP/s" << std::setw(12) << "glyphs/s"
+	        << std::setw(10) << "p50 ms" << std::setw(10) << "p99 ms" << '\n';
+	std::vector<Run> runs;
+	for (unsigned threads = 1; threads <= maxThreads; ++threads)
+	{
+		Run run;
+		run.threads = threads;
+		run.pages = repeat * images.size();
+		run.megapixels = repeat * megapixels;
+		run.glyphs = repeat * glyphs;
+		run.latency.assign(run.pages, 0);
+		std::atomic<unsigned> next(0);
+		std::vector<std::thread> readers;
+		// Copy the font for each thread before the clock starts
+		std::vector<OCR::Font> copies(shared ? 0 : threads, font);
+		font.cache().clear();
+		OCR::Profile::trace(!trace.empty() && threads == maxThreads);
+		const double start = Bench::now();
+		for (unsigned t = 1; t < threads; ++t)
+			readers.push_back(std::thread(readPages, &images, run.pages,
+			        &next, shared ? &font : &copies[t], !shared,
+			        &run.latency));
+		readPages(&images, run.pages, &next, shared ? &font : &copies[0],
+		        !shared, &run.latency);
+		for (unsigned t = 0; t < readers.size(); ++t)
+			readers[t].join();
+		run.seconds = Bench::now() - start;
+		OCR::Profile::trace(false);
+		runs.push_back(run);
+
+		std::cout << std::fixed << std::setw(8) << threads
+		        << std::setprecision(1) << std::setw(10) << run.pages
+		        / run.seconds << std::setprecision(2) << std::setw(10)
+		        << run.megapixels / run.seconds << std::setprecision(0)
+		        << std::setw(12) << run.glyphs / run.seconds
+		        << std::setprecision(3) << std::setw(10) << run.percentile(
+		        0.5) * 1000 << std::setw(10) << run.percentile(0.99) * 1000
+		        << '\n';
+	}
+
+	if (!trace.empty())
+	{
+		std::ofstream outfile(trace.c_str());
+		OCR::Profile::writeTrace(outfile);
+		if (outfile.fail())
+		{
+			std::cerr << argv[0] << ": cannot write " << trace << '\n';
+			return 1;
+		}
+	}
+
+	if (!json.empty())
+	{
+		std::ofstream outfile(json.c_str());
+		writeJSON(outfile, argv[optind], shared, images, runs);
+		if (outfile.fail())
+		{
+			std::cerr << argv[0] << ": cannot write " << json << '\n';
+			return 1;
+		}
+	}
+	return 0;
+}
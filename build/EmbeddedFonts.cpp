@@ -0,0 +1,4035 @@
+// Generated by ocr-compile -c; do not edit.
+#include "Font.h"
+
+namespace
+{
+
+// freesans
+alignas(64) constexpr unsigned char font0[] =
+{
+	79, 67, 82, 70, 79, 78, 84, 0, 2, 0, 0, 0, 4, 3, 2, 1,
+	144, 0, 0, 0, 128, 0, 0, 0, 66, 0, 0, 0, 20, 0, 0, 0,
+	128, 0, 0, 0, 0, 0, 0, 0, 128, 1, 0, 0, 0, 0, 0, 0,
+	72, 0, 0, 0, 0, 0, 0, 0, 192, 3, 0, 0, 0, 0, 0, 0,
+	72, 0, 0, 0, 0, 0, 0, 0, 0, 6, 0, 0, 0, 0, 0, 0,
+	72, 0, 0, 0, 0, 0, 0, 0, 64, 8, 0, 0, 0, 0, 0, 0,
+	72, 0, 0, 0, 0, 0, 0, 0, 128, 10, 0, 0, 0, 0, 0, 0,
+	72, 0, 0, 0, 0, 0, 0, 0, 192, 12, 0, 0, 0, 0, 0, 0,
+	72, 0, 0, 0, 0, 0, 0, 0, 0, 15, 0, 0, 0, 0, 0, 0,
+	72, 0, 0, 0, 0, 0, 0, 0, 64, 17, 0, 0, 0, 0, 0, 0,
+	72, 0, 0, 0, 0, 0, 0, 0, 128, 19, 0, 0, 0, 0, 0, 0,
+	72, 0, 0, 0, 0, 0, 0, 0, 0, 20, 0, 0, 0, 0, 0, 0,
+	19, 0, 0, 0, 0, 0, 0, 0, 192, 30, 0, 0, 0, 0, 0, 0,
+	69, 0, 0, 0, 0, 0, 0, 0, 64, 31, 0, 0, 0, 0, 0, 0,
+	69, 0, 0, 0, 0, 0, 0, 0, 192, 65, 0, 0, 0, 0, 0, 0,
+	69, 0, 0, 0, 0, 0, 0, 0, 64, 66, 0, 0, 0, 0, 0, 0,
+	69, 0, 0, 0, 0, 0, 0, 0, 64, 84, 0, 0, 0, 0, 0, 0,
+	69, 0, 0, 0, 0, 0, 0, 0, 192, 84, 0, 0, 0, 0, 0, 0,
+	69, 0, 0, 0, 0, 0, 0, 0, 64, 90, 0, 0, 0, 0, 0, 0,
+	69, 0, 0, 0, 0, 0, 0, 0, 192, 90, 0, 0, 0, 0, 0, 0,
+	69, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 240, 63, 0, 0, 0, 0, 0, 0, 240, 63,
+	0, 0, 0, 0, 0, 0, 240, 63, 0, 0, 0, 0, 0, 0, 240, 63,
+	0, 0, 0, 0, 0, 0, 240, 63, 0, 0, 0, 0, 0, 0, 240, 63,
+	0, 0, 0, 0, 0, 0, 240, 63, 0, 0, 0, 0, 0, 0, 240, 63,
+	0, 0, 0, 0, 0, 0, 240, 63, 0, 0, 0, 0, 0, 0, 240, 63,
+	0, 0, 0, 0, 0, 0, 240, 63, 0, 0, 0, 0, 0, 0, 240, 63,
+	0, 0, 0, 0, 0, 0, 240, 63, 0, 0, 0, 0, 0, 0, 240, 63,
+	0, 0, 0, 0, 0, 0, 240, 63, 0, 0, 0, 0, 0, 0, 240, 63,
+	0, 0, 0, 0, 0, 0, 240, 63, 0, 0, 0, 0, 0, 0, 240, 63,
+	0, 0, 0, 0, 0, 0, 240, 63, 0, 0, 0, 0, 0, 0, 0, 64,
+	0, 0, 0, 0, 0, 0, 0, 64, 0, 0, 0, 0, 0, 0, 240, 127,
+	0, 0, 0, 0, 0, 0, 240, 127, 0, 0, 0, 0, 0, 0, 240, 127,
+	225, 11, 147, 169, 130, 81, 207, 63, 231, 199, 95, 90, 212, 39, 207, 63,
+	10, 46, 86, 212, 96, 26, 211, 63, 233, 186, 240, 131, 243, 169, 210, 63,
+	231, 225, 4, 166, 211, 186, 212, 63, 240, 136, 10, 213, 205, 197, 215, 63,
+	214, 199, 67, 223, 221, 202, 210, 63, 167, 118, 134, 169, 45, 117, 215, 63,
+	148, 103, 94, 14, 187, 239, 214, 63, 199, 218, 223, 217, 30, 189, 216, 63,
+	217, 37, 170, 183, 6, 182, 220, 63, 183, 95, 62, 89, 49, 92, 215, 63,
+	209, 201, 82, 235, 253, 70, 218, 63, 179, 9, 48, 44, 127, 190, 215, 63,
+	205, 145, 149, 95, 6, 99, 222, 63, 139, 22, 160, 109, 53, 235, 214, 63,
+	28, 149, 155, 168, 165, 185, 216, 63, 54, 61, 40, 40, 69, 43, 224, 63,
+	0, 0, 0, 0, 0, 0, 240, 63, 0, 0, 0, 0, 0, 0, 240, 63,
+	251, 201, 24, 31, 102, 47, 215, 63, 213, 93, 217, 5, 131, 107, 217, 63,
+	210, 110, 244, 49, 31, 16, 216, 63, 190, 17, 221, 179, 174, 209, 210, 63,
+	33, 177, 221, 61, 64, 247, 217, 63, 45, 207, 131, 187, 179, 118, 214, 63,
+	46, 87, 63, 54, 201, 143, 216, 63, 171, 179, 90, 96, 143, 9, 228, 63,
+	240, 52, 153, 241, 182, 210, 210, 63, 160, 195, 124, 121, 1, 246, 215, 63,
+	57, 124, 210, 137, 4, 83, 207, 63, 79, 202, 164, 134, 54, 0, 219, 63,
+	35, 107, 13, 165, 246, 34, 220, 63, 75, 147, 82, 208, 237, 37, 235, 63,
+	0, 0, 0, 0, 0, 0, 240, 63, 177, 24, 117, 173, 189, 207, 235, 63,
+	0, 0, 0, 0, 0, 0, 240, 63, 169, 104, 172, 253, 157, 237, 218, 63,
+	57, 209, 174, 66, 202, 79, 222, 63, 54, 148, 218, 139, 104, 59, 217, 63,
+	148, 20, 88, 0, 83, 6, 221, 63, 166, 69, 125, 146, 59, 108, 217, 63,
+	120, 126, 81, 130, 254, 66, 222, 63, 155, 88, 224, 43, 186, 245, 213, 63,
+	174, 18, 44, 14, 103, 126, 219, 63, 238, 181, 160, 247, 198, 16, 216, 63,
+	134, 113, 55, 136, 214, 138, 211, 63, 136, 213, 31, 97, 24, 176, 220, 63,
+	64, 193, 197, 138, 26, 76, 218, 63, 208, 237, 37, 141, 209, 58, 215, 63,
+	136, 158, 148, 73, 13, 109, 219, 63, 102, 18, 245, 130, 79, 115, 219, 63,
+	83, 121, 59, 194, 105, 193, 214, 63, 142, 88, 139, 79, 1, 48, 213, 63,
+	114, 192, 174, 38, 79, 89, 218, 63, 59, 225, 37, 56, 245, 129, 214, 63,
+	129, 232, 73, 153, 212, 208, 218, 63, 224, 44, 37, 203, 73, 40, 213, 63,
+	23, 127, 219, 19, 36, 182, 219, 63, 231, 54, 225, 94, 153, 183, 224, 63,
+	248, 56, 211, 132, 237, 39, 219, 63, 247, 88, 250, 208, 5, 245, 218, 63,
+	107, 45, 204, 66, 59, 167, 221, 63, 68, 76, 137, 36, 122, 25, 222, 63,
+	13, 26, 250, 39, 184, 88, 220, 63, 194, 135, 18, 45, 121, 60, 219, 63,
+	62, 179, 36, 64, 77, 45, 219, 63, 221, 66, 87, 34, 80, 253, 221, 63,
+	45, 209, 89, 102, 17, 138, 224, 63, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	182, 161, 98, 156, 191, 137, 243, 63, 175, 119, 127, 188, 87, 173, 242, 63,
+	128, 159, 113, 225, 64, 200, 248, 63, 139, 79, 1, 48, 158, 193, 241, 63,
+	191, 72, 104, 203, 185, 20, 243, 63, 35, 249, 74, 32, 37, 118, 233, 63,
+	9, 56, 132, 42, 53, 123, 244, 63, 34, 26, 221, 65, 236, 76, 245, 63,
+	32, 152, 163, 199, 239, 109, 243, 63, 43, 77, 74, 65, 183, 151, 244, 63,
+	81, 102, 131, 76, 50, 242, 248, 63, 241, 157, 152, 245, 98, 40, 249, 63,
+	114, 220, 41, 29, 172, 255, 244, 63, 85, 24, 91, 8, 114, 80, 245, 63,
+	185, 136, 239, 196, 172, 151, 241, 63, 9, 196, 235, 250, 5, 187, 242, 63,
+	15, 127, 77, 214, 168, 135, 247, 63, 160, 224, 98, 69, 13, 38, 245, 63,
+	229, 71, 252, 138, 53, 92, 194, 63, 15, 69, 129, 62, 145, 39, 244, 63,
+	202, 253, 14, 69, 129, 62, 249, 63, 103, 126, 53, 7, 8, 102, 249, 63,
+	217, 119, 69, 240, 191, 149, 249, 63, 116, 12, 200, 94, 239, 254, 249, 63,
+	72, 51, 22, 77, 103, 167, 250, 63, 237, 42, 164, 252, 164, 90, 251, 63,
+	155, 143, 107, 67, 197, 184, 251, 63, 218, 3, 173, 192, 144, 85, 252, 63,
+	252, 222, 166, 63, 251, 145, 254, 63, 187, 15, 64, 106, 19, 231, 1, 64,
+	205, 175, 230, 0, 193, 220, 3, 64, 161, 185, 78, 35, 45, 21, 15, 64,
+	25, 28, 37, 175, 206, 17, 19, 64, 189, 198, 46, 81, 189, 213, 30, 64,
+	189, 198, 46, 81, 189, 213, 30, 64, 69, 216, 240, 244, 74, 25, 32, 64,
+	31, 75, 31, 186, 160, 14, 32, 64, 116, 122, 222, 141, 5, 133, 230, 63,
+	64, 77, 45, 91, 235, 139, 243, 63, 17, 252, 111, 37, 59, 54, 252, 63,
+	157, 99, 64, 246, 122, 247, 245, 63, 0, 174, 100, 199, 70, 96, 0, 64,
+	64, 77, 45, 91, 235, 139, 243, 63, 137, 152, 18, 73, 244, 178, 240, 63,
+	101, 57, 9, 165, 47, 4, 232, 63, 24, 178, 186, 213, 115, 210, 240, 63,
+	157, 17, 165, 189, 193, 23, 247, 63, 110, 23, 154, 235, 52, 210, 243, 63,
+	212, 154, 230, 29, 167, 232, 247, 63, 8, 85, 106, 246, 64, 43, 246, 63,
+	16, 64, 106, 19, 39, 247, 247, 63, 212, 154, 230, 29, 167, 232, 247, 63,
+	202, 84, 193, 168, 164, 78, 240, 63, 202, 79, 170, 125, 58, 158, 241, 63,
+	168, 58, 228, 102, 184, 1, 243, 63, 5, 221, 94, 210, 24, 173, 241, 63,
+	61, 68, 163, 59, 136, 157, 248, 63, 9, 225, 209, 198, 17, 107, 244, 63,
+	154, 37, 1, 106, 106, 217, 244, 63, 179, 65, 38, 25, 57, 139, 243, 63,
+	253, 19, 92, 172, 168, 65, 249, 63, 52, 244, 79, 112, 177, 34, 249, 63,
+	202, 108, 144, 73, 70, 206, 241, 63, 65, 72, 22, 48, 129, 219, 248, 63,
+	106, 193, 139, 190, 130, 52, 242, 63, 210, 169, 43, 159, 229, 249, 248, 63,
+	65, 72, 22, 48, 129, 219, 248, 63, 212, 154, 230, 29, 167, 232, 247, 63,
+	145, 97, 21, 111, 100, 158, 246, 63, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	244, 134, 251, 200, 173, 73, 191, 63, 153, 186, 43, 187, 96, 112, 212, 63,
+	42, 112, 178, 13, 220, 129, 210, 63, 225, 237, 65, 8, 200, 151, 192, 63,
+	195, 187, 92, 196, 119, 98, 196, 63, 215, 163, 112, 61, 10, 215, 199, 63,
+	177, 251, 142, 225, 177, 159, 209, 63, 145, 44, 96, 2, 183, 238, 211, 63,
+	107, 45, 204, 66, 59, 39, 224, 63, 98, 18, 46, 228, 17, 220, 220, 63,
+	71, 58, 3, 35, 47, 107, 231, 63, 204, 182, 211, 214, 136, 96, 219, 63,
+	82, 95, 150, 118, 106, 174, 230, 63, 211, 80, 163, 144, 100, 86, 225, 63,
+	69, 100, 88, 197, 27, 25, 230, 63, 33, 61, 69, 14, 17, 55, 212, 63,
+	18, 251, 4, 80, 140, 44, 209, 63, 194, 222, 196, 144, 156, 204, 231, 63,
+	0, 0, 0, 0, 0, 0, 240, 63, 0, 0, 0, 0, 0, 0, 240, 63,
+	86, 129, 90, 12, 30, 166, 205, 63, 5, 20, 234, 233, 35, 240, 212, 63,
+	45, 121, 60, 45, 63, 112, 216, 63, 110, 166, 66, 60, 18, 47, 226, 63,
+	92, 84, 139, 136, 98, 242, 226, 63, 174, 127, 215, 103, 206, 250, 211, 63,
+	15, 96, 145, 95, 63, 68, 226, 63, 15, 151, 28, 119, 74, 7, 216, 63,
+	175, 206, 49, 32, 123, 189, 199, 63, 30, 79, 203, 15, 92, 229, 197, 63,
+	53, 171, 136, 228, 117, 14, 181, 63, 126, 2, 40, 70, 150, 204, 219, 63,
+	182, 242, 146, 255, 201, 223, 218, 63, 210, 171, 1, 74, 67, 141, 235, 63,
+	0, 0, 0, 0, 0, 0, 240, 63, 30, 195, 99, 63, 139, 37, 236, 63,
+	0, 0, 0, 0, 0, 0, 240, 63, 203, 186, 127, 44, 68, 135, 225, 63,
+	86, 130, 197, 225, 204, 47, 228, 63, 93, 50, 142, 145, 236, 17, 223, 63,
+	94, 158, 206, 21, 165, 132, 212, 63, 149, 14, 214, 255, 57, 204, 205, 63,
+	145, 183, 92, 253, 216, 36, 228, 63, 225, 10, 40, 212, 211, 71, 196, 63,
+	254, 243, 52, 96, 144, 244, 203, 63, 242, 236, 242, 173, 15, 235, 201, 63,
+	153, 213, 59, 220, 14, 13, 193, 63, 188, 87, 173, 76, 248, 37, 226, 63,
+	145, 240, 189, 191, 65, 123, 209, 63, 76, 55, 137, 65, 96, 229, 196, 63,
+	19, 238, 149, 121, 171, 174, 207, 63, 24, 123, 47, 190, 104, 143, 207, 63,
+	155, 1, 46, 200, 150, 229, 197, 63, 123, 18, 216, 156, 131, 103, 192, 63,
+	158, 149, 180, 226, 27, 10, 226, 63, 37, 5, 22, 192, 148, 129, 205, 63,
+	184, 174, 152, 17, 222, 158, 224, 63, 239, 140, 182, 42, 137, 236, 201, 63,
+	219, 49, 117, 87, 118, 193, 222, 63, 229, 122, 219, 76, 133, 120, 216, 63,
+	176, 58, 114, 164, 51, 48, 221, 63, 11, 180, 59, 164, 24, 32, 221, 63,
+	110, 251, 30, 245, 215, 43, 208, 63, 173, 132, 238, 146, 56, 43, 218, 63,
+	222, 57, 148, 161, 42, 166, 209, 63, 190, 136, 182, 99, 234, 174, 221, 63,
+	244, 24, 229, 153, 151, 195, 221, 63, 5, 51, 166, 96, 141, 179, 203, 63,
+	85, 22, 133, 93, 20, 61, 227, 63, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	237, 126, 21, 224, 187, 205, 212, 63, 110, 78, 37, 3, 64, 21, 214, 63,
+	248, 80, 162, 37, 143, 39, 225, 63, 52, 247, 144, 240, 189, 191, 210, 63,
+	248, 253, 155, 23, 39, 190, 212, 63, 84, 53, 65, 212, 125, 0, 216, 63,
+	194, 47, 245, 243, 166, 34, 203, 63, 116, 64, 18, 246, 237, 36, 209, 63,
+	154, 64, 17, 139, 24, 118, 222, 63, 95, 239, 254, 120, 175, 90, 205, 63,
+	190, 18, 72, 137, 93, 219, 215, 63, 152, 166, 8, 112, 122, 23, 199, 63,
+	20, 204, 152, 130, 53, 206, 220, 63, 216, 214, 79, 255, 89, 243, 212, 63,
+	123, 75, 57, 95, 236, 61, 224, 63, 127, 77, 214, 168, 135, 104, 206, 63,
+	106, 163, 58, 29, 200, 122, 208, 63, 44, 156, 164, 249, 99, 90, 215, 63,
+	0, 0, 0, 0, 0, 0, 240, 63, 0, 0, 0, 0, 0, 0, 240, 63,
+	16, 4, 200, 208, 177, 131, 222, 63, 239, 142, 140, 213, 230, 255, 213, 63,
+	215, 103, 206, 250, 148, 99, 221, 63, 0, 0, 0, 0, 0, 0, 0, 0,
+	139, 249, 185, 161, 41, 59, 208, 63, 255, 175, 58, 114, 164, 51, 210, 63,
+	44, 129, 148, 216, 181, 189, 214, 63, 236, 246, 89, 101, 166, 180, 238, 63,
+	191, 214, 165, 70, 232, 231, 224, 63, 162, 153, 39, 215, 20, 200, 220, 63,
+	88, 174, 183, 205, 84, 136, 220, 63, 194, 252, 21, 50, 87, 134, 231, 63,
+	26, 224, 130, 108, 89, 190, 229, 63, 0, 0, 0, 0, 0, 0, 240, 63,
+	0, 0, 0, 0, 0, 0, 240, 63, 11, 182, 17, 79, 118, 179, 231, 63,
+	0, 0, 0, 0, 0, 0, 240, 63, 178, 74, 233, 153, 94, 98, 221, 63,
+	164, 51, 48, 242, 178, 38, 223, 63, 15, 97, 252, 52, 238, 205, 208, 63,
+	105, 115, 156, 219, 132, 123, 211, 63, 33, 88, 85, 47, 191, 211, 202, 63,
+	147, 199, 211, 242, 3, 87, 217, 63, 125, 37, 144, 18, 187, 182, 213, 63,
+	228, 103, 35, 215, 77, 41, 220, 63, 134, 29, 198, 164, 191, 151, 215, 63,
+	10, 162, 238, 3, 144, 218, 213, 63, 22, 133, 93, 20, 61, 240, 226, 63,
+	53, 178, 43, 45, 35, 245, 217, 63, 212, 239, 194, 214, 108, 229, 219, 63,
+	86, 14, 45, 178, 157, 239, 213, 63, 44, 12, 145, 211, 215, 243, 219, 63,
+	132, 46, 225, 208, 91, 60, 216, 63, 147, 26, 218, 0, 108, 64, 209, 63,
+	235, 226, 54, 26, 192, 91, 215, 63, 213, 3, 230, 33, 83, 62, 214, 63,
+	117, 62, 60, 75, 144, 17, 224, 63, 139, 141, 121, 29, 113, 200, 213, 63,
+	149, 239, 25, 137, 208, 8, 217, 63, 136, 213, 31, 97, 24, 176, 227, 63,
+	107, 184, 200, 61, 93, 221, 205, 63, 30, 166, 125, 115, 127, 245, 223, 63,
+	0, 3, 65, 128, 12, 157, 225, 63, 195, 73, 154, 63, 166, 181, 223, 63,
+	21, 171, 6, 97, 110, 247, 219, 63, 208, 185, 219, 245, 210, 20, 219, 63,
+	98, 15, 237, 99, 5, 191, 223, 63, 74, 211, 160, 104, 30, 192, 221, 63,
+	88, 141, 37, 172, 141, 177, 221, 63, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	114, 83, 3, 205, 231, 220, 212, 63, 105, 195, 97, 105, 224, 71, 214, 63,
+	242, 235, 135, 216, 96, 225, 202, 63, 73, 190, 18, 72, 137, 93, 211, 63,
+	181, 52, 183, 66, 88, 141, 211, 63, 186, 134, 25, 26, 79, 4, 216, 63,
+	1, 251, 232, 212, 149, 207, 215, 63, 199, 213, 200, 174, 180, 140, 221, 63,
+	11, 184, 231, 249, 211, 70, 205, 63, 57, 241, 213, 142, 226, 28, 225, 63,
+	28, 8, 201, 2, 38, 112, 228, 63, 83, 236, 104, 28, 234, 119, 218, 63,
+	72, 106, 161, 100, 114, 106, 221, 63, 231, 224, 153, 208, 36, 177, 213, 63,
+	135, 222, 226, 225, 61, 135, 224, 63, 111, 72, 163, 2, 39, 219, 214, 63,
+	112, 96, 114, 163, 200, 218, 224, 63, 104, 90, 98, 101, 52, 114, 228, 63,
+	0, 0, 0, 0, 0, 0, 240, 63, 0, 0, 0, 0, 0, 0, 240, 63,
+	21, 0, 227, 25, 52, 244, 209, 63, 47, 222, 143, 219, 47, 31, 226, 63,
+	100, 62, 32, 208, 153, 180, 203, 63, 229, 12, 197, 29, 111, 242, 218, 63,
+	199, 99, 6, 42, 227, 223, 224, 63, 174, 244, 218, 108, 172, 196, 217, 63,
+	172, 228, 99, 119, 129, 18, 229, 63, 39, 77, 131, 162, 121, 0, 223, 63,
+	252, 81, 212, 153, 123, 72, 206, 63, 216, 213, 228, 41, 171, 233, 224, 63,
+	60, 9, 182, 91, 220, 144, 168, 63, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 240, 63,
+	0, 0, 0, 0, 0, 0, 240, 63, 11, 182, 17, 79, 118, 179, 231, 63,
+	0, 0, 0, 0, 0, 0, 240, 63, 151, 1, 103, 41, 89, 206, 224, 63,
+	75, 174, 98, 241, 155, 194, 225, 63, 204, 42, 108, 6, 184, 160, 230, 63,
+	2, 40, 70, 150, 204, 49, 227, 63, 38, 228, 131, 158, 205, 170, 228, 63,
+	155, 146, 172, 195, 209, 85, 218, 63, 249, 158, 145, 8, 141, 96, 214, 63,
+	57, 38, 139, 251, 143, 76, 220, 63, 222, 0, 51, 223, 193, 79, 215, 63,
+	170, 124, 207, 72, 132, 70, 214, 63, 192, 174, 38, 79, 89, 77, 210, 63,
+	201, 29, 54, 145, 153, 11, 218, 63, 181, 110, 131, 218, 111, 237, 202, 63,
+	98, 187, 123, 128, 238, 203, 223, 63, 119, 132, 211, 130, 23, 125, 219, 63,
+	122, 0, 139, 252, 250, 33, 214, 63, 125, 236, 46, 80, 82, 96, 209, 63,
+	99, 99, 94, 71, 28, 178, 220, 63, 247, 234, 227, 161, 239, 110, 214, 63,
+	38, 225, 66, 30, 193, 13, 225, 63, 5, 107, 156, 77, 71, 0, 214, 63,
+	225, 13, 105, 84, 224, 100, 224, 63, 81, 22, 190, 190, 214, 165, 216, 63,
+	228, 132, 9, 163, 89, 89, 224, 63, 189, 252, 78, 147, 25, 111, 205, 63,
+	232, 246, 146, 198, 104, 29, 225, 63, 79, 59, 252, 53, 89, 163, 219, 63,
+	45, 232, 189, 49, 4, 0, 220, 63, 207, 44, 9, 80, 83, 75, 224, 63,
+	27, 99, 39, 188, 4, 167, 219, 63, 36, 13, 110, 107, 11, 207, 221, 63,
+	166, 213, 144, 184, 199, 82, 227, 63, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	84, 229, 123, 70, 34, 52, 198, 63, 136, 242, 5, 45, 36, 96, 198, 63,
+	22, 22, 220, 15, 120, 96, 208, 63, 153, 127, 244, 77, 154, 6, 210, 63,
+	246, 206, 104, 171, 146, 200, 212, 63, 253, 130, 221, 176, 109, 81, 215, 63,
+	125, 207, 72, 132, 70, 176, 215, 63, 174, 102, 157, 241, 125, 113, 221, 63,
+	1, 107, 213, 174, 9, 105, 223, 63, 7, 207, 132, 38, 137, 37, 224, 63,
+	18, 23, 128, 70, 233, 210, 225, 63, 138, 60, 73, 186, 102, 242, 227, 63,
+	225, 182, 182, 240, 188, 84, 216, 63, 172, 226, 141, 204, 35, 127, 217, 63,
+	170, 40, 94, 101, 109, 83, 219, 63, 94, 130, 83, 31, 72, 222, 214, 63,
+	4, 3, 8, 31, 74, 180, 208, 63, 143, 114, 48, 155, 0, 195, 215, 63,
+	0, 0, 0, 0, 0, 0, 240, 63, 0, 0, 0, 0, 0, 0, 240, 63,
+	37, 32, 38, 225, 66, 30, 205, 63, 142, 206, 249, 41, 142, 3, 203, 63,
+	88, 30, 164, 167, 200, 33, 220, 63, 130, 169, 102, 214, 82, 64, 225, 63,
+	186, 161, 41, 59, 253, 160, 218, 63, 35, 191, 126, 136, 13, 22, 215, 63,
+	173, 50, 83, 90, 127, 75, 223, 63, 52, 74, 151, 254, 37, 169, 232, 63,
+	70, 12, 59, 140, 73, 127, 211, 63, 9, 169, 219, 217, 87, 30, 224, 63,
+	4, 143, 111, 239, 26, 244, 219, 63, 23, 157, 44, 181, 222, 111, 198, 63,
+	182, 189, 221, 146, 28, 176, 197, 63, 184, 2, 10, 245, 244, 145, 230, 63,
+	0, 0, 0, 0, 0, 0, 240, 63, 0, 0, 0, 0, 0, 0, 240, 63,
+	0, 0, 0, 0, 0, 0, 240, 63, 236, 221, 31, 239, 85, 43, 215, 63,
+	155, 146, 172, 195, 209, 85, 218, 63, 116, 66, 232, 160, 75, 56, 227, 63,
+	154, 150, 88, 25, 141, 124, 213, 63, 194, 21, 80, 168, 167, 15, 224, 63,
+	67, 226, 30, 75, 31, 186, 223, 63, 30, 224, 73, 11, 151, 85, 213, 63,
+	79, 176, 255, 58, 55, 109, 218, 63, 70, 209, 3, 31, 131, 21, 216, 63,
+	198, 105, 136, 42, 252, 25, 215, 63, 211, 45, 59, 196, 63, 236, 226, 63,
+	150, 232, 44, 179, 8, 197, 217, 63, 11, 124, 69, 183, 94, 211, 211, 63,
+	252, 165, 69, 125, 146, 59, 220, 63, 188, 179, 118, 219, 133, 230, 213, 63,
+	209, 204, 147, 107, 10, 100, 214, 63, 118, 109, 111, 183, 36, 7, 217, 63,
+	120, 181, 220, 153, 9, 134, 220, 63, 94, 187, 180, 225, 176, 52, 214, 63,
+	165, 158, 5, 161, 188, 143, 224, 63, 49, 238, 6, 209, 90, 209, 208, 63,
+	142, 60, 16, 89, 164, 137, 221, 63, 114, 195, 239, 166, 91, 246, 224, 63,
+	234, 236, 100, 112, 148, 60, 224, 63, 158, 36, 93, 51, 249, 102, 219, 63,
+	196, 123, 14, 44, 71, 200, 222, 63, 225, 123, 127, 131, 246, 234, 215, 63,
+	120, 237, 210, 134, 195, 210, 219, 63, 182, 71, 111, 184, 143, 92, 224, 63,
+	36, 37, 61, 12, 173, 78, 206, 63, 56, 105, 26, 20, 205, 3, 222, 63,
+	100, 58, 116, 122, 222, 13, 225, 63, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	61, 43, 105, 197, 55, 20, 200, 63, 219, 138, 253, 101, 247, 228, 197, 63,
+	52, 189, 196, 88, 166, 95, 202, 63, 241, 189, 191, 65, 123, 245, 209, 63,
+	224, 246, 4, 137, 237, 238, 212, 63, 192, 32, 233, 211, 42, 250, 214, 63,
+	120, 8, 227, 167, 113, 111, 202, 63, 190, 45, 88, 170, 11, 120, 208, 63,
+	100, 230, 2, 151, 199, 154, 205, 63, 36, 182, 187, 7, 232, 190, 209, 63,
+	245, 99, 147, 252, 136, 95, 208, 63, 188, 90, 238, 204, 4, 195, 207, 63,
+	49, 148, 19, 237, 42, 164, 215, 63, 20, 120, 39, 159, 30, 219, 216, 63,
+	99, 41, 146, 175, 4, 82, 219, 63, 95, 36, 180, 229, 92, 138, 222, 63,
+	128, 16, 201, 144, 99, 107, 224, 63, 193, 56, 184, 116, 204, 249, 227, 63,
+	0, 0, 0, 0, 0, 0, 240, 63, 0, 0, 0, 0, 0, 0, 240, 63,
+	197, 143, 49, 119, 45, 33, 222, 63, 41, 203, 16, 199, 186, 184, 220, 63,
+	230, 229, 176, 251, 142, 225, 215, 63, 135, 136, 155, 83, 201, 0, 202, 63,
+	98, 249, 243, 109, 193, 82, 217, 63, 15, 212, 41, 143, 110, 132, 219, 63,
+	239, 75, 71, 74, 196, 165, 176, 63, 94, 213, 89, 45, 176, 199, 218, 63,
+	110, 224, 14, 212, 41, 143, 194, 63, 180, 200, 118, 190, 159, 26, 191, 63,
+	234, 14, 24, 218, 239, 63, 176, 63, 253, 17, 134, 1, 75, 174, 229, 63,
+	237, 213, 199, 67, 223, 93, 233, 63, 184, 2, 10, 245, 244, 145, 230, 63,
+	0, 0, 0, 0, 0, 0, 240, 63, 0, 0, 0, 0, 0, 0, 240, 63,
+	0, 0, 0, 0, 0, 0, 240, 63, 147, 30, 134, 86, 39, 103, 215, 63,
+	147, 199, 211, 242, 3, 87, 217, 63, 0, 0, 0, 0, 0, 0, 0, 0,
+	117, 177, 105, 165, 16, 200, 226, 63, 60, 217, 205, 140, 126, 52, 204, 63,
+	139, 79, 1, 48, 158, 65, 225, 63, 218, 201, 224, 40, 121, 117, 213, 63,
+	247, 228, 97, 161, 214, 52, 218, 63, 133, 206, 107, 236, 18, 213, 215, 63,
+	220, 73, 68, 248, 23, 65, 199, 63, 35, 187, 210, 50, 82, 239, 211, 63,
+	170, 12, 227, 110, 16, 173, 217, 63, 54, 33, 173, 49, 232, 132, 222, 63,
+	99, 40, 39, 218, 85, 72, 219, 63, 69, 157, 185, 135, 132, 239, 223, 63,
+	73, 99, 180, 142, 170, 38, 214, 63, 207, 107, 236, 18, 213, 91, 216, 63,
+	7, 40, 13, 53, 10, 73, 215, 63, 158, 234, 144, 155, 225, 6, 214, 63,
+	152, 191, 66, 230, 202, 160, 192, 63, 212, 157, 39, 158, 179, 5, 215, 63,
+	71, 33, 201, 172, 222, 225, 215, 63, 117, 171, 231, 164, 247, 13, 226, 63,
+	214, 83, 171, 175, 174, 10, 219, 63, 51, 24, 35, 18, 133, 150, 223, 63,
+	61, 238, 91, 173, 19, 151, 213, 63, 5, 221, 94, 210, 24, 173, 225, 63,
+	26, 225, 237, 65, 8, 200, 219, 63, 155, 146, 172, 195, 209, 85, 206, 63,
+	2, 73, 216, 183, 147, 8, 224, 63, 242, 150, 171, 31, 155, 228, 221, 63,
+	15, 156, 51, 162, 180, 55, 222, 63, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	89, 84, 55, 86, 88, 87, 67, 99, 90, 75, 69, 107, 72, 85, 77, 71,
+	83, 78, 95, 46, 51, 53, 50, 76, 104, 49, 70, 44, 63, 102, 47, 74,
+	106, 33, 73, 105, 108, 109, 110, 114, 115, 116, 117, 118, 119, 120, 121, 122,
+	48, 52, 54, 57, 64, 65, 68, 79, 80, 81, 82, 97, 98, 100, 101, 103,
+	111, 112, 113, 56, 66, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 231, 199, 95, 90, 212, 39, 207, 63,
+	229, 71, 252, 138, 53, 92, 194, 63, 53, 171, 136, 228, 117, 14, 181, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	182, 189, 221, 146, 28, 176, 197, 63, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 64, 0, 0, 0, 0, 0, 0, 240, 63,
+	69, 216, 240, 244, 74, 25, 32, 64, 0, 0, 0, 0, 0, 0, 240, 63,
+	0, 0, 0, 0, 0, 0, 240, 63, 0, 0, 0, 0, 0, 0, 240, 63,
+	0, 0, 0, 0, 0, 0, 240, 63, 0, 0, 0, 0, 0, 0, 240, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 10, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 231, 199, 95, 90, 212, 39, 207, 63,
+	229, 71, 252, 138, 53, 92, 194, 63, 53, 171, 136, 228, 117, 14, 181, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	182, 189, 221, 146, 28, 176, 197, 63, 234, 14, 24, 218, 239, 63, 176, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 240, 63,
+	69, 216, 240, 244, 74, 25, 32, 64, 0, 0, 0, 0, 0, 0, 240, 63,
+	0, 0, 0, 0, 0, 0, 240, 63, 0, 0, 0, 0, 0, 0, 240, 63,
+	0, 0, 0, 0, 0, 0, 240, 63, 0, 0, 0, 0, 0, 0, 240, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 7, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 231, 199, 95, 90, 212, 39, 207, 63,
+	229, 71, 252, 138, 53, 92, 194, 63, 244, 134, 251, 200, 173, 73, 191, 63,
+	152, 166, 8, 112, 122, 23, 199, 63, 242, 235, 135, 216, 96, 225, 202, 63,
+	84, 229, 123, 70, 34, 52, 198, 63, 219, 138, 253, 101, 247, 228, 197, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 240, 63,
+	241, 157, 152, 245, 98, 40, 249, 63, 0, 0, 0, 0, 0, 0, 240, 63,
+	0, 0, 0, 0, 0, 0, 240, 63, 0, 0, 0, 0, 0, 0, 240, 63,
+	0, 0, 0, 0, 0, 0, 240, 63, 0, 0, 0, 0, 0, 0, 240, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 6, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 231, 199, 95, 90, 212, 39, 207, 63,
+	35, 249, 74, 32, 37, 118, 233, 63, 244, 134, 251, 200, 173, 73, 191, 63,
+	152, 166, 8, 112, 122, 23, 199, 63, 242, 235, 135, 216, 96, 225, 202, 63,
+	84, 229, 123, 70, 34, 52, 198, 63, 219, 138, 253, 101, 247, 228, 197, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 217, 37, 170, 183, 6, 182, 220, 63,
+	241, 157, 152, 245, 98, 40, 249, 63, 71, 58, 3, 35, 47, 107, 231, 63,
+	248, 80, 162, 37, 143, 39, 225, 63, 28, 8, 201, 2, 38, 112, 228, 63,
+	138, 60, 73, 186, 102, 242, 227, 63, 192, 32, 233, 211, 42, 250, 214, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 5, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 231, 199, 95, 90, 212, 39, 207, 63,
+	35, 249, 74, 32, 37, 118, 233, 63, 244, 134, 251, 200, 173, 73, 191, 63,
+	194, 47, 245, 243, 166, 34, 203, 63, 242, 235, 135, 216, 96, 225, 202, 63,
+	84, 229, 123, 70, 34, 52, 198, 63, 219, 138, 253, 101, 247, 228, 197, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 240, 136, 10, 213, 205, 197, 215, 63,
+	128, 159, 113, 225, 64, 200, 248, 63, 153, 186, 43, 187, 96, 112, 212, 63,
+	248, 80, 162, 37, 143, 39, 225, 63, 199, 213, 200, 174, 180, 140, 221, 63,
+	174, 102, 157, 241, 125, 113, 221, 63, 192, 32, 233, 211, 42, 250, 214, 63,
+	0, 0, 0, 0, 8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 148, 103, 94, 14, 187, 239, 214, 63,
+	32, 152, 163, 199, 239, 109, 243, 63, 204, 182, 211, 214, 136, 96, 219, 63,
+	152, 166, 8, 112, 122, 23, 199, 63, 11, 184, 231, 249, 211, 70, 205, 63,
+	1, 107, 213, 174, 9, 105, 223, 63, 100, 230, 2, 151, 199, 154, 205, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 217, 37, 170, 183, 6, 182, 220, 63,
+	241, 157, 152, 245, 98, 40, 249, 63, 71, 58, 3, 35, 47, 107, 231, 63,
+	154, 64, 17, 139, 24, 118, 222, 63, 28, 8, 201, 2, 38, 112, 228, 63,
+	138, 60, 73, 186, 102, 242, 227, 63, 36, 182, 187, 7, 232, 190, 209, 63,
+	8, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 139, 22, 160, 109, 53, 235, 214, 63,
+	229, 71, 252, 138, 53, 92, 194, 63, 18, 251, 4, 80, 140, 44, 209, 63,
+	127, 77, 214, 168, 135, 104, 206, 63, 231, 224, 153, 208, 36, 177, 213, 63,
+	4, 3, 8, 31, 74, 180, 208, 63, 49, 148, 19, 237, 42, 164, 215, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 240, 63,
+	15, 127, 77, 214, 168, 135, 247, 63, 0, 0, 0, 0, 0, 0, 240, 63,
+	0, 0, 0, 0, 0, 0, 240, 63, 0, 0, 0, 0, 0, 0, 240, 63,
+	0, 0, 0, 0, 0, 0, 240, 63, 0, 0, 0, 0, 0, 0, 240, 63,
+	12, 0, 0, 0, 8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 57, 124, 210, 137, 4, 83, 207, 63,
+	202, 253, 14, 69, 129, 62, 249, 63, 53, 171, 136, 228, 117, 14, 181, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	182, 189, 221, 146, 28, 176, 197, 63, 234, 14, 24, 218, 239, 63, 176, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 240, 63,
+	69, 216, 240, 244, 74, 25, 32, 64, 0, 0, 0, 0, 0, 0, 240, 63,
+	0, 0, 0, 0, 0, 0, 240, 63, 0, 0, 0, 0, 0, 0, 240, 63,
+	0, 0, 0, 0, 0, 0, 240, 63, 0, 0, 0, 0, 0, 0, 240, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 8, 0, 0, 0, 9, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 190, 17, 221, 179, 174, 209, 210, 63,
+	202, 253, 14, 69, 129, 62, 249, 63, 86, 129, 90, 12, 30, 166, 205, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 100, 62, 32, 208, 153, 180, 203, 63,
+	142, 206, 249, 41, 142, 3, 203, 63, 239, 75, 71, 74, 196, 165, 176, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 171, 179, 90, 96, 143, 9, 228, 63,
+	218, 3, 173, 192, 144, 85, 252, 63, 92, 84, 139, 136, 98, 242, 226, 63,
+	236, 246, 89, 101, 166, 180, 238, 63, 172, 228, 99, 119, 129, 18, 229, 63,
+	52, 74, 151, 254, 37, 169, 232, 63, 197, 143, 49, 119, 45, 33, 222, 63,
+	20, 0, 0, 0, 8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 57, 124, 210, 137, 4, 83, 207, 63,
+	252, 222, 166, 63, 251, 145, 254, 63, 53, 171, 136, 228, 117, 14, 181, 63,
+	88, 174, 183, 205, 84, 136, 220, 63, 0, 0, 0, 0, 0, 0, 0, 0,
+	182, 189, 221, 146, 28, 176, 197, 63, 234, 14, 24, 218, 239, 63, 176, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 240, 63,
+	69, 216, 240, 244, 74, 25, 32, 64, 0, 0, 0, 0, 0, 0, 240, 63,
+	0, 0, 0, 0, 0, 0, 240, 63, 0, 0, 0, 0, 0, 0, 240, 63,
+	0, 0, 0, 0, 0, 0, 240, 63, 0, 0, 0, 0, 0, 0, 240, 63,
+	28, 0, 0, 0, 8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 134, 113, 55, 136, 214, 138, 211, 63,
+	116, 122, 222, 141, 5, 133, 230, 63, 123, 18, 216, 156, 131, 103, 192, 63,
+	33, 88, 85, 47, 191, 211, 202, 63, 181, 110, 131, 218, 111, 237, 202, 63,
+	36, 37, 61, 12, 173, 78, 206, 63, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 64, 0, 0, 0, 0, 0, 0, 240, 63,
+	31, 75, 31, 186, 160, 14, 32, 64, 0, 0, 0, 0, 0, 0, 240, 63,
+	0, 0, 0, 0, 0, 0, 240, 63, 0, 0, 0, 0, 0, 0, 240, 63,
+	0, 0, 0, 0, 0, 0, 240, 63, 0, 0, 0, 0, 0, 0, 240, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 11, 0, 0, 0, 14, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 134, 113, 55, 136, 214, 138, 211, 63,
+	116, 122, 222, 141, 5, 133, 230, 63, 153, 213, 59, 220, 14, 13, 193, 63,
+	33, 88, 85, 47, 191, 211, 202, 63, 181, 110, 131, 218, 111, 237, 202, 63,
+	11, 124, 69, 183, 94, 211, 211, 63, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 240, 63, 0, 0, 0, 0, 0, 0, 240, 63,
+	31, 75, 31, 186, 160, 14, 32, 64, 0, 0, 0, 0, 0, 0, 240, 63,
+	0, 0, 0, 0, 0, 0, 240, 63, 0, 0, 0, 0, 0, 0, 240, 63,
+	0, 0, 0, 0, 0, 0, 240, 63, 0, 0, 0, 0, 0, 0, 240, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 12, 0, 0, 0, 13, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 155, 88, 224, 43, 186, 245, 213, 63,
+	116, 122, 222, 141, 5, 133, 230, 63, 225, 10, 40, 212, 211, 71, 196, 63,
+	33, 88, 85, 47, 191, 211, 202, 63, 249, 158, 145, 8, 141, 96, 214, 63,
+	30, 224, 73, 11, 151, 85, 213, 63, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 240, 63,
+	31, 75, 31, 186, 160, 14, 32, 64, 0, 0, 0, 0, 0, 0, 240, 63,
+	0, 0, 0, 0, 0, 0, 240, 63, 0, 0, 0, 0, 0, 0, 240, 63,
+	0, 0, 0, 0, 0, 0, 240, 63, 0, 0, 0, 0, 0, 0, 240, 63,
+	36, 0, 0, 0, 8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 134, 113, 55, 136, 214, 138, 211, 63,
+	101, 57, 9, 165, 47, 4, 232, 63, 153, 213, 59, 220, 14, 13, 193, 63,
+	10, 162, 238, 3, 144, 218, 213, 63, 181, 110, 131, 218, 111, 237, 202, 63,
+	11, 124, 69, 183, 94, 211, 211, 63, 220, 73, 68, 248, 23, 65, 199, 63,
+	0, 0, 0, 0, 0, 0, 240, 63, 136, 213, 31, 97, 24, 176, 220, 63,
+	16, 64, 106, 19, 39, 247, 247, 63, 188, 87, 173, 76, 248, 37, 226, 63,
+	22, 133, 93, 20, 61, 240, 226, 63, 98, 187, 123, 128, 238, 203, 223, 63,
+	211, 45, 59, 196, 63, 236, 226, 63, 69, 157, 185, 135, 132, 239, 223, 63,
+	44, 0, 0, 0, 8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 240, 63, 224, 44, 37, 203, 73, 40, 213, 63,
+	202, 84, 193, 168, 164, 78, 240, 63, 123, 18, 216, 156, 131, 103, 192, 63,
+	107, 184, 200, 61, 93, 221, 205, 63, 189, 252, 78, 147, 25, 111, 205, 63,
+	36, 37, 61, 12, 173, 78, 206, 63, 152, 191, 66, 230, 202, 160, 192, 63,
+	0, 0, 0, 0, 0, 0, 0, 64, 231, 54, 225, 94, 153, 183, 224, 63,
+	253, 19, 92, 172, 168, 65, 249, 63, 85, 22, 133, 93, 20, 61, 227, 63,
+	136, 213, 31, 97, 24, 176, 227, 63, 166, 213, 144, 184, 199, 82, 227, 63,
+	100, 58, 116, 122, 222, 13, 225, 63, 117, 171, 231, 164, 247, 13, 226, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 15, 0, 0, 0, 16, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 240, 63, 224, 44, 37, 203, 73, 40, 213, 63,
+	202, 84, 193, 168, 164, 78, 240, 63, 123, 18, 216, 156, 131, 103, 192, 63,
+	147, 26, 218, 0, 108, 64, 209, 63, 125, 236, 46, 80, 82, 96, 209, 63,
+	49, 238, 6, 209, 90, 209, 208, 63, 152, 191, 66, 230, 202, 160, 192, 63,
+	0, 0, 0, 0, 0, 0, 240, 63, 231, 54, 225, 94, 153, 183, 224, 63,
+	61, 68, 163, 59, 136, 157, 248, 63, 158, 149, 180, 226, 27, 10, 226, 63,
+	136, 213, 31, 97, 24, 176, 227, 63, 38, 225, 66, 30, 193, 13, 225, 63,
+	114, 195, 239, 166, 91, 246, 224, 63, 117, 171, 231, 164, 247, 13, 226, 63,
+	52, 0, 0, 0, 8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 240, 63, 247, 88, 250, 208, 5, 245, 218, 63,
+	202, 108, 144, 73, 70, 206, 241, 63, 5, 51, 166, 96, 141, 179, 203, 63,
+	107, 184, 200, 61, 93, 221, 205, 63, 189, 252, 78, 147, 25, 111, 205, 63,
+	36, 37, 61, 12, 173, 78, 206, 63, 155, 146, 172, 195, 209, 85, 206, 63,
+	0, 0, 0, 0, 0, 0, 0, 64, 45, 209, 89, 102, 17, 138, 224, 63,
+	253, 19, 92, 172, 168, 65, 249, 63, 85, 22, 133, 93, 20, 61, 227, 63,
+	0, 3, 65, 128, 12, 157, 225, 63, 166, 213, 144, 184, 199, 82, 227, 63,
+	100, 58, 116, 122, 222, 13, 225, 63, 5, 221, 94, 210, 24, 173, 225, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 17, 0, 0, 0, 18, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 240, 63, 247, 88, 250, 208, 5, 245, 218, 63,
+	202, 108, 144, 73, 70, 206, 241, 63, 110, 251, 30, 245, 215, 43, 208, 63,
+	107, 184, 200, 61, 93, 221, 205, 63, 189, 252, 78, 147, 25, 111, 205, 63,
+	225, 123, 127, 131, 246, 234, 215, 63, 61, 238, 91, 173, 19, 151, 213, 63,
+	0, 0, 0, 0, 0, 0, 240, 63, 68, 76, 137, 36, 122, 25, 222, 63,
+	253, 19, 92, 172, 168, 65, 249, 63, 176, 58, 114, 164, 51, 48, 221, 63,
+	0, 3, 65, 128, 12, 157, 225, 63, 232, 246, 146, 198, 104, 29, 225, 63,
+	234, 236, 100, 112, 148, 60, 224, 63, 5, 221, 94, 210, 24, 173, 225, 63,
+	60, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 240, 63, 62, 179, 36, 64, 77, 45, 219, 63,
+	106, 193, 139, 190, 130, 52, 242, 63, 5, 51, 166, 96, 141, 179, 203, 63,
+	208, 185, 219, 245, 210, 20, 219, 63, 27, 99, 39, 188, 4, 167, 219, 63,
+	36, 37, 61, 12, 173, 78, 206, 63, 155, 146, 172, 195, 209, 85, 206, 63,
+	0, 0, 0, 0, 0, 0, 0, 64, 45, 209, 89, 102, 17, 138, 224, 63,
+	210, 169, 43, 159, 229, 249, 248, 63, 85, 22, 133, 93, 20, 61, 227, 63,
+	98, 15, 237, 99, 5, 191, 223, 63, 166, 213, 144, 184, 199, 82, 227, 63,
+	100, 58, 116, 122, 222, 13, 225, 63, 2, 73, 216, 183, 147, 8, 224, 63,
+	64, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	33, 44, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 63, 64,
+	65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80,
+	81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 95, 97, 98, 99, 100, 101,
+	102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117,
+	118, 119, 120, 121, 122, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 192, 3, 0, 0, 192, 3, 0, 0, 192, 3, 0, 0, 192, 3, 0,
+	0, 192, 3, 0, 0, 192, 3, 0, 0, 192, 3, 0, 0, 192, 3, 0,
+	0, 192, 3, 0, 0, 192, 3, 0, 0, 192, 3, 0, 0, 192, 3, 0,
+	0, 192, 3, 0, 0, 192, 3, 0, 0, 192, 3, 0, 0, 192, 3, 0,
+	0, 192, 3, 0, 0, 192, 3, 0, 0, 192, 3, 0, 0, 192, 3, 0,
+	0, 192, 3, 0, 0, 192, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 192, 3, 0, 0, 192, 3, 0,
+	0, 192, 3, 0, 0, 192, 3, 0, 0, 192, 3, 0, 0, 192, 3, 0,
+	0, 240, 255, 1, 0, 240, 255, 1, 0, 240, 255, 1, 0, 240, 255, 1,
+	0, 240, 255, 1, 0, 240, 255, 1, 0, 240, 255, 1, 0, 240, 255, 1,
+	0, 240, 255, 1, 0, 240, 255, 1, 0, 240, 255, 1, 0, 240, 255, 1,
+	0, 240, 255, 0, 0, 240, 255, 0, 0, 248, 127, 0, 0, 248, 127, 0,
+	0, 252, 63, 0, 0, 252, 63, 0, 0, 252, 63, 0, 0, 252, 31, 0,
+	0, 254, 15, 0, 0, 254, 15, 0, 0, 254, 7, 0, 0, 255, 7, 0,
+	0, 255, 3, 0, 0, 255, 3, 0, 0, 255, 1, 0, 128, 255, 1, 0,
+	128, 255, 0, 0, 128, 255, 0, 0, 128, 255, 0, 0, 192, 63, 0, 0,
+	240, 255, 255, 31, 240, 255, 255, 31, 240, 255, 255, 31, 240, 255, 255, 31,
+	240, 255, 255, 31, 240, 255, 255, 31, 240, 255, 255, 31, 240, 255, 255, 31,
+	240, 255, 255, 31, 240, 255, 255, 31, 240, 255, 255, 31, 240, 255, 255, 31,
+	240, 255, 255, 31, 240, 255, 255, 31, 240, 255, 255, 31, 240, 255, 255, 31,
+	240, 255, 255, 31, 240, 255, 255, 31, 240, 255, 255, 31, 240, 255, 255, 31,
+	240, 255, 255, 31, 240, 255, 255, 31, 240, 255, 255, 31, 240, 255, 255, 31,
+	240, 255, 255, 31, 240, 255, 255, 31, 240, 255, 255, 31, 240, 255, 255, 31,
+	240, 255, 255, 31, 240, 255, 255, 31, 240, 255, 255, 31, 240, 255, 255, 31,
+	0, 0, 120, 0, 0, 0, 120, 0, 0, 0, 56, 0, 0, 0, 60, 0,
+	0, 0, 28, 0, 0, 0, 28, 0, 0, 0, 30, 0, 0, 0, 14, 0,
+	0, 0, 14, 0, 0, 0, 15, 0, 0, 0, 15, 0, 0, 0, 7, 0,
+	0, 0, 7, 0, 0, 128, 7, 0, 0, 128, 3, 0, 0, 128, 3, 0,
+	0, 192, 3, 0, 0, 192, 3, 0, 0, 192, 1, 0, 0, 192, 1, 0,
+	0, 224, 0, 0, 0, 224, 0, 0, 0, 224, 0, 0, 0, 240, 0, 0,
+	0, 112, 0, 0, 0, 112, 0, 0, 0, 120, 0, 0, 0, 56, 0, 0,
+	0, 56, 0, 0, 0, 60, 0, 0, 0, 60, 0, 0, 0, 28, 0, 0,
+	0, 240, 15, 0, 0, 248, 63, 0, 0, 254, 127, 0, 0, 254, 127, 0,
+	0, 31, 248, 0, 128, 15, 240, 1, 128, 7, 224, 1, 192, 7, 224, 3,
+	192, 3, 192, 3, 192, 3, 192, 3, 192, 3, 192, 3, 192, 3, 192, 7,
+	224, 3, 192, 7, 224, 3, 128, 7, 224, 1, 128, 7, 224, 1, 128, 7,
+	224, 1, 128, 7, 224, 1, 128, 7, 224, 3, 128, 7, 224, 3, 128, 7,
+	224, 3, 192, 7, 192, 3, 192, 7, 192, 3, 192, 3, 192, 3, 192, 3,
+	192, 3, 192, 3, 128, 7, 224, 1, 128, 15, 224, 1, 128, 15, 240, 0,
+	0, 63, 252, 0, 0, 254, 127, 0, 0, 252, 63, 0, 0, 240, 15, 0,
+	0, 240, 7, 0, 128, 255, 7, 0, 192, 255, 7, 0, 192, 255, 7, 0,
+	192, 255, 7, 0, 192, 193, 7, 0, 0, 192, 7, 0, 0, 192, 7, 0,
+	0, 192, 7, 0, 0, 192, 7, 0, 0, 192, 7, 0, 0, 192, 7, 0,
+	0, 192, 7, 0, 0, 192, 7, 0, 0, 192, 7, 0, 0, 192, 7, 0,
+	0, 192, 7, 0, 0, 192, 7, 0, 0, 192, 7, 0, 0, 192, 7, 0,
+	0, 192, 7, 0, 0, 192, 7, 0, 0, 192, 7, 0, 0, 192, 7, 0,
+	0, 192, 7, 0, 0, 192, 7, 0, 0, 192, 7, 0, 0, 192, 7, 0,
+	0, 192, 7, 0, 128, 255, 255, 3, 128, 255, 255, 3, 128, 255, 255, 3,
+	0, 248, 7, 0, 0, 255, 31, 0, 192, 255, 127, 0, 192, 255, 255, 0,
+	192, 7, 248, 1, 192, 0, 240, 1, 0, 0, 224, 3, 0, 0, 224, 3,
+	0, 0, 192, 3, 0, 0, 192, 3, 0, 0, 192, 3, 0, 0, 224, 3,
+	0, 0, 224, 1, 0, 0, 240, 1, 0, 0, 240, 1, 0, 0, 248, 0,
+	0, 0, 124, 0, 0, 0, 62, 0, 0, 0, 31, 0, 0, 128, 15, 0,
+	0, 192, 7, 0, 0, 224, 3, 0, 0, 224, 3, 0, 0, 248, 1, 0,
+	0, 252, 0, 0, 0, 126, 0, 0, 0, 63, 0, 0, 128, 31, 0, 0,
+	128, 15, 0, 0, 192, 255, 255, 3, 192, 255, 255, 3, 192, 255, 255, 3,
+	0, 252, 7, 0, 128, 255, 63, 0, 128, 255, 127, 0, 128, 255, 255, 0,
+	128, 1, 248, 0, 0, 0, 240, 1, 0, 0, 224, 1, 0, 0, 224, 1,
+	0, 0, 224, 1, 0, 0, 224, 1, 0, 0, 224, 1, 0, 0, 224, 0,
+	0, 0, 248, 0, 0, 248, 127, 0, 0, 248, 31, 0, 0, 248, 63, 0,
+	0, 240, 255, 0, 0, 0, 248, 0, 0, 0, 240, 1, 0, 0, 224, 3,
+	0, 0, 192, 3, 0, 0, 192, 3, 0, 0, 192, 3, 0, 0, 192, 3,
+	0, 0, 192, 3, 0, 0, 224, 3, 0, 0, 224, 3, 64, 0, 240, 1,
+	192, 3, 252, 0, 192, 255, 127, 0, 192, 255, 63, 0, 0, 255, 15, 0,
+	0, 0, 126, 0, 0, 0, 126, 0, 0, 0, 127, 0, 0, 128, 127, 0,
+	0, 128, 127, 0, 0, 192, 123, 0, 0, 192, 121, 0, 0, 224, 121, 0,
+	0, 240, 120, 0, 0, 112, 120, 0, 0, 120, 120, 0, 0, 60, 120, 0,
+	0, 60, 120, 0, 0, 30, 120, 0, 0, 31, 120, 0, 0, 15, 120, 0,
+	128, 7, 120, 0, 128, 7, 120, 0, 192, 3, 120, 0, 224, 1, 120, 0,
+	224, 1, 120, 0, 224, 255, 255, 15, 224, 255, 255, 15, 224, 255, 255, 15,
+	224, 255, 255, 15, 0, 0, 120, 0, 0, 0, 120, 0, 0, 0, 120, 0,
+	0, 0, 120, 0, 0, 0, 120, 0, 0, 0, 120, 0, 0, 0, 120, 0,
+	128, 255, 255, 0, 128, 255, 255, 0, 128, 255, 255, 0, 128, 255, 255, 0,
+	128, 7, 0, 0, 128, 7, 0, 0, 128, 7, 0, 0, 128, 7, 0, 0,
+	128, 7, 0, 0, 128, 7, 0, 0, 128, 7, 0, 0, 128, 255, 7, 0,
+	128, 255, 31, 0, 128, 255, 127, 0, 128, 255, 255, 0, 128, 1, 248, 0,
+	0, 0, 240, 1, 0, 0, 224, 3, 0, 0, 224, 3, 0, 0, 192, 3,
+	0, 0, 192, 3, 0, 0, 192, 3, 0, 0, 192, 3, 0, 0, 192, 3,
+	0, 0, 192, 3, 0, 0, 224, 3, 0, 0, 240, 1, 64, 0, 248, 1,
+	192, 3, 254, 0, 192, 255, 127, 0, 192, 255, 63, 0, 0, 255, 15, 0,
+	0, 192, 127, 0, 0, 240, 255, 1, 0, 248, 255, 1, 0, 252, 255, 1,
+	0, 62, 128, 1, 0, 31, 0, 0, 0, 15, 0, 0, 128, 7, 0, 0,
+	128, 7, 0, 0, 192, 3, 0, 0, 192, 3, 0, 0, 192, 131, 7, 0,
+	224, 243, 63, 0, 224, 251, 255, 0, 224, 255, 255, 0, 224, 31, 240, 1,
+	224, 15, 224, 3, 224, 7, 192, 3, 224, 7, 192, 3, 224, 7, 192, 7,
+	224, 3, 128, 7, 192, 3, 128, 7, 192, 3, 128, 7, 192, 3, 128, 7,
+	192, 7, 192, 7, 128, 7, 192, 3, 128, 15, 192, 3, 0, 15, 224, 1,
+	0, 62, 248, 1, 0, 254, 255, 0, 0, 248, 127, 0, 0, 240, 31, 0,
+	192, 255, 255, 7, 192, 255, 255, 7, 192, 255, 255, 7, 192, 255, 255, 3,
+	0, 0, 224, 3, 0, 0, 240, 1, 0, 0, 240, 1, 0, 0, 240, 0,
+	0, 0, 248, 0, 0, 0, 248, 0, 0, 0, 120, 0, 0, 0, 124, 0,
+	0, 0, 124, 0, 0, 0, 62, 0, 0, 0, 62, 0, 0, 0, 31, 0,
+	0, 0, 31, 0, 0, 0, 31, 0, 0, 128, 15, 0, 0, 128, 15, 0,
+	0, 128, 7, 0, 0, 192, 7, 0, 0, 192, 7, 0, 0, 224, 3, 0,
+	0, 224, 3, 0, 0, 224, 1, 0, 0, 240, 1, 0, 0, 240, 1, 0,
+	0, 240, 0, 0, 0, 248, 0, 0, 0, 248, 0, 0, 0, 124, 0, 0,
+	0, 240, 31, 0, 0, 252, 63, 0, 0, 254, 255, 0, 0, 255, 255, 0,
+	128, 15, 240, 1, 128, 7, 224, 3, 192, 7, 192, 3, 192, 3, 192, 3,
+	192, 3, 192, 3, 192, 7, 192, 3, 192, 7, 192, 3, 128, 7, 224, 1,
+	0, 15, 240, 1, 0, 127, 252, 0, 0, 252, 63, 0, 0, 252, 63, 0,
+	0, 254, 255, 0, 0, 63, 248, 1, 128, 15, 224, 3, 192, 7, 192, 3,
+	192, 3, 192, 7, 224, 3, 128, 7, 224, 3, 128, 7, 224, 3, 128, 7,
+	224, 3, 192, 7, 224, 3, 192, 7, 192, 7, 192, 3, 192, 7, 224, 3,
+	128, 31, 248, 1, 0, 255, 255, 0, 0, 254, 127, 0, 0, 248, 31, 0,
+	0, 240, 7, 0, 0, 252, 31, 0, 0, 254, 127, 0, 0, 255, 255, 0,
+	128, 15, 248, 0, 192, 7, 240, 1, 192, 3, 224, 1, 192, 3, 224, 3,
+	224, 3, 192, 3, 224, 3, 192, 3, 224, 3, 192, 3, 224, 3, 192, 7,
+	224, 3, 192, 7, 224, 3, 224, 7, 192, 3, 224, 7, 192, 7, 240, 7,
+	128, 15, 240, 7, 128, 31, 252, 7, 0, 255, 255, 7, 0, 252, 223, 7,
+	0, 248, 199, 7, 0, 0, 192, 3, 0, 0, 192, 3, 0, 0, 192, 3,
+	0, 0, 224, 1, 0, 0, 224, 1, 0, 0, 240, 0, 0, 0, 248, 0,
+	128, 7, 126, 0, 128, 255, 63, 0, 128, 255, 15, 0, 0, 254, 3, 0,
+	0, 240, 15, 0, 0, 254, 31, 0, 0, 255, 127, 0, 0, 255, 127, 0,
+	0, 7, 248, 0, 0, 1, 240, 0, 0, 0, 240, 1, 0, 0, 240, 1,
+	0, 0, 240, 1, 0, 0, 240, 0, 0, 0, 248, 0, 0, 0, 124, 0,
+	0, 0, 126, 0, 0, 0, 63, 0, 0, 128, 31, 0, 0, 128, 15, 0,
+	0, 192, 3, 0, 0, 224, 3, 0, 0, 224, 1, 0, 0, 224, 1, 0,
+	0, 224, 1, 0, 0, 224, 1, 0, 0, 224, 1, 0, 0, 224, 1, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 224, 1, 0,
+	0, 224, 1, 0, 0, 224, 1, 0, 0, 224, 1, 0, 0, 224, 1, 0,
+	0, 224, 31, 0, 0, 252, 127, 0, 0, 255, 255, 1, 128, 31, 240, 7,
+	224, 3, 128, 7, 240, 0, 0, 14, 112, 0, 0, 28, 56, 0, 0, 56,
+	28, 224, 3, 120, 28, 240, 239, 112, 14, 248, 255, 112, 14, 60, 252, 224,
+	6, 30, 240, 224, 7, 14, 240, 224, 7, 14, 224, 224, 7, 14, 224, 224,
+	7, 14, 224, 224, 7, 14, 224, 224, 7, 14, 224, 112, 7, 14, 240, 112,
+	14, 30, 248, 60, 14, 124, 254, 31, 30, 248, 255, 15, 28, 240, 231, 3,
+	56, 0, 0, 0, 120, 0, 0, 0, 240, 0, 0, 0, 224, 1, 0, 3,
+	192, 7, 224, 3, 128, 255, 255, 1, 0, 254, 127, 0, 0, 240, 31, 0,
+	0, 224, 7, 0, 0, 224, 7, 0, 0, 224, 7, 0, 0, 240, 15, 0,
+	0, 240, 15, 0, 0, 248, 31, 0, 0, 120, 30, 0, 0, 120, 30, 0,
+	0, 124, 62, 0, 0, 60, 60, 0, 0, 60, 124, 0, 0, 62, 124, 0,
+	0, 30, 120, 0, 0, 31, 248, 0, 0, 15, 240, 0, 0, 15, 240, 0,
+	128, 15, 240, 1, 128, 7, 224, 1, 192, 7, 224, 3, 192, 7, 224, 3,
+	192, 3, 192, 3, 224, 255, 255, 7, 224, 255, 255, 7, 224, 255, 255, 7,
+	240, 1, 128, 15, 240, 0, 0, 15, 248, 0, 0, 31, 248, 0, 0, 31,
+	120, 0, 0, 30, 124, 0, 0, 62, 124, 0, 0, 62, 62, 0, 0, 124,
+	224, 255, 15, 0, 224, 255, 63, 0, 224, 255, 255, 0, 224, 255, 255, 1,
+	224, 1, 240, 1, 224, 1, 224, 3, 224, 1, 192, 3, 224, 1, 192, 3,
+	224, 1, 192, 3, 224, 1, 192, 3, 224, 1, 192, 3, 224, 1, 224, 3,
+	224, 1, 240, 1, 224, 255, 255, 0, 224, 255, 127, 0, 224, 255, 127, 0,
+	224, 255, 255, 0, 224, 1, 248, 3, 224, 1, 224, 3, 224, 1, 192, 7,
+	224, 1, 128, 7, 224, 1, 128, 15, 224, 1, 128, 15, 224, 1, 128, 15,
+	224, 1, 128, 15, 224, 1, 128, 7, 224, 1, 192, 7, 224, 1, 224, 7,
+	224, 1, 248, 3, 224, 255, 255, 1, 224, 255, 255, 0, 224, 255, 63, 0,
+	0, 192, 255, 0, 0, 240, 255, 3, 0, 252, 255, 31, 0, 254, 255, 31,
+	0, 63, 0, 31, 128, 15, 0, 28, 192, 7, 0, 16, 224, 3, 0, 0,
+	224, 3, 0, 0, 240, 1, 0, 0, 240, 1, 0, 0, 240, 1, 0, 0,
+	240, 0, 0, 0, 248, 0, 0, 0, 248, 0, 0, 0, 248, 0, 0, 0,
+	248, 0, 0, 0, 248, 0, 0, 0, 248, 0, 0, 0, 240, 0, 0, 0,
+	240, 1, 0, 0, 240, 1, 0, 0, 240, 1, 0, 0, 224, 3, 0, 0,
+	224, 3, 0, 0, 192, 7, 0, 16, 192, 15, 0, 24, 128, 31, 0, 30,
+	0, 127, 128, 31, 0, 254, 255, 31, 0, 248, 255, 7, 0, 192, 255, 0,
+	252, 255, 1, 0, 252, 255, 31, 0, 252, 255, 127, 0, 252, 255, 255, 1,
+	124, 0, 252, 3, 124, 0, 240, 7, 124, 0, 192, 7, 124, 0, 128, 15,
+	124, 0, 128, 15, 124, 0, 0, 31, 124, 0, 0, 31, 124, 0, 0, 31,
+	124, 0, 0, 62, 124, 0, 0, 62, 124, 0, 0, 62, 124, 0, 0, 62,
+	124, 0, 0, 62, 124, 0, 0, 62, 124, 0, 0, 62, 124, 0, 0, 62,
+	124, 0, 0, 31, 124, 0, 0, 31, 124, 0, 0, 31, 124, 0, 128, 15,
+	124, 0, 128, 15, 124, 0, 192, 7, 124, 0, 224, 7, 124, 0, 248, 3,
+	124, 128, 255, 1, 252, 255, 255, 0, 252, 255, 63, 0, 252, 255, 7, 0,
+	192, 255, 255, 3, 192, 255, 255, 3, 192, 255, 255, 3, 192, 255, 255, 3,
+	192, 3, 0, 0, 192, 3, 0, 0, 192, 3, 0, 0, 192, 3, 0, 0,
+	192, 3, 0, 0, 192, 3, 0, 0, 192, 3, 0, 0, 192, 3, 0, 0,
+	192, 3, 0, 0, 192, 255, 255, 1, 192, 255, 255, 1, 192, 255, 255, 1,
+	192, 255, 255, 1, 192, 3, 0, 0, 192, 3, 0, 0, 192, 3, 0, 0,
+	192, 3, 0, 0, 192, 3, 0, 0, 192, 3, 0, 0, 192, 3, 0, 0,
+	192, 3, 0, 0, 192, 3, 0, 0, 192, 3, 0, 0, 192, 3, 0, 0,
+	192, 3, 0, 0, 192, 255, 255, 3, 192, 255, 255, 3, 192, 255, 255, 3,
+	128, 255, 255, 3, 128, 255, 255, 3, 128, 255, 255, 3, 128, 255, 255, 3,
+	128, 7, 0, 0, 128, 7, 0, 0, 128, 7, 0, 0, 128, 7, 0, 0,
+	128, 7, 0, 0, 128, 7, 0, 0, 128, 7, 0, 0, 128, 7, 0, 0,
+	128, 7, 0, 0, 128, 15, 0, 0, 128, 255, 255, 0, 128, 255, 255, 0,
+	128, 255, 255, 0, 128, 7, 0, 0, 128, 7, 0, 0, 128, 7, 0, 0,
+	128, 7, 0, 0, 128, 7, 0, 0, 128, 7, 0, 0, 128, 7, 0, 0,
+	128, 7, 0, 0, 128, 7, 0, 0, 128, 7, 0, 0, 128, 7, 0, 0,
+	128, 7, 0, 0, 128, 7, 0, 0, 128, 7, 0, 0, 128, 7, 0, 0,
+	0, 224, 127, 0, 0, 252, 255, 3, 0, 254, 255, 15, 0, 255, 255, 31,
+	128, 31, 0, 31, 192, 7, 0, 28, 224, 3, 0, 16, 240, 1, 0, 0,
+	240, 1, 0, 0, 248, 0, 0, 0, 248, 0, 0, 0, 248, 0, 0, 0,
+	120, 0, 0, 0, 124, 0, 0, 0, 124, 0, 0, 0, 124, 0, 248, 63,
+	124, 0, 248, 63, 124, 0, 248, 63, 124, 0, 248, 63, 124, 0, 0, 62,
+	248, 0, 0, 62, 248, 0, 0, 62, 248, 0, 0, 62, 240, 0, 0, 62,
+	240, 1, 0, 62, 224, 1, 0, 62, 224, 3, 0, 62, 192, 15, 0, 62,
+	128, 127, 128, 63, 0, 255, 255, 31, 0, 252, 255, 7, 0, 224, 255, 0,
+	240, 0, 0, 15, 240, 0, 0, 15, 240, 0, 0, 15, 240, 0, 0, 15,
+	240, 0, 0, 15, 240, 0, 0, 15, 240, 0, 0, 15, 240, 0, 0, 15,
+	240, 0, 0, 15, 240, 0, 0, 15, 240, 0, 0, 15, 240, 0, 0, 15,
+	240, 0, 0, 15, 240, 255, 255, 15, 240, 255, 255, 15, 240, 255, 255, 15,
+	240, 255, 255, 15, 240, 0, 0, 15, 240, 0, 0, 15, 240, 0, 0, 15,
+	240, 0, 0, 15, 240, 0, 0, 15, 240, 0, 0, 15, 240, 0, 0, 15,
+	240, 0, 0, 15, 240, 0, 0, 15, 240, 0, 0, 15, 240, 0, 0, 15,
+	240, 0, 0, 15, 240, 0, 0, 15, 240, 0, 0, 15, 240, 0, 0, 15,
+	0, 192, 3, 0, 0, 192, 3, 0, 0, 192, 3, 0, 0, 192, 3, 0,
+	0, 192, 3, 0, 0, 192, 3, 0, 0, 192, 3, 0, 0, 192, 3, 0,
+	0, 192, 3, 0, 0, 192, 3, 0, 0, 192, 3, 0, 0, 192, 3, 0,
+	0, 192, 3, 0, 0, 192, 3, 0, 0, 192, 3, 0, 0, 192, 3, 0,
+	0, 192, 3, 0, 0, 192, 3, 0, 0, 192, 3, 0, 0, 192, 3, 0,
+	0, 192, 3, 0, 0, 192, 3, 0, 0, 192, 3, 0, 0, 192, 3, 0,
+	0, 192, 3, 0, 0, 192, 3, 0, 0, 192, 3, 0, 0, 192, 3, 0,
+	0, 192, 3, 0, 0, 192, 3, 0, 0, 192, 3, 0, 0, 192, 3, 0,
+	0, 0, 14, 0, 0, 0, 14, 0, 0, 0, 14, 0, 0, 0, 14, 0,
+	0, 0, 14, 0, 0, 0, 14, 0, 0, 0, 14, 0, 0, 0, 14, 0,
+	0, 0, 14, 0, 0, 0, 14, 0, 0, 0, 14, 0, 0, 0, 14, 0,
+	0, 0, 14, 0, 0, 0, 14, 0, 0, 0, 14, 0, 0, 0, 14, 0,
+	0, 0, 14, 0, 0, 0, 14, 0, 0, 0, 14, 0, 0, 0, 14, 0,
+	0, 0, 14, 0, 0, 0, 14, 0, 0, 0, 14, 0, 0, 0, 14, 0,
+	0, 0, 14, 0, 0, 0, 14, 0, 0, 0, 14, 0, 0, 0, 15, 0,
+	0, 0, 15, 0, 0, 240, 7, 0, 0, 240, 3, 0, 0, 240, 1, 0,
+	248, 0, 192, 7, 248, 0, 224, 3, 248, 0, 240, 1, 248, 0, 248, 0,
+	248, 0, 124, 0, 248, 0, 62, 0, 248, 128, 31, 0, 248, 192, 15, 0,
+	248, 224, 7, 0, 248, 240, 3, 0, 248, 248, 1, 0, 248, 252, 0, 0,
+	248, 126, 0, 0, 248, 31, 0, 0, 248, 31, 0, 0, 248, 15, 0, 0,
+	248, 31, 0, 0, 248, 63, 0, 0, 248, 124, 0, 0, 248, 248, 0, 0,
+	248, 240, 1, 0, 248, 240, 3, 0, 248, 192, 7, 0, 248, 128, 15, 0,
+	248, 128, 31, 0, 248, 0, 63, 0, 248, 0, 124, 0, 248, 0, 248, 0,
+	248, 0, 248, 1, 248, 0, 240, 3, 248, 0, 224, 7, 248, 0, 192, 31,
+	192, 7, 0, 0, 192, 7, 0, 0, 192, 7, 0, 0, 192, 7, 0, 0,
+	192, 7, 0, 0, 192, 7, 0, 0, 192, 7, 0, 0, 192, 7, 0, 0,
+	192, 7, 0, 0, 192, 7, 0, 0, 192, 7, 0, 0, 192, 7, 0, 0,
+	192, 7, 0, 0, 192, 7, 0, 0, 192, 7, 0, 0, 192, 7, 0, 0,
+	192, 7, 0, 0, 192, 7, 0, 0, 192, 7, 0, 0, 192, 7, 0, 0,
+	192, 7, 0, 0, 192, 7, 0, 0, 192, 7, 0, 0, 192, 7, 0, 0,
+	192, 7, 0, 0, 192, 7, 0, 0, 192, 7, 0, 0, 192, 7, 0, 0,
+	192, 7, 0, 0, 192, 255, 255, 3, 192, 255, 255, 3, 192, 255, 255, 3,
+	254, 0, 0, 127, 254, 1, 0, 127, 254, 1, 128, 127, 254, 1, 128, 127,
+	254, 3, 128, 127, 254, 3, 192, 127, 190, 3, 192, 127, 190, 7, 224, 125,
+	190, 7, 224, 125, 62, 15, 224, 125, 62, 15, 240, 124, 62, 15, 240, 124,
+	62, 30, 240, 124, 62, 30, 120, 124, 62, 28, 120, 124, 62, 60, 56, 124,
+	62, 60, 60, 124, 62, 120, 60, 124, 62, 120, 30, 124, 62, 120, 30, 124,
+	62, 240, 14, 124, 62, 240, 15, 124, 62, 224, 15, 124, 62, 224, 7, 124,
+	62, 224, 7, 124, 62, 192, 7, 124, 62, 0, 0, 124, 62, 0, 0, 124,
+	62, 0, 0, 124, 62, 0, 0, 124, 62, 0, 0, 124, 62, 0, 0, 124,
+	240, 3, 0, 15, 240, 7, 0, 15, 240, 7, 0, 15, 240, 15, 0, 15,
+	240, 15, 0, 15, 240, 31, 0, 15, 240, 30, 0, 15, 240, 62, 0, 15,
+	240, 60, 0, 15, 240, 124, 0, 15, 240, 120, 0, 15, 240, 248, 0, 15,
+	240, 240, 0, 15, 240, 240, 1, 15, 240, 224, 3, 15, 240, 224, 3, 15,
+	240, 192, 7, 15, 240, 192, 7, 15, 240, 128, 7, 15, 240, 128, 15, 15,
+	240, 0, 15, 15, 240, 0, 30, 15, 240, 0, 62, 15, 240, 0, 60, 15,
+	240, 0, 124, 15, 240, 0, 120, 15, 240, 0, 248, 15, 240, 0, 240, 15,
+	240, 0, 240, 15, 240, 0, 224, 15, 240, 0, 224, 15, 240, 0, 192, 15,
+	0, 248, 31, 0, 0, 254, 127, 0, 0, 255, 255, 0, 128, 255, 255, 1,
+	192, 15, 224, 7, 224, 3, 192, 15, 240, 1, 128, 15, 240, 0, 0, 31,
+	248, 0, 0, 31, 120, 0, 0, 62, 124, 0, 0, 62, 124, 0, 0, 62,
+	124, 0, 0, 60, 62, 0, 0, 124, 62, 0, 0, 124, 62, 0, 0, 124,
+	62, 0, 0, 124, 62, 0, 0, 124, 62, 0, 0, 124, 60, 0, 0, 124,
+	124, 0, 0, 62, 124, 0, 0, 62, 124, 0, 0, 62, 248, 0, 0, 31,
+	248, 0, 0, 31, 240, 1, 128, 15, 240, 3, 192, 15, 224, 7, 224, 7,
+	192, 31, 248, 3, 128, 255, 255, 1, 0, 254, 127, 0, 0, 248, 31, 0,
+	192, 255, 15, 0, 192, 255, 63, 0, 192, 255, 127, 0, 192, 255, 255, 0,
+	192, 3, 248, 1, 192, 3, 240, 3, 192, 3, 224, 3, 192, 3, 192, 7,
+	192, 3, 192, 7, 192, 3, 192, 7, 192, 3, 192, 7, 192, 3, 192, 7,
+	192, 3, 224, 7, 192, 3, 224, 3, 192, 3, 240, 3, 192, 3, 252, 1,
+	192, 255, 255, 0, 192, 255, 127, 0, 192, 255, 31, 0, 192, 255, 3, 0,
+	192, 3, 0, 0, 192, 3, 0, 0, 192, 3, 0, 0, 192, 3, 0, 0,
+	192, 3, 0, 0, 192, 3, 0, 0, 192, 3, 0, 0, 192, 3, 0, 0,
+	192, 3, 0, 0, 192, 3, 0, 0, 192, 3, 0, 0, 192, 3, 0, 0,
+	0, 240, 15, 0, 0, 252, 63, 0, 0, 254, 127, 0, 0, 31, 248, 1,
+	128, 7, 224, 3, 192, 3, 192, 3, 224, 3, 128, 7, 224, 1, 128, 7,
+	240, 0, 0, 15, 240, 0, 0, 15, 240, 0, 0, 15, 248, 0, 0, 30,
+	248, 0, 0, 30, 248, 0, 0, 30, 120, 0, 0, 30, 248, 0, 0, 30,
+	248, 0, 0, 30, 240, 0, 0, 15, 240, 0, 0, 15, 240, 0, 0, 15,
+	224, 1, 128, 15, 224, 1, 128, 7, 192, 3, 192, 7, 192, 7, 224, 3,
+	128, 31, 248, 1, 0, 255, 255, 0, 0, 252, 63, 0, 0, 240, 63, 0,
+	0, 0, 124, 0, 0, 0, 120, 0, 0, 0, 240, 0, 0, 0, 224, 3,
+	240, 255, 3, 0, 240, 255, 15, 0, 240, 255, 63, 0, 240, 255, 127, 0,
+	240, 0, 126, 0, 240, 0, 248, 0, 240, 0, 248, 0, 240, 0, 240, 1,
+	240, 0, 240, 1, 240, 0, 240, 1, 240, 0, 240, 1, 240, 0, 240, 0,
+	240, 0, 248, 0, 240, 0, 248, 0, 240, 0, 124, 0, 240, 255, 63, 0,
+	240, 255, 31, 0, 240, 255, 15, 0, 240, 255, 31, 0, 240, 0, 63, 0,
+	240, 0, 126, 0, 240, 0, 124, 0, 240, 0, 248, 0, 240, 0, 248, 0,
+	240, 0, 240, 1, 240, 0, 224, 1, 240, 0, 224, 3, 240, 0, 192, 3,
+	240, 0, 192, 7, 240, 0, 128, 7, 240, 0, 128, 15, 240, 0, 0, 31,
+	0, 248, 63, 0, 0, 252, 255, 1, 0, 255, 255, 1, 128, 255, 255, 1,
+	192, 15, 192, 1, 192, 3, 0, 0, 224, 3, 0, 0, 224, 1, 0, 0,
+	224, 1, 0, 0, 224, 1, 0, 0, 224, 3, 0, 0, 224, 3, 0, 0,
+	192, 15, 0, 0, 192, 255, 0, 0, 128, 255, 31, 0, 0, 255, 127, 0,
+	0, 252, 255, 0, 0, 224, 255, 1, 0, 0, 252, 3, 0, 0, 240, 3,
+	0, 0, 192, 7, 0, 0, 192, 7, 0, 0, 128, 7, 0, 0, 128, 7,
+	0, 0, 128, 7, 0, 0, 128, 7, 32, 0, 192, 7, 224, 0, 224, 3,
+	224, 7, 248, 1, 224, 255, 255, 1, 224, 255, 127, 0, 0, 254, 31, 0,
+	252, 255, 255, 63, 252, 255, 255, 63, 252, 255, 255, 63, 252, 255, 255, 63,
+	0, 192, 3, 0, 0, 192, 3, 0, 0, 192, 3, 0, 0, 192, 3, 0,
+	0, 192, 3, 0, 0, 192, 3, 0, 0, 192, 3, 0, 0, 192, 3, 0,
+	0, 192, 3, 0, 0, 192, 3, 0, 0, 192, 3, 0, 0, 192, 3, 0,
+	0, 192, 3, 0, 0, 192, 3, 0, 0, 192, 3, 0, 0, 192, 3, 0,
+	0, 192, 3, 0, 0, 192, 3, 0, 0, 192, 3, 0, 0, 192, 3, 0,
+	0, 192, 3, 0, 0, 192, 3, 0, 0, 192, 3, 0, 0, 192, 3, 0,
+	0, 192, 3, 0, 0, 192, 3, 0, 0, 192, 3, 0, 0, 192, 3, 0,
+	240, 0, 0, 15, 240, 0, 0, 15, 240, 0, 0, 15, 240, 0, 0, 15,
+	240, 0, 0, 15, 240, 0, 0, 15, 240, 0, 0, 15, 240, 0, 0, 15,
+	240, 0, 0, 15, 240, 0, 0, 15, 240, 0, 0, 15, 240, 0, 0, 15,
+	240, 0, 0, 15, 240, 0, 0, 15, 240, 0, 0, 15, 240, 0, 0, 15,
+	240, 0, 0, 15, 240, 0, 0, 15, 240, 0, 0, 15, 240, 0, 0, 15,
+	240, 0, 0, 15, 240, 0, 0, 15, 240, 0, 0, 15, 240, 1, 128, 15,
+	240, 1, 128, 15, 224, 1, 128, 7, 224, 3, 192, 7, 192, 7, 224, 7,
+	192, 31, 240, 3, 128, 255, 255, 1, 0, 254, 255, 0, 0, 248, 31, 0,
+	62, 0, 0, 124, 60, 0, 0, 60, 124, 0, 0, 62, 120, 0, 0, 62,
+	120, 0, 0, 30, 248, 0, 0, 31, 240, 0, 0, 15, 240, 1, 128, 15,
+	240, 1, 128, 7, 224, 1, 128, 7, 224, 3, 192, 7, 192, 3, 192, 3,
+	192, 7, 224, 3, 192, 7, 224, 3, 128, 7, 224, 1, 128, 15, 240, 1,
+	128, 15, 240, 1, 0, 15, 240, 0, 0, 31, 248, 0, 0, 30, 120, 0,
+	0, 62, 124, 0, 0, 62, 124, 0, 0, 60, 60, 0, 0, 124, 62, 0,
+	0, 120, 62, 0, 0, 120, 30, 0, 0, 248, 31, 0, 0, 240, 15, 0,
+	0, 240, 15, 0, 0, 240, 15, 0, 0, 224, 7, 0, 0, 224, 7, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 15, 192, 3, 224,
+	15, 192, 7, 240, 15, 192, 7, 240, 14, 224, 7, 112, 30, 224, 7, 112,
+	30, 224, 7, 120, 28, 224, 14, 120, 28, 112, 14, 120, 60, 112, 14, 56,
+	60, 112, 12, 56, 56, 112, 28, 60, 56, 56, 28, 60, 120, 56, 28, 28,
+	120, 56, 24, 30, 112, 56, 56, 30, 112, 24, 56, 14, 240, 28, 56, 14,
+	240, 28, 56, 15, 224, 28, 112, 15, 224, 12, 112, 15, 224, 15, 112, 7,
+	224, 15, 240, 7, 192, 15, 224, 7, 192, 7, 224, 3, 192, 7, 224, 3,
+	192, 7, 224, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	240, 1, 0, 31, 224, 1, 0, 15, 224, 3, 128, 7, 192, 7, 192, 7,
+	128, 7, 192, 3, 128, 15, 224, 3, 0, 31, 240, 1, 0, 30, 240, 0,
+	0, 62, 248, 0, 0, 124, 124, 0, 0, 120, 60, 0, 0, 248, 62, 0,
+	0, 240, 31, 0, 0, 224, 15, 0, 0, 224, 15, 0, 0, 224, 7, 0,
+	0, 224, 15, 0, 0, 240, 15, 0, 0, 240, 31, 0, 0, 248, 30, 0,
+	0, 124, 62, 0, 0, 60, 124, 0, 0, 62, 120, 0, 0, 31, 248, 0,
+	128, 15, 240, 1, 128, 15, 224, 1, 192, 7, 224, 3, 192, 3, 192, 7,
+	224, 3, 128, 7, 240, 1, 128, 15, 240, 0, 0, 31, 248, 0, 0, 62,
+	248, 0, 0, 30, 240, 0, 0, 31, 240, 1, 128, 15, 224, 3, 128, 7,
+	192, 3, 192, 7, 192, 7, 224, 3, 128, 15, 224, 1, 0, 15, 240, 1,
+	0, 31, 248, 0, 0, 62, 120, 0, 0, 60, 124, 0, 0, 124, 60, 0,
+	0, 248, 30, 0, 0, 240, 31, 0, 0, 240, 15, 0, 0, 224, 7, 0,
+	0, 192, 7, 0, 0, 192, 7, 0, 0, 192, 3, 0, 0, 192, 3, 0,
+	0, 192, 3, 0, 0, 192, 3, 0, 0, 192, 3, 0, 0, 192, 3, 0,
+	0, 192, 3, 0, 0, 192, 3, 0, 0, 192, 3, 0, 0, 192, 3, 0,
+	0, 192, 3, 0, 0, 192, 3, 0, 0, 192, 3, 0, 0, 192, 3, 0,
+	248, 255, 255, 31, 248, 255, 255, 31, 248, 255, 255, 31, 240, 255, 255, 31,
+	0, 0, 128, 15, 0, 0, 192, 7, 0, 0, 224, 3, 0, 0, 240, 3,
+	0, 0, 248, 1, 0, 0, 248, 0, 0, 0, 124, 0, 0, 0, 62, 0,
+	0, 0, 63, 0, 0, 128, 31, 0, 0, 128, 15, 0, 0, 192, 7, 0,
+	0, 224, 3, 0, 0, 240, 1, 0, 0, 240, 1, 0, 0, 248, 0, 0,
+	0, 124, 0, 0, 0, 126, 0, 0, 0, 63, 0, 0, 0, 31, 0, 0,
+	128, 15, 0, 0, 192, 7, 0, 0, 224, 3, 0, 0, 240, 3, 0, 0,
+	248, 1, 0, 0, 248, 255, 255, 63, 248, 255, 255, 63, 248, 255, 255, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 255, 255, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 240, 15, 0, 0, 255, 127, 0, 192, 255, 255, 1, 224, 255, 255, 3,
+	224, 255, 255, 7, 224, 1, 240, 7, 96, 0, 192, 15, 0, 0, 128, 15,
+	0, 0, 128, 31, 0, 0, 128, 31, 0, 0, 0, 31, 0, 0, 0, 63,
+	0, 248, 255, 63, 0, 254, 255, 63, 128, 255, 255, 63, 224, 255, 255, 63,
+	224, 63, 0, 63, 240, 7, 0, 63, 240, 3, 0, 63, 248, 1, 0, 63,
+	248, 1, 128, 63, 248, 1, 128, 63, 248, 0, 128, 63, 248, 1, 192, 63,
+	248, 1, 192, 63, 248, 1, 224, 63, 240, 3, 240, 63, 240, 15, 252, 63,
+	224, 255, 127, 63, 224, 255, 63, 63, 128, 255, 31, 63, 0, 255, 7, 63,
+	192, 3, 0, 0, 192, 3, 0, 0, 192, 3, 0, 0, 192, 3, 0, 0,
+	192, 3, 0, 0, 192, 3, 0, 0, 192, 3, 0, 0, 192, 3, 0, 0,
+	192, 131, 7, 0, 192, 227, 31, 0, 192, 251, 127, 0, 192, 255, 255, 0,
+	192, 31, 248, 0, 192, 15, 240, 1, 192, 7, 224, 1, 192, 7, 224, 3,
+	192, 3, 192, 3, 192, 3, 192, 3, 192, 3, 192, 3, 192, 3, 192, 7,
+	192, 3, 192, 7, 192, 3, 192, 7, 192, 3, 192, 7, 192, 3, 192, 3,
+	192, 3, 192, 3, 192, 7, 224, 3, 192, 7, 224, 1, 192, 15, 240, 1,
+	192, 63, 248, 0, 192, 251, 127, 0, 192, 243, 63, 0, 192, 227, 31, 0,
+	0, 128, 255, 0, 0, 224, 255, 7, 0, 248, 255, 15, 0, 254, 255, 15,
+	0, 255, 255, 15, 0, 127, 0, 14, 128, 63, 0, 8, 192, 31, 0, 0,
+	192, 15, 0, 0, 224, 7, 0, 0, 224, 7, 0, 0, 224, 3, 0, 0,
+	240, 3, 0, 0, 240, 3, 0, 0, 240, 3, 0, 0, 240, 3, 0, 0,
+	240, 1, 0, 0, 240, 3, 0, 0, 240, 3, 0, 0, 240, 3, 0, 0,
+	224, 3, 0, 0, 224, 3, 0, 0, 224, 7, 0, 0, 224, 7, 0, 0,
+	192, 15, 0, 0, 192, 31, 0, 0, 128, 63, 0, 8, 0, 255, 128, 15,
+	0, 254, 255, 15, 0, 252, 255, 15, 0, 248, 255, 15, 0, 224, 255, 3,
+	0, 0, 192, 7, 0, 0, 192, 7, 0, 0, 192, 7, 0, 0, 192, 7,
+	0, 0, 192, 7, 0, 0, 192, 7, 0, 0, 192, 7, 0, 0, 192, 7,
+	0, 192, 193, 7, 0, 248, 199, 7, 0, 252, 223, 7, 0, 254, 255, 7,
+	0, 31, 248, 7, 128, 15, 240, 7, 128, 7, 224, 7, 128, 7, 224, 7,
+	192, 3, 192, 7, 192, 3, 192, 7, 192, 3, 192, 7, 192, 3, 192, 7,
+	192, 3, 192, 7, 192, 3, 192, 7, 192, 3, 192, 7, 192, 3, 192, 7,
+	192, 3, 192, 7, 128, 7, 224, 7, 128, 7, 224, 7, 128, 15, 240, 7,
+	0, 63, 248, 7, 0, 254, 255, 7, 0, 252, 223, 7, 0, 248, 135, 7,
+	0, 224, 31, 0, 0, 252, 127, 0, 0, 255, 255, 1, 128, 255, 255, 3,
+	192, 255, 255, 7, 224, 31, 224, 15, 240, 7, 192, 31, 240, 3, 128, 31,
+	248, 1, 0, 63, 248, 0, 0, 63, 248, 0, 0, 62, 252, 0, 0, 62,
+	252, 0, 0, 126, 252, 255, 255, 127, 252, 255, 255, 127, 252, 255, 255, 127,
+	252, 255, 255, 127, 252, 255, 255, 127, 124, 0, 0, 0, 124, 0, 0, 0,
+	252, 0, 0, 0, 252, 0, 0, 0, 248, 0, 0, 0, 248, 0, 0, 0,
+	240, 1, 0, 0, 240, 3, 0, 0, 224, 7, 0, 24, 224, 63, 128, 63,
+	128, 255, 255, 63, 0, 255, 255, 31, 0, 254, 255, 15, 0, 248, 255, 1,
+	0, 0, 126, 0, 0, 128, 127, 0, 0, 192, 127, 0, 0, 224, 127, 0,
+	0, 224, 1, 0, 0, 240, 1, 0, 0, 240, 0, 0, 0, 240, 0, 0,
+	0, 240, 0, 0, 0, 254, 127, 0, 0, 254, 127, 0, 0, 254, 127, 0,
+	0, 254, 63, 0, 0, 240, 0, 0, 0, 240, 0, 0, 0, 240, 0, 0,
+	0, 240, 0, 0, 0, 240, 0, 0, 0, 240, 0, 0, 0, 240, 0, 0,
+	0, 240, 0, 0, 0, 240, 0, 0, 0, 240, 0, 0, 0, 240, 0, 0,
+	0, 240, 0, 0, 0, 240, 0, 0, 0, 240, 0, 0, 0, 240, 0, 0,
+	0, 240, 0, 0, 0, 240, 0, 0, 0, 240, 0, 0, 0, 240, 0, 0,
+	0, 240, 135, 3, 0, 252, 207, 7, 0, 254, 255, 7, 0, 127, 254, 7,
+	0, 31, 240, 7, 128, 15, 224, 7, 128, 7, 224, 7, 192, 3, 192, 7,
+	192, 3, 192, 7, 192, 3, 192, 7, 192, 3, 192, 7, 192, 3, 192, 7,
+	192, 3, 192, 7, 192, 3, 192, 7, 192, 3, 192, 7, 192, 3, 192, 7,
+	192, 7, 192, 7, 128, 7, 224, 7, 128, 15, 224, 7, 0, 31, 248, 7,
+	0, 255, 255, 7, 0, 254, 223, 7, 0, 248, 207, 7, 0, 224, 193, 3,
+	0, 0, 192, 3, 0, 0, 192, 3, 0, 0, 224, 3, 0, 0, 240, 1,
+	0, 7, 252, 1, 0, 255, 255, 0, 0, 255, 127, 0, 0, 252, 31, 0,
+	192, 7, 0, 0, 192, 7, 0, 0, 192, 7, 0, 0, 192, 7, 0, 0,
+	192, 7, 0, 0, 192, 7, 0, 0, 192, 7, 0, 0, 192, 7, 0, 0,
+	192, 7, 7, 0, 192, 199, 63, 0, 192, 247, 127, 0, 192, 255, 255, 0,
+	192, 127, 248, 1, 192, 31, 240, 1, 192, 15, 224, 1, 192, 7, 224, 3,
+	192, 7, 192, 3, 192, 7, 192, 3, 192, 7, 192, 3, 192, 7, 192, 3,
+	192, 7, 192, 3, 192, 7, 192, 3, 192, 7, 192, 3, 192, 7, 192, 3,
+	192, 7, 192, 3, 192, 7, 192, 3, 192, 7, 192, 3, 192, 7, 192, 3,
+	192, 7, 192, 3, 192, 7, 192, 3, 192, 7, 192, 3, 192, 7, 192, 3,
+	0, 192, 3, 0, 0, 192, 3, 0, 0, 192, 3, 0, 0, 192, 3, 0,
+	0, 192, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 192, 3, 0, 0, 192, 3, 0, 0, 192, 3, 0,
+	0, 192, 3, 0, 0, 192, 3, 0, 0, 192, 3, 0, 0, 192, 3, 0,
+	0, 192, 3, 0, 0, 192, 3, 0, 0, 192, 3, 0, 0, 192, 3, 0,
+	0, 192, 3, 0, 0, 192, 3, 0, 0, 192, 3, 0, 0, 192, 3, 0,
+	0, 192, 3, 0, 0, 192, 3, 0, 0, 192, 3, 0, 0, 192, 3, 0,
+	0, 192, 3, 0, 0, 192, 3, 0, 0, 192, 3, 0, 0, 192, 3, 0,
+	0, 0, 15, 0, 0, 0, 15, 0, 0, 0, 15, 0, 0, 0, 15, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 15, 0,
+	0, 0, 15, 0, 0, 0, 15, 0, 0, 0, 15, 0, 0, 0, 15, 0,
+	0, 0, 15, 0, 0, 0, 15, 0, 0, 0, 15, 0, 0, 0, 15, 0,
+	0, 0, 15, 0, 0, 0, 15, 0, 0, 0, 15, 0, 0, 0, 15, 0,
+	0, 0, 15, 0, 0, 0, 15, 0, 0, 0, 15, 0, 0, 0, 15, 0,
+	0, 0, 15, 0, 0, 0, 15, 0, 0, 0, 15, 0, 0, 0, 15, 0,
+	0, 0, 15, 0, 0, 192, 7, 0, 0, 240, 3, 0, 0, 240, 1, 0,
+	192, 3, 0, 0, 192, 3, 0, 0, 192, 3, 0, 0, 192, 3, 0, 0,
+	192, 3, 0, 0, 192, 3, 0, 0, 192, 3, 0, 0, 192, 3, 0, 0,
+	192, 3, 0, 0, 192, 3, 224, 1, 192, 3, 240, 1, 192, 3, 120, 0,
+	192, 3, 62, 0, 192, 3, 31, 0, 192, 131, 15, 0, 192, 195, 7, 0,
+	192, 227, 3, 0, 192, 243, 1, 0, 192, 251, 0, 0, 192, 63, 0, 0,
+	192, 127, 0, 0, 192, 127, 0, 0, 192, 251, 0, 0, 192, 243, 1, 0,
+	192, 195, 7, 0, 192, 131, 15, 0, 192, 131, 15, 0, 192, 3, 63, 0,
+	192, 3, 124, 0, 192, 3, 248, 0, 192, 3, 248, 1, 192, 3, 224, 3,
+	0, 192, 3, 0, 0, 192, 3, 0, 0, 192, 3, 0, 0, 192, 3, 0,
+	0, 192, 3, 0, 0, 192, 3, 0, 0, 192, 3, 0, 0, 192, 3, 0,
+	0, 192, 3, 0, 0, 192, 3, 0, 0, 192, 3, 0, 0, 192, 3, 0,
+	0, 192, 3, 0, 0, 192, 3, 0, 0, 192, 3, 0, 0, 192, 3, 0,
+	0, 192, 3, 0, 0, 192, 3, 0, 0, 192, 3, 0, 0, 192, 3, 0,
+	0, 192, 3, 0, 0, 192, 3, 0, 0, 192, 3, 0, 0, 192, 3, 0,
+	0, 192, 3, 0, 0, 192, 3, 0, 0, 192, 3, 0, 0, 192, 3, 0,
+	0, 192, 3, 0, 0, 192, 3, 0, 0, 192, 3, 0, 0, 192, 3, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 15, 63, 192, 15, 207, 255, 240, 63, 239, 255, 248, 127,
+	255, 240, 61, 124, 63, 224, 15, 248, 31, 192, 7, 240, 31, 192, 7, 240,
+	31, 192, 7, 240, 15, 192, 3, 240, 15, 192, 3, 240, 15, 192, 3, 240,
+	15, 192, 3, 240, 15, 192, 3, 240, 15, 192, 3, 240, 15, 192, 3, 240,
+	15, 192, 3, 240, 15, 192, 3, 240, 15, 192, 3, 240, 15, 192, 3, 240,
+	15, 192, 3, 240, 15, 192, 3, 240, 15, 192, 3, 240, 15, 192, 3, 224,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 128, 63, 0, 248, 225, 255, 0, 248, 249, 255, 1, 248, 253, 255, 3,
+	248, 255, 255, 7, 248, 31, 224, 15, 248, 15, 192, 15, 248, 7, 192, 31,
+	248, 3, 128, 31, 248, 3, 128, 31, 248, 1, 0, 31, 248, 1, 0, 31,
+	248, 1, 0, 31, 248, 1, 0, 31, 248, 1, 0, 31, 248, 1, 0, 31,
+	248, 1, 0, 31, 248, 1, 0, 31, 248, 1, 0, 31, 248, 1, 0, 31,
+	248, 1, 0, 31, 248, 1, 0, 31, 248, 1, 0, 31, 248, 1, 0, 31,
+	248, 1, 0, 31, 248, 1, 0, 31, 248, 1, 0, 31, 248, 1, 0, 31,
+	248, 1, 0, 31, 248, 1, 0, 31, 248, 1, 0, 31, 248, 1, 0, 31,
+	0, 224, 15, 0, 0, 252, 127, 0, 0, 255, 255, 1, 128, 255, 255, 3,
+	192, 255, 255, 7, 224, 15, 240, 7, 240, 7, 224, 15, 240, 3, 192, 31,
+	248, 1, 128, 31, 248, 1, 128, 63, 248, 0, 0, 63, 248, 0, 0, 63,
+	252, 0, 0, 63, 252, 0, 0, 62, 252, 0, 0, 62, 252, 0, 0, 62,
+	252, 0, 0, 62, 252, 0, 0, 62, 252, 0, 0, 62, 252, 0, 0, 62,
+	252, 0, 0, 63, 248, 0, 0, 63, 248, 1, 0, 63, 248, 1, 128, 31,
+	240, 3, 128, 31, 240, 3, 192, 15, 224, 7, 224, 15, 224, 63, 248, 7,
+	192, 255, 255, 3, 128, 255, 255, 1, 0, 254, 255, 0, 0, 248, 63, 0,
+	0, 192, 15, 0, 192, 243, 63, 0, 192, 251, 127, 0, 192, 127, 254, 0,
+	192, 31, 248, 1, 192, 15, 224, 1, 192, 7, 224, 1, 192, 7, 192, 3,
+	192, 3, 192, 3, 192, 3, 192, 3, 192, 3, 192, 7, 192, 3, 192, 7,
+	192, 3, 192, 7, 192, 3, 192, 7, 192, 3, 192, 3, 192, 3, 192, 3,
+	192, 3, 192, 3, 192, 7, 224, 3, 192, 7, 224, 1, 192, 15, 240, 1,
+	192, 63, 252, 0, 192, 251, 127, 0, 192, 243, 63, 0, 192, 195, 31, 0,
+	192, 3, 0, 0, 192, 3, 0, 0, 192, 3, 0, 0, 192, 3, 0, 0,
+	192, 3, 0, 0, 192, 3, 0, 0, 192, 3, 0, 0, 192, 3, 0, 0,
+	0, 240, 7, 0, 0, 252, 207, 7, 0, 254, 255, 7, 0, 127, 254, 7,
+	0, 31, 240, 7, 128, 15, 224, 7, 128, 7, 224, 7, 128, 7, 192, 7,
+	192, 3, 192, 7, 192, 3, 192, 7, 192, 3, 192, 7, 192, 3, 192, 7,
+	192, 3, 192, 7, 192, 3, 192, 7, 192, 3, 192, 7, 192, 3, 192, 7,
+	192, 3, 192, 7, 128, 7, 224, 7, 128, 7, 224, 7, 128, 15, 240, 7,
+	0, 63, 252, 7, 0, 254, 255, 7, 0, 252, 223, 7, 0, 240, 199, 7,
+	0, 0, 192, 7, 0, 0, 192, 7, 0, 0, 192, 7, 0, 0, 192, 7,
+	0, 0, 192, 7, 0, 0, 192, 7, 0, 0, 192, 7, 0, 0, 192, 7,
+	0, 0, 248, 1, 128, 15, 254, 1, 128, 143, 255, 1, 128, 207, 255, 1,
+	128, 255, 255, 1, 128, 255, 1, 0, 128, 255, 0, 0, 128, 127, 0, 0,
+	128, 63, 0, 0, 128, 63, 0, 0, 128, 31, 0, 0, 128, 31, 0, 0,
+	128, 31, 0, 0, 128, 31, 0, 0, 128, 31, 0, 0, 128, 15, 0, 0,
+	128, 15, 0, 0, 128, 15, 0, 0, 128, 15, 0, 0, 128, 15, 0, 0,
+	128, 15, 0, 0, 128, 15, 0, 0, 128, 15, 0, 0, 128, 15, 0, 0,
+	128, 15, 0, 0, 128, 15, 0, 0, 128, 15, 0, 0, 128, 15, 0, 0,
+	128, 15, 0, 0, 128, 15, 0, 0, 128, 15, 0, 0, 128, 15, 0, 0,
+	0, 240, 31, 0, 0, 252, 255, 3, 0, 255, 255, 3, 192, 255, 255, 7,
+	192, 255, 255, 7, 224, 15, 128, 7, 224, 7, 0, 0, 240, 3, 0, 0,
+	240, 3, 0, 0, 240, 3, 0, 0, 240, 3, 0, 0, 240, 7, 0, 0,
+	224, 15, 0, 0, 192, 127, 0, 0, 192, 255, 15, 0, 0, 255, 127, 0,
+	0, 252, 255, 1, 0, 240, 255, 3, 0, 0, 255, 7, 0, 0, 240, 7,
+	0, 0, 224, 15, 0, 0, 192, 15, 0, 0, 128, 15, 0, 0, 128, 15,
+	0, 0, 192, 15, 0, 0, 192, 15, 112, 0, 224, 7, 240, 7, 248, 7,
+	240, 255, 255, 3, 240, 255, 255, 1, 240, 255, 255, 0, 0, 255, 31, 0,
+	0, 248, 0, 0, 0, 248, 0, 0, 0, 248, 0, 0, 0, 248, 0, 0,
+	0, 248, 0, 0, 0, 248, 0, 0, 0, 248, 0, 0, 0, 255, 255, 0,
+	0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 248, 0, 0,
+	0, 248, 0, 0, 0, 248, 0, 0, 0, 248, 0, 0, 0, 248, 0, 0,
+	0, 248, 0, 0, 0, 248, 0, 0, 0, 248, 0, 0, 0, 248, 0, 0,
+	0, 248, 0, 0, 0, 248, 0, 0, 0, 248, 0, 0, 0, 248, 0, 0,
+	0, 248, 0, 0, 0, 248, 0, 0, 0, 248, 0, 0, 0, 240, 0, 0,
+	0, 240, 3, 0, 0, 240, 255, 0, 0, 224, 255, 0, 0, 128, 255, 0,
+	248, 1, 0, 31, 248, 1, 0, 31, 248, 1, 0, 31, 248, 1, 0, 31,
+	248, 1, 0, 31, 248, 1, 0, 31, 248, 1, 0, 31, 248, 1, 0, 31,
+	248, 1, 0, 31, 248, 1, 0, 31, 248, 1, 0, 31, 248, 1, 0, 31,
+	248, 1, 0, 31, 248, 1, 0, 31, 248, 1, 0, 31, 248, 1, 0, 31,
+	248, 1, 0, 31, 248, 1, 0, 31, 248, 1, 0, 31, 248, 1, 0, 31,
+	248, 1, 0, 31, 248, 1, 128, 31, 248, 1, 128, 31, 248, 1, 192, 31,
+	240, 3, 192, 31, 240, 3, 192, 31, 240, 7, 240, 31, 224, 15, 252, 31,
+	224, 255, 127, 31, 192, 255, 63, 31, 128, 255, 31, 31, 0, 254, 7, 31,
+	62, 0, 0, 252, 126, 0, 0, 124, 126, 0, 0, 126, 124, 0, 0, 126,
+	252, 0, 0, 63, 248, 0, 0, 63, 248, 0, 0, 31, 248, 1, 128, 31,
+	240, 1, 128, 31, 240, 3, 128, 15, 240, 3, 192, 15, 224, 3, 192, 15,
+	224, 7, 192, 7, 192, 7, 224, 7, 192, 15, 224, 7, 192, 15, 240, 3,
+	128, 15, 240, 3, 128, 31, 240, 1, 128, 31, 248, 1, 0, 31, 248, 1,
+	0, 63, 248, 0, 0, 62, 252, 0, 0, 126, 124, 0, 0, 126, 126, 0,
+	0, 124, 126, 0, 0, 252, 62, 0, 0, 248, 63, 0, 0, 248, 63, 0,
+	0, 248, 31, 0, 0, 248, 31, 0, 0, 240, 15, 0, 0, 240, 15, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	15, 192, 7, 240, 31, 224, 7, 240, 30, 224, 7, 240, 30, 224, 15, 120,
+	30, 224, 15, 120, 62, 240, 15, 120, 60, 240, 14, 120, 60, 240, 14, 60,
+	60, 120, 30, 60, 120, 120, 30, 60, 120, 120, 28, 62, 120, 56, 60, 30,
+	120, 56, 60, 30, 240, 60, 56, 30, 240, 60, 56, 31, 240, 28, 120, 15,
+	240, 28, 120, 15, 224, 31, 112, 15, 224, 31, 240, 7, 224, 15, 240, 7,
+	224, 15, 240, 7, 192, 15, 224, 7, 192, 15, 224, 3, 192, 7, 224, 3,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	252, 0, 0, 127, 248, 1, 0, 63, 248, 3, 128, 31, 240, 3, 192, 31,
+	224, 7, 192, 15, 192, 15, 224, 7, 192, 15, 240, 7, 128, 31, 248, 3,
+	0, 63, 248, 1, 0, 127, 252, 0, 0, 126, 126, 0, 0, 252, 127, 0,
+	0, 248, 63, 0, 0, 240, 31, 0, 0, 240, 15, 0, 0, 240, 15, 0,
+	0, 240, 15, 0, 0, 240, 31, 0, 0, 248, 31, 0, 0, 252, 63, 0,
+	0, 126, 126, 0, 0, 126, 254, 0, 0, 63, 252, 0, 128, 31, 248, 1,
+	192, 15, 248, 3, 224, 15, 240, 7, 224, 7, 224, 7, 240, 3, 192, 15,
+	248, 3, 128, 31, 248, 1, 128, 31, 252, 0, 0, 63, 126, 0, 0, 126,
+	224, 1, 128, 15, 224, 3, 128, 7, 192, 3, 192, 7, 192, 3, 192, 3,
+	128, 7, 192, 3, 128, 7, 224, 3, 128, 15, 224, 1, 0, 15, 240, 1,
+	0, 15, 240, 0, 0, 30, 240, 0, 0, 30, 120, 0, 0, 62, 120, 0,
+	0, 60, 124, 0, 0, 60, 60, 0, 0, 120, 60, 0, 0, 120, 30, 0,
+	0, 240, 30, 0, 0, 240, 31, 0, 0, 240, 15, 0, 0, 224, 15, 0,
+	0, 224, 7, 0, 0, 192, 7, 0, 0, 192, 7, 0, 0, 192, 3, 0,
+	0, 192, 3, 0, 0, 224, 3, 0, 0, 224, 1, 0, 0, 240, 0, 0,
+	0, 248, 0, 0, 128, 127, 0, 0, 128, 63, 0, 0, 128, 31, 0, 0,
+	240, 255, 255, 31, 240, 255, 255, 31, 240, 255, 255, 31, 240, 255, 255, 31,
+	240, 255, 255, 31, 0, 0, 192, 31, 0, 0, 224, 15, 0, 0, 240, 7,
+	0, 0, 248, 3, 0, 0, 248, 1, 0, 0, 252, 0, 0, 0, 126, 0,
+	0, 0, 63, 0, 0, 128, 63, 0, 0, 192, 31, 0, 0, 224, 15, 0,
+	0, 240, 7, 0, 0, 240, 3, 0, 0, 248, 1, 0, 0, 252, 0, 0,
+	0, 126, 0, 0, 0, 127, 0, 0, 128, 63, 0, 0, 192, 31, 0, 0,
+	224, 15, 0, 0, 224, 7, 0, 0, 240, 3, 0, 0, 248, 3, 0, 0,
+	248, 255, 255, 31, 248, 255, 255, 31, 248, 255, 255, 31, 248, 255, 255, 31,
+	33, 44, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 63, 64,
+	65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80,
+	81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 95, 97, 98, 99, 100, 101,
+	102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117,
+	118, 119, 120, 121, 122, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	4, 4, 255, 255, 255, 255, 255, 255, 255, 255, 187, 187, 187, 187, 172, 172,
+	172, 172, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 4, 4, 0, 170, 255, 255, 0, 176, 255, 230, 32, 250, 251, 55,
+	172, 251, 89, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 4, 4, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 255, 255, 255, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 4, 4, 0, 0, 66, 169, 0, 23, 202, 20,
+	3, 183, 58, 0, 140, 117, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 100, 127, 119, 109, 200, 0,
+	0, 182, 200, 0, 0, 182, 103, 122, 114, 110, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 127, 173, 141, 0,
+	0, 89, 141, 0, 0, 89, 141, 0, 94, 157, 187, 104, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 123, 109,
+	121, 137, 0, 0, 25, 190, 0, 82, 148, 22, 178, 184, 102, 102, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4,
+	91, 103, 118, 133, 0, 82, 110, 124, 0, 11, 37, 185, 109, 100, 113, 137,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	4, 4, 0, 46, 209, 60, 29, 130, 124, 60, 196, 93, 167, 126, 17, 17,
+	132, 73, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 4, 4, 193, 120, 109, 61, 174, 111, 122, 52, 0, 0, 6, 203,
+	112, 102, 119, 133, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 4, 4, 72, 128, 103, 74, 209, 103, 110, 63, 232, 11,
+	0, 189, 99, 121, 107, 134, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 4, 4, 111, 111, 128, 211, 0, 0, 146, 72,
+	0, 46, 176, 0, 2, 187, 33, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 132, 119, 112, 138, 127, 101,
+	95, 130, 183, 47, 40, 175, 149, 110, 107, 147, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 132, 116, 118, 105,
+	205, 2, 4, 213, 59, 115, 105, 201, 67, 101, 120, 83, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 119, 104,
+	123, 167, 0, 18, 129, 133, 0, 170, 76, 0, 0, 125, 41, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4,
+	61, 93, 91, 73, 87, 109, 136, 84, 87, 112, 143, 100, 64, 91, 90, 23,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	4, 4, 0, 125, 132, 0, 6, 137, 138, 11, 93, 152, 145, 101, 160, 0,
+	0, 148, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 4, 4, 220, 106, 120, 121, 213, 80, 100, 129, 200, 23, 40, 176,
+	219, 101, 110, 149, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 4, 4, 73, 131, 101, 120, 182, 0, 0, 0, 182, 0,
+	0, 0, 78, 124, 99, 114, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 4, 4, 204, 106, 122, 88, 167, 0, 0, 164,
+	167, 0, 0, 163, 202, 102, 116, 92, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 233, 110, 110, 103, 229, 85,
+	85, 69, 219, 22, 22, 18, 232, 104, 104, 104, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 248, 111, 111, 111,
+	246, 78, 78, 56, 243, 30, 30, 22, 241, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 83, 121,
+	102, 108, 163, 0, 11, 18, 163, 0, 50, 183, 87, 117, 97, 153, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4,
+	177, 0, 0, 169, 203, 83, 83, 197, 185, 24, 24, 177, 177, 0, 0, 169,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	4, 4, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+	255, 255, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 4, 4, 0, 0, 128, 255, 0, 0, 128, 255, 0, 0, 128, 255,
+	83, 94, 175, 149, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 4, 4, 173, 11, 137, 73, 205, 154, 28, 0, 190, 153,
+	59, 0, 173, 2, 119, 109, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 4, 4, 223, 0, 0, 0, 223, 0, 0, 0,
+	223, 0, 0, 0, 236, 104, 104, 104, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 239, 33, 17, 232, 161, 117,
+	104, 161, 152, 119, 129, 139, 152, 18, 25, 139, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 245, 80, 0, 172,
+	178, 159, 23, 172, 177, 24, 158, 173, 177, 0, 76, 242, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 88, 118,
+	116, 91, 159, 0, 0, 151, 159, 0, 0, 150, 90, 112, 110, 93, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4,
+	232, 108, 123, 148, 216, 3, 26, 209, 232, 102, 95, 27, 216, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	4, 4, 97, 103, 101, 100, 158, 0, 0, 150, 157, 9, 6, 152, 17, 89,
+	155, 60, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 4, 4, 212, 108, 159, 40, 187, 22, 134, 69, 206, 87, 166, 29,
+	181, 0, 23, 162, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 4, 4, 143, 111, 103, 83, 185, 106, 64, 9, 0, 35,
+	80, 191, 117, 99, 107, 144, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 4, 4, 111, 150, 159, 111, 0, 69, 84, 0,
+	0, 69, 84, 0, 0, 69, 84, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 177, 0, 0, 169, 177, 0,
+	0, 169, 179, 0, 0, 169, 126, 107, 107, 125, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 162, 0, 0, 150,
+	98, 58, 46, 106, 8, 142, 141, 14, 0, 129, 137, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 110, 79,
+	82, 106, 109, 86, 88, 106, 108, 88, 89, 105, 79, 102, 97, 81, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4,
+	100, 75, 39, 130, 0, 138, 160, 5, 5, 152, 160, 12, 139, 39, 28, 142,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	4, 4, 142, 39, 26, 142, 6, 153, 156, 12, 0, 73, 92, 0, 0, 72,
+	91, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 4, 4, 100, 110, 131, 188, 0, 20, 163, 18, 15, 159, 20, 0,
+	200, 130, 104, 104, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 4, 4, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 255, 255, 255, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 4, 4, 85, 136, 154, 124, 40, 120, 131, 224,
+	217, 24, 0, 217, 163, 142, 132, 213, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 205, 0, 0, 0, 230, 98,
+	112, 116, 214, 0, 0, 186, 222, 97, 110, 135, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 63, 175, 141, 145,
+	225, 18, 0, 0, 229, 14, 0, 0, 70, 169, 132, 134, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 0, 0,
+	0, 187, 109, 117, 96, 220, 207, 0, 0, 193, 130, 114, 95, 213, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4,
+	80, 155, 149, 113, 211, 90, 90, 202, 205, 41, 41, 41, 86, 150, 129, 114,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	4, 4, 0, 169, 135, 102, 98, 246, 122, 78, 0, 240, 38, 0, 0, 240,
+	38, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 4, 4, 128, 122, 101, 215, 207, 0, 0, 193, 117, 122, 99, 218,
+	45, 97, 110, 137, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 4, 4, 221, 0, 0, 0, 237, 96, 108, 145, 225, 0,
+	0, 205, 221, 0, 0, 205, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 4, 4, 160, 160, 160, 160, 213, 213, 213, 213,
+	255, 255, 255, 255, 255, 255, 255, 255, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 0, 0, 110, 146, 0, 0,
+	192, 255, 0, 0, 192, 255, 77, 88, 205, 178, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 205, 0, 0, 0,
+	205, 17, 118, 66, 223, 196, 25, 0, 205, 23, 133, 86, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 255, 255,
+	255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4,
+	182, 168, 120, 155, 136, 56, 75, 115, 126, 54, 67, 113, 126, 54, 67, 113,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	4, 4, 218, 135, 157, 147, 235, 4, 0, 205, 221, 0, 0, 205, 221, 0,
+	0, 205, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 4, 4, 92, 164, 157, 105, 205, 1, 0, 187, 205, 1, 0, 187,
+	98, 154, 148, 109, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 4, 4, 222, 104, 118, 132, 213, 0, 0, 185, 233, 102,
+	114, 135, 205, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 4, 4, 126, 123, 103, 213, 208, 0, 0, 192,
+	130, 119, 100, 224, 0, 2, 1, 187, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 236, 159, 135, 147, 255, 89,
+	0, 0, 255, 60, 0, 0, 255, 60, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 155, 154, 138, 109,
+	204, 110, 57, 6, 2, 45, 100, 207, 146, 131, 138, 157, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 71, 229,
+	22, 22, 121, 235, 86, 86, 53, 226, 0, 0, 22, 202, 113, 104, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4,
+	221, 0, 0, 205, 221, 0, 0, 205, 225, 0, 0, 215, 143, 150, 125, 214,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	4, 4, 186, 3, 1, 173, 109, 75, 56, 121, 15, 159, 157, 29, 0, 154,
+	170, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 4, 4, 127, 91, 100, 120, 127, 107, 108, 118, 122, 111, 110, 119,
+	77, 119, 108, 86, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 4, 4, 127, 81, 55, 143, 2, 164, 179, 8, 7, 173,
+	181, 13, 155, 56, 44, 153, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 4, 4, 168, 20, 9, 166, 36, 139, 128, 54,
+	0, 130, 153, 0, 63, 157, 23, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 125, 143, 154, 234, 0, 23,
+	182, 49, 31, 181, 33, 0, 231, 162, 136, 136, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	33, 44, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 63, 64,
+	65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80,
+	81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 95, 97, 98, 99, 100, 101,
+	102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117,
+	118, 119, 120, 121, 122, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 196, 7, 217, 220, 255, 255, 255, 255, 181, 181, 181, 181, 0, 0,
+	0, 0, 0, 0, 0, 0, 190, 1, 159, 94, 245, 245, 119, 119, 193, 193,
+	110, 110, 0, 0, 0, 0, 0, 0, 0, 0, 70, 1, 255, 255, 255, 255,
+	255, 255, 255, 255, 255, 255, 0, 0, 0, 0, 0, 0, 0, 0, 116, 2,
+	62, 21, 112, 112, 12, 12, 111, 111, 16, 16, 0, 0, 0, 0, 0, 0,
+	1, 0, 125, 1, 104, 71, 103, 103, 103, 103, 102, 102, 102, 102, 0, 0,
+	0, 0, 0, 0, 0, 0, 182, 1, 89, 80, 72, 72, 103, 103, 92, 92,
+	109, 109, 0, 0, 0, 0, 0, 0, 0, 0, 153, 1, 96, 96, 116, 116,
+	55, 55, 112, 112, 95, 95, 0, 0, 0, 0, 0, 0, 0, 0, 147, 1,
+	92, 60, 122, 122, 71, 71, 59, 59, 120, 120, 0, 0, 0, 0, 0, 0,
+	1, 0, 98, 1, 92, 42, 110, 110, 54, 54, 78, 78, 121, 121, 0, 0,
+	0, 0, 0, 0, 0, 0, 150, 1, 101, 85, 87, 87, 144, 144, 54, 54,
+	114, 114, 0, 0, 0, 0, 0, 0, 1, 0, 127, 1, 109, 64, 87, 87,
+	127, 127, 114, 114, 108, 108, 0, 0, 0, 0, 0, 0, 0, 0, 139, 1,
+	76, 74, 136, 136, 53, 53, 65, 65, 53, 53, 0, 0, 0, 0, 0, 0,
+	2, 0, 127, 1, 119, 56, 119, 119, 119, 119, 120, 120, 119, 119, 0, 0,
+	0, 0, 0, 0, 1, 0, 126, 1, 109, 65, 111, 111, 110, 110, 87, 87,
+	127, 127, 0, 0, 0, 0, 0, 0, 0, 0, 235, 1, 75, 48, 135, 135,
+	61, 61, 79, 79, 35, 35, 0, 0, 0, 0, 0, 0, 1, 0, 4, 1,
+	90, 44, 95, 95, 88, 88, 89, 89, 88, 88, 0, 0, 0, 0, 0, 0,
+	1, 0, 26, 1, 84, 33, 69, 69, 69, 69, 99, 99, 97, 97, 0, 0,
+	0, 0, 0, 0, 2, 0, 106, 1, 131, 154, 118, 118, 153, 153, 135, 135,
+	120, 120, 0, 0, 0, 0, 0, 0, 0, 0, 70, 1, 75, 71, 54, 54,
+	94, 94, 94, 94, 53, 53, 0, 0, 0, 0, 0, 0, 1, 0, 48, 1,
+	105, 143, 93, 93, 113, 113, 113, 113, 93, 93, 0, 0, 0, 0, 0, 0,
+	0, 0, 144, 1, 114, 187, 95, 95, 162, 162, 142, 142, 66, 66, 0, 0,
+	0, 0, 0, 0, 0, 0, 188, 1, 97, 146, 92, 92, 168, 168, 124, 124,
+	16, 16, 0, 0, 0, 0, 0, 0, 0, 0, 44, 1, 91, 81, 61, 61,
+	91, 91, 91, 91, 121, 121, 0, 0, 0, 0, 0, 0, 0, 0, 81, 1,
+	104, 181, 114, 114, 117, 117, 96, 96, 94, 94, 0, 0, 0, 0, 0, 0,
+	0, 0, 196, 7, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 0, 0,
+	0, 0, 0, 0, 0, 0, 232, 3, 107, 112, 185, 185, 0, 0, 45, 45,
+	172, 172, 0, 0, 0, 0, 0, 0, 0, 0, 73, 1, 98, 115, 58, 58,
+	135, 135, 128, 128, 71, 71, 0, 0, 0, 0, 0, 0, 0, 0, 158, 1,
+	74, 145, 0, 0, 105, 105, 136, 136, 52, 52, 0, 0, 0, 0, 0, 0,
+	0, 0, 25, 1, 120, 176, 129, 129, 131, 131, 108, 108, 108, 108, 0, 0,
+	0, 0, 0, 0, 0, 0, 83, 1, 128, 190, 93, 93, 163, 163, 94, 94,
+	158, 158, 0, 0, 0, 0, 0, 0, 1, 0, 27, 1, 90, 60, 89, 89,
+	89, 89, 88, 88, 88, 88, 0, 0, 0, 0, 0, 0, 1, 0, 138, 1,
+	106, 133, 127, 127, 135, 135, 132, 132, 33, 33, 0, 0, 0, 0, 0, 0,
+	1, 0, 71, 1, 84, 52, 87, 87, 88, 88, 67, 67, 92, 92, 0, 0,
+	0, 0, 0, 0, 1, 0, 76, 1, 110, 122, 99, 99, 130, 130, 117, 117,
+	95, 95, 0, 0, 0, 0, 0, 0, 0, 0, 120, 1, 99, 71, 66, 66,
+	134, 134, 67, 67, 132, 132, 0, 0, 0, 0, 0, 0, 0, 0, 43, 1,
+	62, 81, 88, 88, 87, 87, 43, 43, 45, 45, 0, 0, 0, 0, 0, 0,
+	0, 0, 84, 1, 94, 139, 83, 83, 86, 86, 101, 101, 99, 99, 0, 0,
+	0, 0, 0, 0, 0, 0, 28, 1, 75, 34, 75, 75, 77, 77, 72, 72,
+	72, 72, 0, 0, 0, 0, 0, 0, 0, 0, 203, 0, 95, 47, 95, 95,
+	96, 96, 93, 93, 91, 91, 0, 0, 0, 0, 0, 0, 0, 0, 50, 1,
+	83, 41, 83, 83, 79, 79, 83, 83, 84, 84, 0, 0, 0, 0, 0, 0,
+	0, 0, 56, 1, 62, 31, 82, 82, 83, 83, 44, 44, 48, 48, 0, 0,
+	0, 0, 0, 0, 0, 0, 55, 1, 92, 129, 122, 122, 58, 58, 126, 126,
+	59, 59, 0, 0, 0, 0, 0, 0, 0, 0, 36, 0, 255, 255, 255, 255,
+	255, 255, 255, 255, 255, 255, 0, 0, 0, 0, 0, 0, 1, 0, 55, 1,
+	133, 100, 157, 157, 98, 98, 136, 136, 144, 144, 0, 0, 0, 0, 0, 0,
+	1, 0, 146, 1, 108, 118, 59, 59, 129, 129, 129, 129, 108, 108, 0, 0,
+	0, 0, 0, 0, 0, 0, 81, 1, 93, 81, 68, 68, 117, 117, 117, 117,
+	65, 65, 0, 0, 0, 0, 0, 0, 1, 0, 143, 1, 107, 117, 126, 126,
+	59, 59, 109, 109, 125, 125, 0, 0, 0, 0, 0, 0, 1, 0, 28, 1,
+	119, 67, 140, 140, 136, 136, 124, 124, 89, 89, 0, 0, 0, 0, 0, 0,
+	0, 0, 55, 2, 95, 44, 112, 112, 136, 136, 129, 129, 28, 28, 0, 0,
+	0, 0, 0, 0, 1, 0, 139, 1, 120, 105, 126, 126, 110, 110, 95, 95,
+	140, 140, 0, 0, 0, 0, 0, 0, 0, 0, 169, 1, 103, 151, 64, 64,
+	133, 133, 105, 105, 100, 100, 0, 0, 0, 0, 0, 0, 0, 0, 27, 8,
+	221, 224, 188, 188, 188, 188, 255, 255, 255, 255, 0, 0, 0, 0, 0, 0,
+	0, 0, 199, 4, 112, 108, 173, 173, 0, 0, 43, 43, 203, 203, 0, 0,
+	0, 0, 0, 0, 0, 0, 146, 1, 93, 109, 46, 46, 104, 104, 158, 158,
+	63, 63, 0, 0, 0, 0, 0, 0, 0, 0, 19, 8, 255, 255, 255, 255,
+	255, 255, 255, 255, 255, 255, 0, 0, 0, 0, 0, 0, 0, 0, 179, 0,
+	107, 140, 117, 117, 133, 133, 91, 91, 93, 93, 0, 0, 0, 0, 0, 0,
+	0, 0, 55, 1, 120, 162, 124, 124, 141, 141, 104, 104, 100, 100, 0, 0,
+	0, 0, 0, 0, 1, 0, 33, 1, 113, 73, 112, 112, 112, 112, 111, 111,
+	111, 111, 0, 0, 0, 0, 0, 0, 1, 0, 142, 1, 108, 119, 108, 108,
+	129, 129, 129, 129, 61, 61, 0, 0, 0, 0, 0, 0, 1, 0, 139, 1,
+	108, 118, 126, 126, 110, 110, 61, 61, 126, 126, 0, 0, 0, 0, 0, 0,
+	0, 0, 193, 1, 100, 124, 67, 67, 180, 180, 152, 152, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 93, 1, 116, 84, 78, 78, 153, 153, 86, 86,
+	150, 150, 0, 0, 0, 0, 0, 0, 0, 0, 12, 2, 101, 59, 53, 53,
+	163, 163, 127, 127, 56, 56, 0, 0, 0, 0, 0, 0, 0, 0, 55, 1,
+	120, 161, 100, 100, 104, 104, 126, 126, 137, 137, 0, 0, 0, 0, 0, 0,
+	0, 0, 12, 1, 88, 42, 87, 87, 90, 90, 86, 86, 86, 86, 0, 0,
+	0, 0, 0, 0, 0, 0, 191, 0, 109, 55, 112, 112, 113, 113, 105, 105,
+	104, 104, 0, 0, 0, 0, 0, 0, 0, 0, 13, 1, 96, 52, 94, 94,
+	94, 94, 96, 96, 95, 95, 0, 0, 0, 0, 0, 0, 0, 0, 111, 1,
+	78, 34, 87, 87, 88, 88, 92, 92, 46, 46, 0, 0, 0, 0, 0, 0,
+	0, 0, 61, 1, 114, 145, 151, 151, 73, 73, 149, 149, 79, 79, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	33, 44, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 63, 64,
+	65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80,
+	81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 95, 97, 98, 99, 100, 101,
+	102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117,
+	118, 119, 120, 121, 122, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 75, 147, 82, 208, 237, 37, 235, 63,
+	189, 198, 46, 81, 189, 213, 30, 64, 210, 171, 1, 74, 67, 141, 235, 63,
+	0, 0, 0, 0, 0, 0, 240, 63, 0, 0, 0, 0, 0, 0, 240, 63,
+	184, 2, 10, 245, 244, 145, 230, 63, 184, 2, 10, 245, 244, 145, 230, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 214, 218, 153, 157, 88, 168, 127, 63,
+	44, 173, 0, 5, 46, 67, 221, 63, 95, 3, 122, 207, 10, 45, 128, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	38, 192, 91, 196, 194, 24, 145, 63, 38, 192, 91, 196, 194, 24, 145, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 171, 179, 90, 96, 143, 9, 228, 63,
+	218, 3, 173, 192, 144, 85, 252, 63, 15, 151, 28, 119, 74, 7, 216, 63,
+	236, 246, 89, 101, 166, 180, 238, 63, 39, 77, 131, 162, 121, 0, 223, 63,
+	52, 74, 151, 254, 37, 169, 232, 63, 94, 213, 89, 45, 176, 199, 218, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 28, 141, 92, 44, 236, 250, 150, 63,
+	151, 1, 81, 228, 205, 133, 190, 63, 111, 105, 113, 191, 42, 231, 154, 63,
+	94, 31, 220, 35, 123, 184, 147, 63, 25, 251, 145, 171, 120, 78, 175, 63,
+	150, 188, 204, 195, 83, 250, 167, 63, 140, 221, 155, 70, 173, 182, 171, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 240, 63,
+	15, 69, 129, 62, 145, 39, 244, 63, 0, 0, 0, 0, 0, 0, 240, 63,
+	0, 0, 0, 0, 0, 0, 240, 63, 0, 0, 0, 0, 0, 0, 240, 63,
+	0, 0, 0, 0, 0, 0, 240, 63, 0, 0, 0, 0, 0, 0, 240, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	212, 140, 153, 186, 94, 184, 186, 63, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 57, 124, 210, 137, 4, 83, 207, 63,
+	205, 175, 230, 0, 193, 220, 3, 64, 53, 171, 136, 228, 117, 14, 181, 63,
+	88, 174, 183, 205, 84, 136, 220, 63, 60, 9, 182, 91, 220, 144, 168, 63,
+	4, 143, 111, 239, 26, 244, 219, 63, 234, 14, 24, 218, 239, 63, 176, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 45, 190, 192, 253, 41, 1, 116, 63,
+	33, 248, 75, 1, 245, 86, 167, 63, 93, 32, 152, 199, 92, 231, 121, 63,
+	254, 19, 238, 41, 121, 184, 140, 63, 95, 243, 111, 138, 42, 88, 130, 63,
+	75, 233, 247, 59, 154, 100, 130, 63, 192, 144, 239, 90, 217, 196, 116, 63,
+	0, 0, 0, 0, 0, 0, 240, 63, 64, 193, 197, 138, 26, 76, 218, 63,
+	212, 154, 230, 29, 167, 232, 247, 63, 145, 240, 189, 191, 65, 123, 209, 63,
+	53, 178, 43, 45, 35, 245, 217, 63, 201, 29, 54, 145, 153, 11, 218, 63,
+	150, 232, 44, 179, 8, 197, 217, 63, 170, 12, 227, 110, 16, 173, 217, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 77, 152, 243, 193, 67, 98, 112, 63,
+	72, 225, 138, 229, 148, 38, 152, 63, 213, 236, 81, 139, 108, 157, 172, 63,
+	35, 185, 34, 223, 46, 230, 122, 63, 204, 239, 111, 219, 91, 74, 115, 63,
+	136, 118, 70, 192, 60, 54, 120, 63, 175, 110, 148, 217, 108, 112, 121, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 45, 207, 131, 187, 179, 118, 214, 63,
+	237, 42, 164, 252, 164, 90, 251, 63, 174, 127, 215, 103, 206, 250, 211, 63,
+	255, 175, 58, 114, 164, 51, 210, 63, 174, 244, 218, 108, 172, 196, 217, 63,
+	35, 191, 126, 136, 13, 22, 215, 63, 15, 212, 41, 143, 110, 132, 219, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 183, 249, 87, 206, 168, 161, 138, 63,
+	251, 159, 66, 128, 170, 66, 167, 63, 194, 15, 26, 183, 12, 212, 140, 63,
+	173, 195, 188, 77, 126, 238, 153, 63, 88, 155, 172, 195, 234, 91, 156, 63,
+	101, 47, 152, 97, 81, 24, 163, 63, 215, 192, 52, 16, 241, 73, 141, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 210, 110, 244, 49, 31, 16, 216, 63,
+	217, 119, 69, 240, 191, 149, 249, 63, 45, 121, 60, 45, 63, 112, 216, 63,
+	215, 103, 206, 250, 148, 99, 221, 63, 100, 62, 32, 208, 153, 180, 203, 63,
+	88, 30, 164, 167, 200, 33, 220, 63, 230, 229, 176, 251, 142, 225, 215, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 175, 109, 216, 155, 54, 92, 124, 63,
+	211, 28, 95, 176, 237, 235, 158, 63, 59, 231, 208, 191, 191, 54, 177, 63,
+	91, 230, 108, 85, 240, 26, 136, 63, 172, 83, 106, 235, 95, 188, 120, 63,
+	54, 208, 235, 101, 91, 75, 140, 63, 188, 75, 45, 212, 137, 104, 128, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 251, 201, 24, 31, 102, 47, 215, 63,
+	202, 253, 14, 69, 129, 62, 249, 63, 86, 129, 90, 12, 30, 166, 205, 63,
+	16, 4, 200, 208, 177, 131, 222, 63, 21, 0, 227, 25, 52, 244, 209, 63,
+	37, 32, 38, 225, 66, 30, 205, 63, 197, 143, 49, 119, 45, 33, 222, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 174, 199, 62, 62, 42, 169, 123, 63,
+	157, 83, 56, 6, 170, 38, 162, 63, 161, 74, 122, 185, 208, 220, 174, 63,
+	245, 74, 170, 56, 116, 134, 132, 63, 202, 200, 5, 214, 25, 169, 142, 63,
+	114, 22, 209, 83, 222, 222, 135, 63, 179, 52, 237, 65, 210, 64, 132, 63,
+	0, 0, 0, 0, 0, 0, 240, 63, 208, 237, 37, 141, 209, 58, 215, 63,
+	8, 85, 106, 246, 64, 43, 246, 63, 76, 55, 137, 65, 96, 229, 196, 63,
+	212, 239, 194, 214, 108, 229, 219, 63, 181, 110, 131, 218, 111, 237, 202, 63,
+	11, 124, 69, 183, 94, 211, 211, 63, 54, 33, 173, 49, 232, 132, 222, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 159, 75, 88, 246, 194, 32, 132, 63,
+	9, 74, 153, 33, 109, 205, 157, 63, 19, 55, 207, 226, 68, 21, 129, 63,
+	39, 185, 105, 97, 72, 116, 145, 63, 62, 25, 63, 198, 123, 98, 126, 63,
+	154, 105, 79, 82, 90, 45, 137, 63, 165, 225, 237, 234, 11, 228, 145, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 213, 93, 217, 5, 131, 107, 217, 63,
+	103, 126, 53, 7, 8, 102, 249, 63, 5, 20, 234, 233, 35, 240, 212, 63,
+	239, 142, 140, 213, 230, 255, 213, 63, 47, 222, 143, 219, 47, 31, 226, 63,
+	142, 206, 249, 41, 142, 3, 203, 63, 41, 203, 16, 199, 186, 184, 220, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 154, 0, 14, 231, 31, 22, 134, 63,
+	41, 102, 197, 108, 57, 18, 161, 63, 212, 44, 114, 231, 84, 95, 164, 63,
+	235, 240, 141, 207, 122, 26, 145, 63, 66, 96, 183, 13, 185, 0, 155, 63,
+	2, 77, 10, 213, 175, 196, 138, 63, 44, 128, 51, 223, 167, 223, 129, 63,
+	0, 0, 0, 0, 0, 0, 240, 63, 136, 158, 148, 73, 13, 109, 219, 63,
+	16, 64, 106, 19, 39, 247, 247, 63, 19, 238, 149, 121, 171, 174, 207, 63,
+	86, 14, 45, 178, 157, 239, 213, 63, 98, 187, 123, 128, 238, 203, 223, 63,
+	252, 165, 69, 125, 146, 59, 220, 63, 99, 40, 39, 218, 85, 72, 219, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 124, 157, 150, 160, 44, 219, 126, 63,
+	3, 136, 67, 231, 224, 231, 155, 63, 54, 68, 112, 123, 73, 215, 172, 63,
+	193, 85, 255, 98, 113, 30, 135, 63, 216, 158, 25, 83, 243, 27, 137, 63,
+	180, 96, 222, 28, 43, 183, 139, 63, 13, 97, 166, 89, 232, 90, 114, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 10, 46, 86, 212, 96, 26, 211, 63,
+	128, 159, 113, 225, 64, 200, 248, 63, 42, 112, 178, 13, 220, 129, 210, 63,
+	248, 80, 162, 37, 143, 39, 225, 63, 242, 235, 135, 216, 96, 225, 202, 63,
+	22, 22, 220, 15, 120, 96, 208, 63, 52, 189, 196, 88, 166, 95, 202, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 244, 45, 211, 4, 167, 227, 125, 63,
+	102, 123, 156, 67, 78, 90, 148, 63, 245, 39, 33, 135, 206, 155, 116, 63,
+	20, 22, 114, 92, 107, 36, 136, 63, 2, 37, 98, 147, 65, 142, 146, 63,
+	152, 37, 118, 3, 40, 241, 120, 63, 137, 36, 203, 177, 26, 236, 122, 63,
+	0, 0, 0, 0, 0, 0, 0, 64, 221, 66, 87, 34, 80, 253, 221, 63,
+	212, 154, 230, 29, 167, 232, 247, 63, 5, 51, 166, 96, 141, 179, 203, 63,
+	74, 211, 160, 104, 30, 192, 221, 63, 36, 13, 110, 107, 11, 207, 221, 63,
+	56, 105, 26, 20, 205, 3, 222, 63, 242, 150, 171, 31, 155, 228, 221, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 103, 149, 159, 105, 19, 20, 103, 63,
+	201, 183, 5, 77, 218, 6, 154, 63, 82, 204, 230, 186, 24, 158, 168, 63,
+	21, 161, 93, 135, 118, 68, 129, 63, 170, 0, 9, 7, 113, 98, 119, 63,
+	112, 177, 248, 40, 248, 183, 114, 63, 157, 203, 35, 250, 210, 135, 126, 63,
+	0, 0, 0, 0, 0, 0, 240, 63, 102, 18, 245, 130, 79, 115, 219, 63,
+	212, 154, 230, 29, 167, 232, 247, 63, 24, 123, 47, 190, 104, 143, 207, 63,
+	44, 12, 145, 211, 215, 243, 219, 63, 119, 132, 211, 130, 23, 125, 219, 63,
+	188, 179, 118, 219, 133, 230, 213, 63, 69, 157, 185, 135, 132, 239, 223, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 228, 57, 153, 49, 191, 93, 130, 63,
+	0, 8, 160, 187, 126, 153, 154, 63, 52, 208, 98, 142, 106, 0, 172, 63,
+	28, 248, 98, 169, 235, 109, 144, 63, 220, 25, 70, 66, 38, 53, 101, 63,
+	166, 129, 72, 204, 89, 97, 133, 63, 198, 73, 80, 73, 255, 165, 136, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 240, 52, 153, 241, 182, 210, 210, 63,
+	252, 222, 166, 63, 251, 145, 254, 63, 175, 206, 49, 32, 123, 189, 199, 63,
+	191, 214, 165, 70, 232, 231, 224, 63, 252, 81, 212, 153, 123, 72, 206, 63,
+	70, 12, 59, 140, 73, 127, 211, 63, 110, 224, 14, 212, 41, 143, 194, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 111, 149, 13, 162, 239, 226, 114, 63,
+	227, 81, 120, 196, 68, 85, 171, 63, 246, 199, 8, 12, 3, 209, 160, 63,
+	94, 79, 38, 5, 193, 239, 144, 63, 10, 201, 218, 117, 31, 159, 122, 63,
+	54, 129, 177, 0, 57, 175, 153, 63, 60, 205, 201, 236, 85, 245, 149, 63,
+	0, 0, 0, 0, 0, 0, 240, 63, 83, 121, 59, 194, 105, 193, 214, 63,
+	202, 84, 193, 168, 164, 78, 240, 63, 155, 1, 46, 200, 150, 229, 197, 63,
+	132, 46, 225, 208, 91, 60, 216, 63, 122, 0, 139, 252, 250, 33, 214, 63,
+	209, 204, 147, 107, 10, 100, 214, 63, 73, 99, 180, 142, 170, 38, 214, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 246, 5, 241, 28, 167, 42, 122, 63,
+	210, 198, 29, 74, 84, 58, 136, 63, 89, 24, 31, 153, 79, 142, 159, 63,
+	202, 239, 222, 212, 131, 102, 139, 63, 69, 90, 69, 133, 254, 146, 132, 63,
+	30, 235, 41, 150, 82, 181, 128, 63, 28, 68, 140, 185, 3, 48, 125, 63,
+	0, 0, 0, 0, 0, 0, 240, 63, 142, 88, 139, 79, 1, 48, 213, 63,
+	202, 79, 170, 125, 58, 158, 241, 63, 123, 18, 216, 156, 131, 103, 192, 63,
+	147, 26, 218, 0, 108, 64, 209, 63, 125, 236, 46, 80, 82, 96, 209, 63,
+	118, 109, 111, 183, 36, 7, 217, 63, 207, 107, 236, 18, 213, 91, 216, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 229, 196, 61, 163, 111, 145, 90, 63,
+	246, 216, 59, 119, 240, 117, 160, 63, 128, 72, 136, 240, 110, 207, 133, 63,
+	106, 233, 205, 253, 137, 158, 121, 63, 26, 94, 255, 171, 82, 209, 98, 63,
+	163, 116, 107, 254, 36, 30, 113, 63, 14, 228, 53, 23, 196, 10, 120, 63,
+	0, 0, 0, 0, 0, 0, 0, 64, 45, 209, 89, 102, 17, 138, 224, 63,
+	145, 97, 21, 111, 100, 158, 246, 63, 85, 22, 133, 93, 20, 61, 227, 63,
+	88, 141, 37, 172, 141, 177, 221, 63, 166, 213, 144, 184, 199, 82, 227, 63,
+	100, 58, 116, 122, 222, 13, 225, 63, 15, 156, 51, 162, 180, 55, 222, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 164, 8, 49, 206, 246, 87, 124, 63,
+	254, 79, 123, 129, 182, 75, 165, 63, 125, 108, 52, 54, 105, 34, 150, 63,
+	16, 184, 156, 133, 168, 6, 144, 63, 136, 190, 112, 120, 243, 145, 145, 63,
+	70, 95, 219, 150, 163, 73, 152, 63, 144, 61, 191, 196, 241, 61, 148, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 214, 199, 67, 223, 221, 202, 210, 63,
+	9, 56, 132, 42, 53, 123, 244, 63, 177, 251, 142, 225, 177, 159, 209, 63,
+	194, 47, 245, 243, 166, 34, 203, 63, 1, 251, 232, 212, 149, 207, 215, 63,
+	125, 207, 72, 132, 70, 176, 215, 63, 120, 8, 227, 167, 113, 111, 202, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 31, 10, 177, 159, 132, 249, 121, 63,
+	103, 190, 208, 23, 227, 121, 146, 63, 82, 252, 140, 244, 72, 105, 173, 63,
+	178, 15, 112, 83, 44, 145, 114, 63, 39, 65, 67, 177, 174, 122, 135, 63,
+	59, 3, 43, 26, 219, 144, 136, 63, 204, 121, 80, 191, 255, 51, 117, 63,
+	0, 0, 0, 0, 0, 0, 240, 63, 114, 192, 174, 38, 79, 89, 218, 63,
+	168, 58, 228, 102, 184, 1, 243, 63, 158, 149, 180, 226, 27, 10, 226, 63,
+	235, 226, 54, 26, 192, 91, 215, 63, 99, 99, 94, 71, 28, 178, 220, 63,
+	120, 181, 220, 153, 9, 134, 220, 63, 7, 40, 13, 53, 10, 73, 215, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 143, 106, 51, 172, 186, 191, 135, 63,
+	135, 59, 243, 33, 124, 95, 151, 63, 171, 184, 255, 17, 146, 194, 154, 63,
+	188, 0, 171, 108, 243, 204, 140, 63, 50, 253, 159, 108, 121, 23, 144, 63,
+	188, 109, 168, 134, 163, 171, 140, 63, 121, 237, 52, 98, 253, 162, 138, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 217, 37, 170, 183, 6, 182, 220, 63,
+	81, 102, 131, 76, 50, 242, 248, 63, 71, 58, 3, 35, 47, 107, 231, 63,
+	190, 18, 72, 137, 93, 219, 215, 63, 28, 8, 201, 2, 38, 112, 228, 63,
+	18, 23, 128, 70, 233, 210, 225, 63, 245, 99, 147, 252, 136, 95, 208, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 240, 201, 115, 107, 110, 104, 153, 63,
+	198, 137, 127, 50, 132, 149, 162, 63, 112, 28, 17, 53, 49, 194, 145, 63,
+	73, 146, 85, 214, 36, 185, 153, 63, 48, 112, 206, 162, 82, 139, 151, 63,
+	155, 100, 66, 226, 241, 169, 154, 63, 168, 227, 65, 151, 162, 13, 159, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 46, 87, 63, 54, 201, 143, 216, 63,
+	155, 143, 107, 67, 197, 184, 251, 63, 15, 96, 145, 95, 63, 68, 226, 63,
+	44, 129, 148, 216, 181, 189, 214, 63, 172, 228, 99, 119, 129, 18, 229, 63,
+	173, 50, 83, 90, 127, 75, 223, 63, 239, 75, 71, 74, 196, 165, 176, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 109, 66, 196, 78, 231, 204, 144, 63,
+	44, 78, 224, 56, 26, 92, 164, 63, 131, 66, 221, 50, 1, 117, 116, 63,
+	162, 105, 67, 26, 41, 118, 158, 63, 165, 208, 130, 214, 2, 77, 149, 63,
+	168, 213, 188, 88, 191, 58, 147, 63, 25, 186, 30, 107, 66, 164, 138, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 139, 22, 160, 109, 53, 235, 214, 63,
+	9, 196, 235, 250, 5, 187, 242, 63, 33, 61, 69, 14, 17, 55, 212, 63,
+	127, 77, 214, 168, 135, 104, 206, 63, 111, 72, 163, 2, 39, 219, 214, 63,
+	94, 130, 83, 31, 72, 222, 214, 63, 95, 36, 180, 229, 92, 138, 222, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 65, 209, 74, 18, 156, 54, 128, 63,
+	205, 206, 234, 139, 181, 196, 149, 63, 203, 157, 95, 140, 225, 64, 173, 63,
+	130, 79, 78, 139, 151, 30, 130, 63, 144, 185, 170, 207, 221, 61, 138, 63,
+	131, 144, 120, 1, 120, 244, 137, 63, 159, 254, 196, 57, 233, 7, 134, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 209, 201, 82, 235, 253, 70, 218, 63,
+	114, 220, 41, 29, 172, 255, 244, 63, 82, 95, 150, 118, 106, 174, 230, 63,
+	20, 204, 152, 130, 53, 206, 220, 63, 72, 106, 161, 100, 114, 106, 221, 63,
+	225, 182, 182, 240, 188, 84, 216, 63, 49, 148, 19, 237, 42, 164, 215, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 216, 182, 186, 21, 161, 122, 144, 63,
+	97, 246, 74, 41, 252, 209, 155, 63, 245, 50, 106, 41, 0, 246, 117, 63,
+	245, 160, 108, 127, 96, 21, 146, 63, 234, 17, 216, 164, 217, 208, 138, 63,
+	153, 53, 19, 128, 232, 16, 150, 63, 129, 79, 251, 65, 58, 251, 148, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 240, 63,
+	189, 198, 46, 81, 189, 213, 30, 64, 0, 0, 0, 0, 0, 0, 240, 63,
+	0, 0, 0, 0, 0, 0, 240, 63, 0, 0, 0, 0, 0, 0, 240, 63,
+	0, 0, 0, 0, 0, 0, 240, 63, 0, 0, 0, 0, 0, 0, 240, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	44, 173, 0, 5, 46, 67, 221, 63, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 79, 202, 164, 134, 54, 0, 219, 63,
+	161, 185, 78, 35, 45, 21, 15, 64, 126, 2, 40, 70, 150, 204, 219, 63,
+	194, 252, 21, 50, 87, 134, 231, 63, 0, 0, 0, 0, 0, 0, 0, 0,
+	23, 157, 44, 181, 222, 111, 198, 63, 253, 17, 134, 1, 75, 174, 229, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 196, 112, 154, 168, 56, 200, 123, 63,
+	9, 150, 204, 185, 51, 81, 198, 63, 180, 228, 223, 161, 8, 180, 137, 63,
+	226, 215, 43, 254, 125, 126, 160, 63, 0, 0, 0, 0, 0, 0, 0, 0,
+	95, 118, 57, 50, 120, 223, 129, 63, 148, 50, 41, 22, 18, 36, 149, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 199, 218, 223, 217, 30, 189, 216, 63,
+	43, 77, 74, 65, 183, 151, 244, 63, 98, 18, 46, 228, 17, 220, 220, 63,
+	95, 239, 254, 120, 175, 90, 205, 63, 57, 241, 213, 142, 226, 28, 225, 63,
+	7, 207, 132, 38, 137, 37, 224, 63, 36, 182, 187, 7, 232, 190, 209, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 170, 97, 117, 253, 63, 92, 130, 63,
+	138, 216, 192, 34, 54, 200, 144, 63, 98, 115, 11, 39, 152, 187, 108, 63,
+	166, 167, 138, 64, 224, 217, 129, 63, 187, 67, 129, 62, 199, 240, 146, 63,
+	149, 116, 8, 123, 221, 211, 146, 63, 96, 236, 81, 205, 205, 53, 129, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 190, 17, 221, 179, 174, 209, 210, 63,
+	116, 12, 200, 94, 239, 254, 249, 63, 110, 166, 66, 60, 18, 47, 226, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 229, 12, 197, 29, 111, 242, 218, 63,
+	130, 169, 102, 214, 82, 64, 225, 63, 135, 136, 155, 83, 201, 0, 202, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 179, 148, 201, 198, 128, 248, 141, 63,
+	41, 125, 220, 148, 238, 75, 152, 63, 31, 218, 17, 161, 234, 69, 117, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 143, 219, 53, 10, 116, 237, 151, 63,
+	173, 157, 112, 78, 98, 47, 152, 63, 141, 118, 2, 190, 106, 55, 147, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 205, 145, 149, 95, 6, 99, 222, 63,
+	185, 136, 239, 196, 172, 151, 241, 63, 69, 100, 88, 197, 27, 25, 230, 63,
+	123, 75, 57, 95, 236, 61, 224, 63, 135, 222, 226, 225, 61, 135, 224, 63,
+	170, 40, 94, 101, 109, 83, 219, 63, 99, 41, 146, 175, 4, 82, 219, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 6, 18, 170, 73, 53, 78, 133, 63,
+	64, 247, 70, 14, 133, 35, 147, 63, 127, 139, 133, 79, 250, 7, 101, 63,
+	188, 120, 25, 7, 13, 52, 144, 63, 186, 24, 78, 174, 130, 0, 125, 63,
+	244, 242, 225, 245, 105, 155, 139, 63, 142, 208, 60, 112, 108, 11, 130, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 54, 61, 40, 40, 69, 43, 224, 63,
+	160, 224, 98, 69, 13, 38, 245, 63, 194, 222, 196, 144, 156, 204, 231, 63,
+	44, 156, 164, 249, 99, 90, 215, 63, 104, 90, 98, 101, 52, 114, 228, 63,
+	143, 114, 48, 155, 0, 195, 215, 63, 193, 56, 184, 116, 204, 249, 227, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 170, 94, 85, 70, 84, 44, 137, 63,
+	141, 89, 96, 102, 194, 225, 152, 63, 246, 86, 15, 33, 160, 131, 108, 63,
+	92, 152, 72, 88, 47, 5, 139, 63, 63, 249, 221, 52, 197, 127, 128, 63,
+	135, 40, 28, 114, 33, 182, 144, 63, 8, 28, 103, 181, 211, 210, 145, 63,
+	0, 0, 0, 0, 0, 0, 240, 63, 59, 225, 37, 56, 245, 129, 214, 63,
+	5, 221, 94, 210, 24, 173, 241, 63, 37, 5, 22, 192, 148, 129, 205, 63,
+	213, 3, 230, 33, 83, 62, 214, 63, 247, 234, 227, 161, 239, 110, 214, 63,
+	94, 187, 180, 225, 176, 52, 214, 63, 158, 234, 144, 155, 225, 6, 214, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 237, 26, 71, 180, 205, 173, 128, 63,
+	224, 190, 230, 138, 93, 123, 150, 63, 36, 33, 99, 42, 117, 16, 173, 63,
+	17, 41, 235, 18, 198, 70, 128, 63, 185, 89, 166, 103, 22, 183, 135, 63,
+	81, 37, 254, 118, 143, 29, 135, 63, 54, 79, 211, 86, 6, 58, 130, 63,
+	0, 0, 0, 0, 0, 0, 240, 63, 129, 232, 73, 153, 212, 208, 218, 63,
+	61, 68, 163, 59, 136, 157, 248, 63, 184, 174, 152, 17, 222, 158, 224, 63,
+	117, 62, 60, 75, 144, 17, 224, 63, 38, 225, 66, 30, 193, 13, 225, 63,
+	165, 158, 5, 161, 188, 143, 224, 63, 152, 191, 66, 230, 202, 160, 192, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 96, 122, 202, 192, 100, 37, 134, 63,
+	50, 228, 56, 77, 185, 36, 166, 63, 169, 30, 102, 201, 120, 218, 140, 63,
+	79, 140, 190, 44, 214, 70, 152, 63, 171, 125, 230, 248, 97, 26, 155, 63,
+	86, 69, 28, 127, 100, 187, 145, 63, 165, 160, 126, 70, 202, 254, 126, 63,
+	0, 0, 0, 0, 0, 0, 240, 63, 224, 44, 37, 203, 73, 40, 213, 63,
+	9, 225, 209, 198, 17, 107, 244, 63, 239, 140, 182, 42, 137, 236, 201, 63,
+	139, 141, 121, 29, 113, 200, 213, 63, 5, 107, 156, 77, 71, 0, 214, 63,
+	49, 238, 6, 209, 90, 209, 208, 63, 212, 157, 39, 158, 179, 5, 215, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 112, 37, 56, 200, 242, 169, 126, 63,
+	167, 207, 157, 21, 87, 196, 150, 63, 236, 188, 214, 171, 141, 175, 162, 63,
+	246, 205, 224, 135, 229, 192, 129, 63, 151, 163, 22, 174, 26, 101, 136, 63,
+	193, 158, 86, 20, 144, 79, 130, 63, 48, 36, 83, 242, 18, 162, 129, 63,
+	0, 0, 0, 0, 0, 0, 240, 63, 23, 127, 219, 19, 36, 182, 219, 63,
+	154, 37, 1, 106, 106, 217, 244, 63, 219, 49, 117, 87, 118, 193, 222, 63,
+	149, 239, 25, 137, 208, 8, 217, 63, 225, 13, 105, 84, 224, 100, 224, 63,
+	142, 60, 16, 89, 164, 137, 221, 63, 71, 33, 201, 172, 222, 225, 215, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 212, 121, 226, 97, 243, 74, 132, 63,
+	110, 171, 209, 186, 8, 175, 161, 63, 8, 198, 234, 91, 136, 227, 133, 63,
+	174, 0, 244, 232, 102, 222, 139, 63, 130, 3, 52, 21, 149, 163, 140, 63,
+	202, 152, 40, 40, 178, 205, 145, 63, 124, 48, 124, 19, 33, 38, 127, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 28, 149, 155, 168, 165, 185, 216, 63,
+	15, 127, 77, 214, 168, 135, 247, 63, 18, 251, 4, 80, 140, 44, 209, 63,
+	106, 163, 58, 29, 200, 122, 208, 63, 112, 96, 114, 163, 200, 218, 224, 63,
+	4, 3, 8, 31, 74, 180, 208, 63, 128, 16, 201, 144, 99, 107, 224, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 152, 241, 131, 100, 52, 123, 114, 63,
+	27, 39, 174, 98, 6, 190, 154, 63, 67, 20, 152, 88, 105, 130, 176, 63,
+	65, 172, 200, 5, 121, 50, 121, 63, 228, 65, 132, 226, 52, 53, 104, 63,
+	225, 173, 68, 30, 95, 67, 113, 63, 216, 50, 187, 247, 232, 230, 141, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 231, 199, 95, 90, 212, 39, 207, 63,
+	175, 119, 127, 188, 87, 173, 242, 63, 153, 186, 43, 187, 96, 112, 212, 63,
+	110, 78, 37, 3, 64, 21, 214, 63, 105, 195, 97, 105, 224, 71, 214, 63,
+	136, 242, 5, 45, 36, 96, 198, 63, 219, 138, 253, 101, 247, 228, 197, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 96, 38, 40, 163, 182, 239, 135, 63,
+	12, 192, 80, 224, 248, 198, 148, 63, 248, 64, 215, 146, 193, 177, 127, 63,
+	242, 81, 36, 230, 35, 7, 145, 63, 147, 72, 44, 94, 248, 26, 151, 63,
+	26, 44, 189, 191, 116, 245, 144, 63, 106, 127, 106, 177, 64, 214, 146, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 179, 9, 48, 44, 127, 190, 215, 63,
+	85, 24, 91, 8, 114, 80, 245, 63, 211, 80, 163, 144, 100, 86, 225, 63,
+	216, 214, 79, 255, 89, 243, 212, 63, 231, 224, 153, 208, 36, 177, 213, 63,
+	172, 226, 141, 204, 35, 127, 217, 63, 20, 120, 39, 159, 30, 219, 216, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 161, 136, 171, 3, 130, 171, 128, 63,
+	90, 229, 128, 9, 49, 129, 156, 63, 43, 60, 210, 72, 80, 234, 158, 63,
+	71, 7, 216, 27, 253, 21, 145, 63, 144, 152, 248, 209, 39, 72, 144, 63,
+	210, 206, 26, 108, 104, 32, 114, 63, 184, 11, 6, 179, 99, 51, 123, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 233, 186, 240, 131, 243, 169, 210, 63,
+	139, 79, 1, 48, 158, 193, 241, 63, 225, 237, 65, 8, 200, 151, 192, 63,
+	52, 247, 144, 240, 189, 191, 210, 63, 73, 190, 18, 72, 137, 93, 211, 63,
+	153, 127, 244, 77, 154, 6, 210, 63, 241, 189, 191, 65, 123, 245, 209, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 12, 233, 10, 231, 167, 0, 99, 63,
+	49, 117, 71, 236, 62, 125, 155, 63, 145, 170, 150, 250, 129, 90, 131, 63,
+	147, 160, 135, 37, 247, 56, 103, 63, 38, 254, 164, 89, 249, 162, 118, 63,
+	174, 123, 53, 178, 21, 195, 114, 63, 230, 114, 5, 65, 243, 130, 123, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 240, 136, 10, 213, 205, 197, 215, 63,
+	35, 249, 74, 32, 37, 118, 233, 63, 215, 163, 112, 61, 10, 215, 199, 63,
+	84, 53, 65, 212, 125, 0, 216, 63, 186, 134, 25, 26, 79, 4, 216, 63,
+	253, 130, 221, 176, 109, 81, 215, 63, 192, 32, 233, 211, 42, 250, 214, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 137, 142, 242, 232, 160, 247, 97, 63,
+	221, 35, 1, 176, 86, 102, 139, 63, 236, 206, 242, 252, 127, 30, 133, 63,
+	223, 206, 106, 75, 252, 65, 118, 63, 167, 108, 1, 250, 10, 216, 102, 63,
+	91, 194, 1, 150, 158, 55, 112, 63, 184, 112, 218, 0, 203, 173, 113, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 231, 225, 4, 166, 211, 186, 212, 63,
+	191, 72, 104, 203, 185, 20, 243, 63, 195, 187, 92, 196, 119, 98, 196, 63,
+	248, 253, 155, 23, 39, 190, 212, 63, 181, 52, 183, 66, 88, 141, 211, 63,
+	246, 206, 104, 171, 146, 200, 212, 63, 224, 246, 4, 137, 237, 238, 212, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 133, 16, 42, 103, 216, 10, 112, 63,
+	69, 143, 115, 41, 241, 202, 156, 63, 125, 14, 76, 205, 167, 78, 121, 63,
+	201, 130, 124, 73, 131, 51, 117, 63, 22, 255, 217, 81, 48, 78, 121, 63,
+	194, 83, 193, 58, 52, 58, 117, 63, 109, 60, 178, 231, 17, 176, 118, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 225, 11, 147, 169, 130, 81, 207, 63,
+	182, 161, 98, 156, 191, 137, 243, 63, 244, 134, 251, 200, 173, 73, 191, 63,
+	237, 126, 21, 224, 187, 205, 212, 63, 114, 83, 3, 205, 231, 220, 212, 63,
+	84, 229, 123, 70, 34, 52, 198, 63, 61, 43, 105, 197, 55, 20, 200, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 178, 212, 185, 162, 28, 43, 118, 63,
+	83, 189, 84, 148, 93, 68, 148, 63, 170, 20, 247, 123, 191, 128, 124, 63,
+	153, 109, 26, 75, 207, 88, 115, 63, 6, 8, 180, 173, 110, 6, 120, 63,
+	199, 140, 184, 181, 203, 203, 145, 63, 45, 4, 175, 204, 185, 60, 154, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 148, 103, 94, 14, 187, 239, 214, 63,
+	32, 152, 163, 199, 239, 109, 243, 63, 107, 45, 204, 66, 59, 39, 224, 63,
+	154, 64, 17, 139, 24, 118, 222, 63, 11, 184, 231, 249, 211, 70, 205, 63,
+	1, 107, 213, 174, 9, 105, 223, 63, 100, 230, 2, 151, 199, 154, 205, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 119, 252, 160, 137, 80, 3, 137, 63,
+	59, 77, 120, 202, 143, 246, 151, 63, 132, 126, 109, 127, 78, 201, 135, 63,
+	114, 211, 0, 51, 211, 141, 132, 63, 168, 196, 118, 208, 109, 67, 150, 63,
+	252, 179, 222, 98, 252, 182, 133, 63, 219, 251, 149, 66, 26, 112, 143, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 240, 63,
+	229, 71, 252, 138, 53, 92, 194, 63, 0, 0, 0, 0, 0, 0, 240, 63,
+	0, 0, 0, 0, 0, 0, 240, 63, 0, 0, 0, 0, 0, 0, 240, 63,
+	0, 0, 0, 0, 0, 0, 240, 63, 0, 0, 0, 0, 0, 0, 240, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	161, 136, 171, 3, 130, 171, 128, 63, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 240, 63, 231, 54, 225, 94, 153, 183, 224, 63,
+	179, 65, 38, 25, 57, 139, 243, 63, 229, 122, 219, 76, 133, 120, 216, 63,
+	136, 213, 31, 97, 24, 176, 227, 63, 81, 22, 190, 190, 214, 165, 216, 63,
+	114, 195, 239, 166, 91, 246, 224, 63, 117, 171, 231, 164, 247, 13, 226, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 219, 125, 236, 21, 141, 6, 133, 63,
+	91, 35, 251, 140, 69, 88, 152, 63, 150, 251, 92, 175, 68, 193, 180, 63,
+	160, 84, 47, 148, 239, 45, 139, 63, 141, 176, 151, 239, 22, 125, 146, 63,
+	48, 37, 235, 151, 128, 61, 135, 63, 217, 206, 101, 44, 223, 240, 139, 63,
+	0, 0, 0, 0, 0, 0, 240, 63, 248, 56, 211, 132, 237, 39, 219, 63,
+	253, 19, 92, 172, 168, 65, 249, 63, 176, 58, 114, 164, 51, 48, 221, 63,
+	107, 184, 200, 61, 93, 221, 205, 63, 228, 132, 9, 163, 89, 89, 224, 63,
+	234, 236, 100, 112, 148, 60, 224, 63, 214, 83, 171, 175, 174, 10, 219, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 33, 240, 114, 252, 149, 70, 118, 63,
+	40, 91, 56, 98, 19, 18, 163, 63, 79, 252, 106, 243, 250, 34, 164, 63,
+	202, 249, 155, 123, 108, 212, 135, 63, 143, 14, 32, 94, 54, 36, 143, 63,
+	132, 74, 132, 192, 249, 55, 126, 63, 165, 53, 18, 163, 117, 233, 121, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 167, 118, 134, 169, 45, 117, 215, 63,
+	34, 26, 221, 65, 236, 76, 245, 63, 145, 44, 96, 2, 183, 238, 211, 63,
+	116, 64, 18, 246, 237, 36, 209, 63, 199, 213, 200, 174, 180, 140, 221, 63,
+	174, 102, 157, 241, 125, 113, 221, 63, 190, 45, 88, 170, 11, 120, 208, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 219, 30, 186, 222, 12, 154, 95, 63,
+	63, 61, 110, 185, 193, 228, 159, 63, 75, 19, 129, 114, 196, 182, 172, 63,
+	119, 250, 43, 223, 186, 3, 126, 63, 50, 7, 100, 171, 17, 132, 117, 63,
+	124, 187, 218, 232, 196, 148, 124, 63, 121, 123, 56, 153, 150, 77, 129, 63,
+	0, 0, 0, 0, 0, 0, 240, 63, 247, 88, 250, 208, 5, 245, 218, 63,
+	52, 244, 79, 112, 177, 34, 249, 63, 11, 180, 59, 164, 24, 32, 221, 63,
+	30, 166, 125, 115, 127, 245, 223, 63, 189, 252, 78, 147, 25, 111, 205, 63,
+	158, 36, 93, 51, 249, 102, 219, 63, 51, 24, 35, 18, 133, 150, 223, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 19, 220, 108, 10, 12, 20, 123, 63,
+	52, 139, 86, 168, 187, 252, 161, 63, 223, 145, 243, 38, 76, 238, 162, 63,
+	83, 191, 17, 221, 196, 105, 146, 63, 34, 30, 79, 134, 57, 117, 138, 63,
+	95, 16, 120, 123, 65, 200, 117, 63, 115, 11, 51, 100, 250, 65, 145, 63,
+	0, 0, 0, 0, 0, 0, 240, 63, 107, 45, 204, 66, 59, 167, 221, 63,
+	202, 108, 144, 73, 70, 206, 241, 63, 110, 251, 30, 245, 215, 43, 208, 63,
+	0, 3, 65, 128, 12, 157, 225, 63, 232, 246, 146, 198, 104, 29, 225, 63,
+	196, 123, 14, 44, 71, 200, 222, 63, 61, 238, 91, 173, 19, 151, 213, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 137, 3, 212, 155, 161, 73, 120, 63,
+	48, 52, 243, 30, 62, 57, 162, 63, 221, 247, 131, 252, 95, 157, 175, 63,
+	165, 35, 92, 207, 222, 232, 152, 63, 228, 162, 18, 220, 16, 137, 147, 63,
+	155, 92, 227, 15, 26, 125, 145, 63, 12, 17, 38, 212, 162, 86, 155, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 160, 195, 124, 121, 1, 246, 215, 63,
+	187, 15, 64, 106, 19, 231, 1, 64, 30, 79, 203, 15, 92, 229, 197, 63,
+	162, 153, 39, 215, 20, 200, 220, 63, 216, 213, 228, 41, 171, 233, 224, 63,
+	9, 169, 219, 217, 87, 30, 224, 63, 180, 200, 118, 190, 159, 26, 191, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 12, 93, 196, 209, 97, 32, 138, 63,
+	9, 2, 182, 255, 93, 177, 163, 63, 224, 222, 44, 121, 11, 197, 112, 63,
+	157, 55, 196, 140, 202, 212, 148, 63, 93, 119, 136, 246, 105, 56, 144, 63,
+	156, 162, 111, 0, 165, 254, 152, 63, 173, 68, 25, 219, 174, 185, 158, 63,
+	0, 0, 0, 0, 0, 0, 240, 63, 68, 76, 137, 36, 122, 25, 222, 63,
+	65, 72, 22, 48, 129, 219, 248, 63, 173, 132, 238, 146, 56, 43, 218, 63,
+	195, 73, 154, 63, 166, 181, 223, 63, 79, 59, 252, 53, 89, 163, 219, 63,
+	225, 123, 127, 131, 246, 234, 215, 63, 5, 221, 94, 210, 24, 173, 225, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 91, 4, 16, 194, 72, 2, 106, 63,
+	192, 128, 245, 121, 227, 98, 165, 63, 1, 223, 101, 132, 154, 149, 170, 63,
+	188, 88, 142, 95, 110, 5, 136, 63, 220, 32, 225, 178, 216, 51, 122, 63,
+	158, 130, 204, 144, 180, 14, 129, 63, 178, 69, 175, 176, 202, 141, 130, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 33, 177, 221, 61, 64, 247, 217, 63,
+	72, 51, 22, 77, 103, 167, 250, 63, 92, 84, 139, 136, 98, 242, 226, 63,
+	139, 249, 185, 161, 41, 59, 208, 63, 199, 99, 6, 42, 227, 223, 224, 63,
+	186, 161, 41, 59, 253, 160, 218, 63, 98, 249, 243, 109, 193, 82, 217, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 149, 244, 67, 208, 82, 151, 133, 63,
+	225, 74, 123, 50, 88, 75, 160, 63, 23, 36, 27, 138, 30, 15, 122, 63,
+	61, 48, 45, 100, 222, 225, 139, 63, 127, 169, 18, 81, 241, 181, 136, 63,
+	70, 129, 46, 58, 116, 232, 138, 63, 113, 227, 45, 77, 240, 85, 149, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 177, 24, 117, 173, 189, 207, 235, 63,
+	69, 216, 240, 244, 74, 25, 32, 64, 30, 195, 99, 63, 139, 37, 236, 63,
+	11, 182, 17, 79, 118, 179, 231, 63, 11, 182, 17, 79, 118, 179, 231, 63,
+	0, 0, 0, 0, 0, 0, 240, 63, 0, 0, 0, 0, 0, 0, 240, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 220, 183, 191, 69, 121, 34, 123, 63,
+	249, 96, 148, 210, 53, 121, 222, 63, 228, 205, 32, 72, 111, 231, 126, 63,
+	254, 104, 194, 222, 224, 193, 138, 63, 254, 104, 194, 222, 224, 193, 138, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 35, 107, 13, 165, 246, 34, 220, 63,
+	25, 28, 37, 175, 206, 17, 19, 64, 182, 242, 146, 255, 201, 223, 218, 63,
+	26, 224, 130, 108, 89, 190, 229, 63, 0, 0, 0, 0, 0, 0, 0, 0,
+	182, 189, 221, 146, 28, 176, 197, 63, 237, 213, 199, 67, 223, 93, 233, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 78, 142, 60, 108, 136, 219, 138, 63,
+	104, 139, 204, 185, 86, 150, 201, 63, 232, 94, 87, 141, 83, 17, 142, 63,
+	99, 40, 240, 152, 91, 235, 163, 63, 0, 0, 0, 0, 0, 0, 0, 0,
+	147, 31, 23, 86, 86, 173, 111, 63, 89, 93, 124, 166, 110, 159, 152, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 183, 95, 62, 89, 49, 92, 215, 63,
+	241, 157, 152, 245, 98, 40, 249, 63, 204, 182, 211, 214, 136, 96, 219, 63,
+	152, 166, 8, 112, 122, 23, 199, 63, 83, 236, 104, 28, 234, 119, 218, 63,
+	138, 60, 73, 186, 102, 242, 227, 63, 188, 90, 238, 204, 4, 195, 207, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 43, 247, 153, 189, 37, 40, 129, 63,
+	209, 176, 164, 88, 32, 189, 156, 63, 165, 68, 89, 213, 31, 127, 107, 63,
+	253, 9, 34, 171, 128, 57, 116, 63, 252, 44, 34, 188, 61, 54, 150, 63,
+	165, 78, 230, 46, 196, 215, 147, 63, 85, 123, 232, 179, 209, 154, 134, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 240, 63,
+	31, 75, 31, 186, 160, 14, 32, 64, 0, 0, 0, 0, 0, 0, 240, 63,
+	0, 0, 0, 0, 0, 0, 240, 63, 0, 0, 0, 0, 0, 0, 240, 63,
+	0, 0, 0, 0, 0, 0, 240, 63, 0, 0, 0, 0, 0, 0, 240, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	26, 195, 72, 62, 88, 125, 221, 63, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 169, 104, 172, 253, 157, 237, 218, 63,
+	116, 122, 222, 141, 5, 133, 230, 63, 203, 186, 127, 44, 68, 135, 225, 63,
+	178, 74, 233, 153, 94, 98, 221, 63, 151, 1, 103, 41, 89, 206, 224, 63,
+	236, 221, 31, 239, 85, 43, 215, 63, 147, 30, 134, 86, 39, 103, 215, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 102, 185, 16, 160, 104, 175, 131, 63,
+	59, 176, 6, 63, 53, 168, 141, 63, 226, 116, 188, 5, 224, 155, 165, 63,
+	139, 78, 93, 199, 42, 227, 120, 63, 207, 82, 69, 149, 23, 7, 139, 63,
+	118, 66, 88, 34, 46, 46, 158, 63, 18, 127, 242, 117, 120, 0, 133, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 57, 209, 174, 66, 202, 79, 222, 63,
+	64, 77, 45, 91, 235, 139, 243, 63, 86, 130, 197, 225, 204, 47, 228, 63,
+	164, 51, 48, 242, 178, 38, 223, 63, 75, 174, 98, 241, 155, 194, 225, 63,
+	155, 146, 172, 195, 209, 85, 218, 63, 147, 199, 211, 242, 3, 87, 217, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 215, 6, 202, 28, 190, 196, 136, 63,
+	0, 166, 9, 26, 226, 218, 154, 63, 140, 117, 94, 215, 29, 85, 167, 63,
+	188, 138, 61, 10, 184, 181, 127, 63, 60, 99, 233, 35, 76, 144, 135, 63,
+	89, 152, 140, 209, 199, 206, 144, 63, 91, 117, 138, 87, 48, 106, 149, 63,
+	0, 0, 0, 0, 0, 0, 240, 63, 13, 26, 250, 39, 184, 88, 220, 63,
+	106, 193, 139, 190, 130, 52, 242, 63, 222, 57, 148, 161, 42, 166, 209, 63,
+	21, 171, 6, 97, 110, 247, 219, 63, 45, 232, 189, 49, 4, 0, 220, 63,
+	120, 237, 210, 134, 195, 210, 219, 63, 26, 225, 237, 65, 8, 200, 219, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 8, 35, 159, 66, 58, 144, 125, 63,
+	79, 13, 138, 57, 117, 13, 159, 63, 87, 231, 149, 118, 128, 52, 179, 63,
+	27, 48, 43, 78, 91, 194, 118, 63, 197, 223, 171, 48, 98, 214, 123, 63,
+	147, 51, 91, 251, 15, 39, 125, 63, 68, 76, 82, 237, 159, 173, 120, 63,
+	0, 0, 0, 0, 0, 0, 240, 63, 194, 135, 18, 45, 121, 60, 219, 63,
+	210, 169, 43, 159, 229, 249, 248, 63, 190, 136, 182, 99, 234, 174, 221, 63,
+	208, 185, 219, 245, 210, 20, 219, 63, 207, 44, 9, 80, 83, 75, 224, 63,
+	182, 71, 111, 184, 143, 92, 224, 63, 155, 146, 172, 195, 209, 85, 206, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 47, 212, 199, 215, 162, 127, 63,
+	226, 240, 69, 222, 157, 237, 161, 63, 249, 75, 45, 212, 253, 94, 166, 63,
+	177, 197, 35, 21, 39, 218, 129, 63, 204, 81, 21, 57, 213, 100, 140, 63,
+	164, 119, 239, 135, 4, 77, 142, 63, 192, 28, 137, 129, 191, 112, 111, 63,
+	0, 0, 0, 0, 0, 0, 240, 63, 62, 179, 36, 64, 77, 45, 219, 63,
+	65, 72, 22, 48, 129, 219, 248, 63, 244, 24, 229, 153, 151, 195, 221, 63,
+	98, 15, 237, 99, 5, 191, 223, 63, 27, 99, 39, 188, 4, 167, 219, 63,
+	36, 37, 61, 12, 173, 78, 206, 63, 2, 73, 216, 183, 147, 8, 224, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 65, 145, 137, 30, 227, 108, 121, 63,
+	192, 128, 245, 121, 227, 98, 165, 63, 248, 224, 185, 156, 192, 47, 165, 63,
+	23, 128, 99, 200, 137, 79, 147, 63, 170, 82, 179, 234, 194, 105, 125, 63,
+	5, 76, 190, 63, 78, 23, 122, 63, 8, 48, 47, 114, 243, 202, 145, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 54, 148, 218, 139, 104, 59, 217, 63,
+	17, 252, 111, 37, 59, 54, 252, 63, 93, 50, 142, 145, 236, 17, 223, 63,
+	15, 97, 252, 52, 238, 205, 208, 63, 204, 42, 108, 6, 184, 160, 230, 63,
+	116, 66, 232, 160, 75, 56, 227, 63, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 51, 174, 140, 38, 204, 242, 130, 63,
+	13, 37, 109, 193, 190, 135, 165, 63, 110, 113, 235, 6, 68, 70, 159, 63,
+	130, 218, 77, 63, 59, 139, 128, 63, 108, 172, 80, 233, 196, 60, 146, 63,
+	137, 119, 119, 229, 241, 193, 155, 63, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 148, 20, 88, 0, 83, 6, 221, 63,
+	157, 99, 64, 246, 122, 247, 245, 63, 94, 158, 206, 21, 165, 132, 212, 63,
+	105, 115, 156, 219, 132, 123, 211, 63, 2, 40, 70, 150, 204, 49, 227, 63,
+	154, 150, 88, 25, 141, 124, 213, 63, 117, 177, 105, 165, 16, 200, 226, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 55, 224, 15, 2, 180, 204, 123, 63,
+	34, 174, 252, 111, 22, 143, 163, 63, 64, 222, 47, 104, 181, 172, 180, 63,
+	222, 152, 165, 28, 147, 103, 133, 63, 5, 164, 214, 185, 164, 82, 141, 63,
+	188, 114, 86, 51, 62, 167, 120, 63, 130, 224, 32, 221, 163, 252, 127, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 166, 69, 125, 146, 59, 108, 217, 63,
+	0, 174, 100, 199, 70, 96, 0, 64, 149, 14, 214, 255, 57, 204, 205, 63,
+	33, 88, 85, 47, 191, 211, 202, 63, 38, 228, 131, 158, 205, 170, 228, 63,
+	194, 21, 80, 168, 167, 15, 224, 63, 60, 217, 205, 140, 126, 52, 204, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 147, 34, 6, 173, 134, 58, 140, 63,
+	241, 252, 114, 233, 149, 146, 142, 63, 105, 140, 255, 57, 202, 144, 128, 63,
+	27, 165, 120, 16, 43, 111, 140, 63, 242, 175, 37, 19, 134, 234, 154, 63,
+	201, 249, 244, 216, 173, 219, 146, 63, 103, 116, 204, 216, 247, 6, 128, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 120, 126, 81, 130, 254, 66, 222, 63,
+	64, 77, 45, 91, 235, 139, 243, 63, 145, 183, 92, 253, 216, 36, 228, 63,
+	147, 199, 211, 242, 3, 87, 217, 63, 155, 146, 172, 195, 209, 85, 218, 63,
+	67, 226, 30, 75, 31, 186, 223, 63, 139, 79, 1, 48, 158, 65, 225, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 33, 106, 188, 36, 25, 133, 141, 63,
+	0, 166, 9, 26, 226, 218, 154, 63, 91, 87, 159, 199, 65, 176, 165, 63,
+	91, 117, 138, 87, 48, 106, 149, 63, 89, 152, 140, 209, 199, 206, 144, 63,
+	168, 108, 207, 161, 189, 167, 122, 63, 115, 7, 132, 234, 41, 150, 148, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 155, 88, 224, 43, 186, 245, 213, 63,
+	137, 152, 18, 73, 244, 178, 240, 63, 225, 10, 40, 212, 211, 71, 196, 63,
+	125, 37, 144, 18, 187, 182, 213, 63, 249, 158, 145, 8, 141, 96, 214, 63,
+	30, 224, 73, 11, 151, 85, 213, 63, 218, 201, 224, 40, 121, 117, 213, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 22, 64, 181, 215, 243, 191, 115, 63,
+	215, 200, 135, 16, 228, 93, 147, 63, 48, 222, 142, 169, 30, 242, 143, 63,
+	54, 208, 161, 233, 109, 89, 120, 63, 86, 155, 233, 5, 104, 186, 122, 63,
+	140, 211, 21, 81, 19, 7, 125, 63, 191, 217, 108, 80, 220, 203, 129, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 174, 18, 44, 14, 103, 126, 219, 63,
+	101, 57, 9, 165, 47, 4, 232, 63, 254, 243, 52, 96, 144, 244, 203, 63,
+	228, 103, 35, 215, 77, 41, 220, 63, 57, 38, 139, 251, 143, 76, 220, 63,
+	79, 176, 255, 58, 55, 109, 218, 63, 247, 228, 97, 161, 214, 52, 218, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 181, 124, 188, 145, 124, 211, 113, 63,
+	255, 113, 19, 46, 188, 58, 134, 63, 148, 69, 3, 177, 8, 240, 132, 63,
+	104, 217, 97, 173, 86, 89, 121, 63, 29, 48, 209, 226, 21, 77, 115, 63,
+	83, 189, 242, 252, 130, 22, 128, 63, 96, 120, 56, 167, 5, 253, 124, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 238, 181, 160, 247, 198, 16, 216, 63,
+	24, 178, 186, 213, 115, 210, 240, 63, 242, 236, 242, 173, 15, 235, 201, 63,
+	134, 29, 198, 164, 191, 151, 215, 63, 222, 0, 51, 223, 193, 79, 215, 63,
+	70, 209, 3, 31, 131, 21, 216, 63, 133, 206, 107, 236, 18, 213, 215, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 53, 226, 90, 173, 175, 23, 120, 63,
+	15, 196, 110, 45, 157, 97, 148, 63, 54, 126, 151, 166, 143, 42, 110, 63,
+	131, 200, 255, 11, 218, 38, 129, 63, 129, 90, 4, 158, 74, 175, 133, 63,
+	201, 207, 78, 35, 19, 178, 125, 63, 3, 151, 43, 27, 216, 94, 117, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 134, 113, 55, 136, 214, 138, 211, 63,
+	157, 17, 165, 189, 193, 23, 247, 63, 153, 213, 59, 220, 14, 13, 193, 63,
+	10, 162, 238, 3, 144, 218, 213, 63, 170, 124, 207, 72, 132, 70, 214, 63,
+	198, 105, 136, 42, 252, 25, 215, 63, 220, 73, 68, 248, 23, 65, 199, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 12, 245, 139, 104, 93, 184, 108, 63,
+	207, 126, 218, 254, 26, 100, 143, 63, 100, 173, 218, 247, 219, 40, 115, 63,
+	39, 104, 88, 201, 51, 96, 131, 63, 146, 191, 176, 159, 81, 17, 132, 63,
+	148, 23, 203, 59, 187, 42, 129, 63, 246, 245, 202, 100, 17, 128, 130, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 136, 213, 31, 97, 24, 176, 220, 63,
+	110, 23, 154, 235, 52, 210, 243, 63, 188, 87, 173, 76, 248, 37, 226, 63,
+	22, 133, 93, 20, 61, 240, 226, 63, 192, 174, 38, 79, 89, 77, 210, 63,
+	211, 45, 59, 196, 63, 236, 226, 63, 35, 187, 210, 50, 82, 239, 211, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 255, 19, 174, 11, 172, 109, 138, 63,
+	157, 114, 80, 95, 205, 34, 144, 63, 73, 88, 170, 8, 36, 99, 126, 63,
+	147, 171, 143, 19, 205, 168, 133, 63, 118, 73, 205, 154, 70, 189, 140, 63,
+	159, 41, 52, 55, 175, 36, 150, 63, 116, 201, 33, 230, 150, 80, 148, 63,
+};
+
+// monospace
+alignas(64) constexpr unsigned char font1[] =
+{
+	79, 67, 82, 70, 79, 78, 84, 0, 2, 0, 0, 0, 4, 3, 2, 1,
+	144, 0, 0, 0, 128, 0, 0, 0, 66, 0, 0, 0, 20, 0, 0, 0,
+	128, 0, 0, 0, 0, 0, 0, 0, 128, 1, 0, 0, 0, 0, 0, 0,
+	72, 0, 0, 0, 0, 0, 0, 0, 192, 3, 0, 0, 0, 0, 0, 0,
+	72, 0, 0, 0, 0, 0, 0, 0, 0, 6, 0, 0, 0, 0, 0, 0,
+	72, 0, 0, 0, 0, 0, 0, 0, 64, 8, 0, 0, 0, 0, 0, 0,
+	72, 0, 0, 0, 0, 0, 0, 0, 128, 10, 0, 0, 0, 0, 0, 0,
+	72, 0, 0, 0, 0, 0, 0, 0, 192, 12, 0, 0, 0, 0, 0, 0,
+	72, 0, 0, 0, 0, 0, 0, 0, 0, 15, 0, 0, 0, 0, 0, 0,
+	72, 0, 0, 0, 0, 0, 0, 0, 64, 17, 0, 0, 0, 0, 0, 0,
+	72, 0, 0, 0, 0, 0, 0, 0, 128, 19, 0, 0, 0, 0, 0, 0,
+	72, 0, 0, 0, 0, 0, 0, 0, 0, 20, 0, 0, 0, 0, 0, 0,
+	19, 0, 0, 0, 0, 0, 0, 0, 192, 30, 0, 0, 0, 0, 0, 0,
+	69, 0, 0, 0, 0, 0, 0, 0, 64, 31, 0, 0, 0, 0, 0, 0,
+	69, 0, 0, 0, 0, 0, 0, 0, 192, 65, 0, 0, 0, 0, 0, 0,
+	69, 0, 0, 0, 0, 0, 0, 0, 64, 66, 0, 0, 0, 0, 0, 0,
+	69, 0, 0, 0, 0, 0, 0, 0, 64, 84, 0, 0, 0, 0, 0, 0,
+	69, 0, 0, 0, 0, 0, 0, 0, 192, 84, 0, 0, 0, 0, 0, 0,
+	69, 0, 0, 0, 0, 0, 0, 0, 64, 90, 0, 0, 0, 0, 0, 0,
+	69, 0, 0, 0, 0, 0, 0, 0, 192, 90, 0, 0, 0, 0, 0, 0,
+	69, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 240, 63, 0, 0, 0, 0, 0, 0, 240, 63,
+	0, 0, 0, 0, 0, 0, 240, 63, 0, 0, 0, 0, 0, 0, 240, 63,
+	0, 0, 0, 0, 0, 0, 240, 63, 0, 0, 0, 0, 0, 0, 240, 63,
+	0, 0, 0, 0, 0, 0, 240, 63, 0, 0, 0, 0, 0, 0, 240, 63,
+	0, 0, 0, 0, 0, 0, 240, 63, 0, 0, 0, 0, 0, 0, 240, 63,
+	0, 0, 0, 0, 0, 0, 240, 63, 0, 0, 0, 0, 0, 0, 240, 63,
+	0, 0, 0, 0, 0, 0, 240, 63, 0, 0, 0, 0, 0, 0, 240, 63,
+	0, 0, 0, 0, 0, 0, 240, 63, 0, 0, 0, 0, 0, 0, 240, 63,
+	0, 0, 0, 0, 0, 0, 240, 63, 0, 0, 0, 0, 0, 0, 240, 63,
+	0, 0, 0, 0, 0, 0, 240, 63, 0, 0, 0, 0, 0, 0, 0, 64,
+	0, 0, 0, 0, 0, 0, 0, 64, 0, 0, 0, 0, 0, 0, 240, 127,
+	0, 0, 0, 0, 0, 0, 240, 127, 0, 0, 0, 0, 0, 0, 240, 127,
+	101, 222, 170, 235, 80, 77, 208, 63, 121, 60, 45, 63, 112, 149, 208, 63,
+	163, 31, 13, 167, 204, 205, 216, 63, 191, 153, 152, 46, 196, 234, 212, 63,
+	83, 122, 166, 151, 24, 203, 212, 63, 102, 163, 115, 126, 138, 227, 216, 63,
+	80, 58, 145, 96, 170, 153, 217, 63, 218, 30, 189, 225, 62, 114, 219, 63,
+	203, 105, 79, 201, 57, 177, 215, 63, 52, 47, 135, 221, 119, 12, 218, 63,
+	9, 139, 138, 56, 157, 100, 210, 63, 184, 34, 49, 65, 13, 223, 215, 63,
+	153, 72, 105, 54, 143, 195, 225, 63, 87, 121, 2, 97, 167, 88, 215, 63,
+	115, 75, 171, 33, 113, 143, 221, 63, 145, 238, 231, 20, 228, 103, 215, 63,
+	142, 235, 223, 245, 153, 179, 210, 63, 69, 155, 227, 220, 38, 92, 224, 63,
+	154, 153, 153, 153, 153, 153, 233, 63, 0, 0, 0, 0, 0, 0, 240, 63,
+	194, 217, 173, 101, 50, 28, 212, 63, 43, 50, 58, 32, 9, 251, 220, 63,
+	148, 219, 246, 61, 234, 175, 215, 63, 230, 5, 216, 71, 167, 174, 217, 63,
+	182, 188, 114, 189, 109, 166, 215, 63, 65, 69, 213, 175, 116, 62, 228, 63,
+	154, 8, 27, 158, 94, 41, 210, 63, 25, 228, 46, 194, 20, 229, 200, 63,
+	182, 159, 140, 241, 97, 246, 216, 63, 173, 109, 138, 199, 69, 181, 214, 63,
+	88, 142, 144, 129, 60, 187, 212, 63, 139, 250, 36, 119, 216, 68, 219, 63,
+	70, 38, 224, 215, 72, 18, 214, 63, 7, 151, 142, 57, 207, 216, 210, 63,
+	182, 77, 241, 184, 168, 22, 215, 63, 126, 87, 4, 255, 91, 73, 235, 63,
+	120, 207, 129, 229, 8, 25, 210, 63, 186, 247, 112, 201, 113, 39, 225, 63,
+	34, 56, 46, 227, 166, 6, 224, 63, 97, 113, 56, 243, 171, 57, 214, 63,
+	206, 196, 116, 33, 86, 127, 221, 63, 18, 131, 192, 202, 161, 69, 213, 63,
+	121, 115, 184, 86, 123, 216, 223, 63, 31, 48, 15, 153, 242, 33, 214, 63,
+	155, 4, 111, 72, 163, 2, 217, 63, 142, 119, 71, 198, 106, 243, 214, 63,
+	220, 189, 220, 39, 71, 1, 212, 63, 212, 95, 175, 176, 224, 126, 220, 63,
+	157, 131, 103, 66, 147, 196, 221, 63, 134, 199, 126, 22, 75, 145, 215, 63,
+	56, 45, 120, 209, 87, 144, 220, 63, 64, 250, 38, 77, 131, 162, 220, 63,
+	220, 242, 145, 148, 244, 48, 215, 63, 114, 248, 164, 19, 9, 166, 215, 63,
+	135, 82, 123, 17, 109, 199, 221, 63, 107, 244, 106, 128, 210, 80, 219, 63,
+	246, 152, 72, 105, 54, 143, 218, 63, 90, 186, 130, 109, 196, 147, 217, 63,
+	66, 96, 229, 208, 34, 219, 219, 63, 212, 155, 81, 243, 85, 242, 224, 63,
+	19, 72, 137, 93, 219, 219, 219, 63, 156, 48, 97, 52, 43, 219, 219, 63,
+	211, 219, 159, 139, 134, 140, 222, 63, 27, 245, 16, 141, 238, 32, 223, 63,
+	79, 177, 106, 16, 230, 118, 221, 63, 131, 252, 108, 228, 186, 41, 220, 63,
+	166, 99, 206, 51, 246, 37, 220, 63, 210, 111, 95, 7, 206, 25, 222, 63,
+	141, 65, 39, 132, 14, 186, 224, 63, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	16, 204, 209, 227, 247, 54, 245, 63, 141, 69, 211, 217, 201, 96, 245, 63,
+	245, 219, 215, 129, 115, 198, 249, 63, 200, 94, 239, 254, 120, 175, 245, 63,
+	39, 194, 134, 167, 87, 74, 244, 63, 83, 145, 10, 99, 11, 193, 248, 63,
+	16, 93, 80, 223, 50, 167, 242, 63, 153, 245, 98, 40, 39, 90, 250, 63,
+	168, 53, 205, 59, 78, 209, 245, 63, 31, 128, 212, 38, 78, 110, 246, 63,
+	29, 85, 77, 16, 117, 31, 250, 63, 162, 93, 133, 148, 159, 84, 250, 63,
+	153, 187, 150, 144, 15, 122, 249, 63, 38, 223, 108, 115, 99, 122, 250, 63,
+	153, 187, 150, 144, 15, 122, 249, 63, 16, 117, 31, 128, 212, 166, 247, 63,
+	62, 150, 62, 116, 65, 125, 249, 63, 64, 193, 197, 138, 26, 204, 246, 63,
+	215, 35, 30, 154, 195, 255, 171, 63, 18, 20, 63, 198, 220, 181, 243, 63,
+	201, 60, 242, 7, 3, 207, 250, 63, 22, 24, 178, 186, 213, 243, 250, 63,
+	16, 175, 235, 23, 236, 6, 251, 63, 229, 39, 213, 62, 29, 15, 251, 63,
+	139, 253, 101, 247, 228, 97, 251, 63, 189, 58, 199, 128, 236, 117, 251, 63,
+	250, 213, 28, 32, 152, 163, 251, 63, 235, 28, 3, 178, 215, 59, 252, 63,
+	51, 109, 255, 202, 74, 19, 253, 63, 135, 138, 113, 254, 38, 20, 253, 63,
+	226, 30, 75, 31, 186, 32, 253, 63, 194, 81, 242, 234, 28, 131, 253, 63,
+	53, 181, 108, 173, 47, 146, 253, 63, 53, 36, 238, 177, 244, 33, 255, 63,
+	160, 50, 254, 125, 198, 197, 10, 64, 250, 237, 235, 192, 57, 227, 31, 64,
+	31, 162, 209, 29, 196, 206, 253, 63, 23, 241, 157, 152, 245, 226, 241, 63,
+	141, 93, 162, 122, 107, 96, 245, 63, 235, 197, 80, 78, 180, 43, 247, 63,
+	19, 68, 221, 7, 32, 181, 246, 63, 39, 218, 85, 72, 249, 201, 249, 63,
+	75, 229, 237, 8, 167, 133, 245, 63, 59, 252, 53, 89, 163, 158, 241, 63,
+	166, 66, 60, 18, 47, 79, 237, 63, 93, 138, 171, 202, 190, 43, 241, 63,
+	44, 43, 77, 74, 65, 55, 248, 63, 45, 207, 131, 187, 179, 118, 245, 63,
+	245, 219, 215, 129, 115, 198, 249, 63, 27, 187, 68, 245, 214, 192, 247, 63,
+	156, 138, 84, 24, 91, 136, 249, 63, 245, 16, 141, 238, 32, 118, 249, 63,
+	156, 162, 35, 185, 252, 7, 246, 63, 48, 76, 166, 10, 70, 37, 245, 63,
+	10, 128, 241, 12, 26, 250, 248, 63, 218, 56, 98, 45, 62, 5, 249, 63,
+	82, 97, 108, 33, 200, 193, 249, 63, 116, 94, 99, 151, 168, 222, 252, 63,
+	117, 142, 1, 217, 235, 93, 246, 63, 152, 192, 173, 187, 121, 42, 244, 63,
+	33, 60, 218, 56, 98, 173, 251, 63, 33, 60, 218, 56, 98, 173, 251, 63,
+	253, 130, 221, 176, 109, 209, 242, 63, 142, 175, 61, 179, 36, 64, 251, 63,
+	67, 86, 183, 122, 78, 122, 243, 63, 240, 133, 201, 84, 193, 40, 251, 63,
+	240, 133, 201, 84, 193, 40, 251, 63, 245, 16, 141, 238, 32, 118, 249, 63,
+	171, 149, 9, 191, 212, 207, 248, 63, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	198, 80, 78, 180, 171, 144, 211, 63, 46, 199, 43, 16, 61, 41, 191, 63,
+	8, 89, 22, 76, 252, 81, 208, 63, 34, 51, 23, 184, 60, 214, 194, 63,
+	63, 54, 201, 143, 248, 21, 197, 63, 127, 47, 133, 7, 205, 174, 213, 63,
+	177, 252, 249, 182, 96, 169, 196, 63, 81, 191, 11, 91, 179, 21, 228, 63,
+	118, 165, 101, 164, 222, 83, 213, 63, 150, 121, 171, 174, 67, 53, 221, 63,
+	22, 223, 80, 248, 108, 29, 226, 63, 64, 78, 152, 48, 154, 149, 219, 63,
+	70, 92, 0, 26, 165, 75, 233, 63, 204, 212, 36, 120, 67, 26, 207, 63,
+	212, 68, 159, 143, 50, 98, 232, 63, 10, 219, 79, 198, 248, 48, 222, 63,
+	175, 96, 27, 241, 100, 55, 210, 63, 76, 56, 244, 22, 15, 111, 232, 63,
+	154, 153, 153, 153, 153, 153, 233, 63, 0, 0, 0, 0, 0, 0, 240, 63,
+	84, 116, 36, 151, 255, 144, 210, 63, 180, 5, 132, 214, 195, 151, 231, 63,
+	224, 19, 235, 84, 249, 158, 215, 63, 62, 233, 68, 130, 169, 102, 214, 63,
+	55, 194, 162, 34, 78, 39, 226, 63, 153, 131, 160, 163, 85, 45, 216, 63,
+	90, 188, 88, 24, 34, 167, 209, 63, 82, 162, 128, 72, 26, 55, 180, 63,
+	64, 195, 155, 53, 120, 95, 222, 63, 30, 195, 99, 63, 139, 165, 212, 63,
+	79, 232, 245, 39, 241, 185, 201, 63, 87, 205, 115, 68, 190, 203, 227, 63,
+	227, 164, 48, 239, 113, 38, 224, 63, 45, 66, 177, 21, 52, 45, 201, 63,
+	231, 169, 14, 185, 25, 110, 219, 63, 38, 142, 60, 16, 89, 164, 235, 63,
+	232, 190, 156, 217, 174, 208, 203, 63, 10, 102, 76, 193, 26, 231, 229, 63,
+	61, 186, 17, 22, 21, 241, 229, 63, 118, 169, 17, 250, 153, 122, 222, 63,
+	201, 61, 93, 221, 177, 216, 213, 63, 121, 62, 3, 234, 205, 168, 203, 63,
+	78, 37, 3, 64, 21, 55, 229, 63, 203, 213, 143, 77, 242, 35, 196, 63,
+	249, 75, 139, 250, 36, 119, 198, 63, 40, 42, 27, 214, 84, 22, 201, 63,
+	56, 103, 68, 105, 111, 240, 193, 63, 147, 56, 43, 162, 38, 122, 225, 63,
+	168, 30, 105, 112, 91, 91, 212, 63, 221, 38, 220, 43, 243, 86, 197, 63,
+	233, 126, 78, 65, 126, 54, 210, 63, 26, 81, 218, 27, 124, 97, 210, 63,
+	3, 125, 34, 79, 146, 174, 208, 63, 24, 153, 128, 95, 35, 73, 194, 63,
+	1, 167, 119, 241, 126, 220, 226, 63, 73, 159, 86, 209, 31, 154, 212, 63,
+	141, 239, 139, 75, 85, 218, 224, 63, 150, 90, 239, 55, 218, 113, 208, 63,
+	87, 233, 238, 58, 27, 242, 222, 63, 31, 190, 76, 20, 33, 117, 219, 63,
+	181, 53, 34, 24, 7, 151, 222, 63, 45, 206, 24, 230, 4, 109, 222, 63,
+	158, 153, 96, 56, 215, 48, 210, 63, 247, 142, 26, 19, 98, 46, 220, 63,
+	130, 229, 8, 25, 200, 179, 212, 63, 238, 96, 196, 62, 1, 20, 223, 63,
+	56, 17, 253, 218, 250, 233, 222, 63, 192, 174, 38, 79, 89, 77, 205, 63,
+	253, 102, 98, 186, 16, 43, 227, 63, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	11, 236, 49, 145, 210, 108, 215, 63, 53, 207, 17, 249, 46, 165, 213, 63,
+	189, 200, 4, 252, 26, 73, 208, 63, 62, 65, 98, 187, 123, 128, 213, 63,
+	110, 161, 43, 17, 168, 254, 211, 63, 120, 238, 61, 92, 114, 220, 203, 63,
+	193, 25, 252, 253, 98, 182, 214, 63, 174, 154, 231, 136, 124, 151, 216, 63,
+	33, 202, 23, 180, 144, 128, 209, 63, 209, 119, 183, 178, 68, 103, 208, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 234, 204, 61, 36, 124, 239, 197, 63,
+	83, 89, 20, 118, 81, 244, 218, 63, 55, 85, 247, 200, 230, 170, 222, 63,
+	49, 149, 126, 194, 217, 173, 223, 63, 251, 7, 145, 12, 57, 182, 223, 63,
+	110, 107, 11, 207, 75, 69, 224, 63, 76, 112, 234, 3, 201, 187, 226, 63,
+	154, 153, 153, 153, 153, 153, 233, 63, 0, 0, 0, 0, 0, 0, 240, 63,
+	11, 209, 33, 112, 36, 208, 202, 63, 232, 219, 130, 165, 186, 128, 215, 63,
+	51, 137, 122, 193, 167, 57, 221, 63, 147, 24, 4, 86, 14, 45, 214, 63,
+	44, 13, 252, 168, 134, 253, 214, 63, 8, 28, 9, 52, 216, 84, 238, 63,
+	179, 125, 200, 91, 174, 126, 198, 63, 2, 211, 105, 221, 6, 181, 214, 63,
+	207, 107, 236, 18, 213, 91, 219, 63, 134, 29, 198, 164, 191, 151, 210, 63,
+	13, 54, 117, 30, 21, 255, 222, 63, 240, 51, 46, 28, 8, 201, 208, 63,
+	240, 82, 234, 146, 113, 140, 225, 63, 40, 239, 227, 104, 142, 44, 225, 63,
+	86, 128, 239, 54, 111, 28, 225, 63, 0, 0, 0, 0, 0, 0, 240, 63,
+	165, 162, 177, 246, 119, 182, 195, 63, 63, 196, 6, 11, 39, 105, 226, 63,
+	82, 68, 134, 85, 188, 145, 224, 63, 108, 5, 77, 75, 172, 140, 209, 63,
+	225, 9, 189, 254, 36, 62, 212, 63, 207, 18, 100, 4, 84, 56, 211, 63,
+	82, 242, 234, 28, 3, 178, 218, 63, 227, 52, 68, 21, 254, 12, 214, 63,
+	78, 184, 87, 230, 173, 186, 214, 63, 32, 154, 121, 114, 77, 129, 214, 63,
+	191, 71, 253, 245, 10, 11, 214, 63, 16, 149, 70, 204, 236, 243, 226, 63,
+	191, 11, 91, 179, 149, 151, 221, 63, 117, 204, 121, 198, 190, 100, 220, 63,
+	101, 113, 255, 145, 233, 208, 213, 63, 172, 201, 83, 86, 211, 245, 221, 63,
+	110, 77, 186, 45, 145, 11, 215, 63, 107, 216, 239, 137, 117, 170, 211, 63,
+	133, 124, 208, 179, 89, 245, 217, 63, 109, 3, 119, 160, 78, 121, 218, 63,
+	64, 138, 58, 115, 15, 9, 223, 63, 180, 116, 5, 219, 136, 39, 218, 63,
+	0, 87, 178, 99, 35, 16, 217, 63, 197, 26, 46, 114, 79, 87, 228, 63,
+	242, 40, 149, 240, 132, 94, 205, 63, 129, 152, 132, 11, 121, 132, 224, 63,
+	73, 186, 102, 242, 205, 182, 225, 63, 70, 12, 59, 140, 73, 127, 224, 63,
+	235, 31, 68, 50, 228, 216, 220, 63, 221, 237, 122, 105, 138, 0, 220, 63,
+	150, 152, 103, 37, 173, 120, 224, 63, 33, 3, 121, 118, 249, 214, 221, 63,
+	167, 178, 40, 236, 162, 232, 221, 63, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	146, 150, 202, 219, 17, 78, 214, 63, 94, 214, 196, 2, 95, 209, 213, 63,
+	229, 13, 48, 243, 29, 252, 224, 63, 87, 65, 12, 116, 237, 11, 214, 63,
+	224, 46, 251, 117, 167, 59, 212, 63, 242, 211, 184, 55, 191, 97, 217, 63,
+	45, 181, 222, 111, 180, 227, 216, 63, 250, 9, 103, 183, 150, 201, 217, 63,
+	203, 244, 75, 196, 91, 231, 221, 63, 54, 171, 62, 87, 91, 49, 226, 63,
+	250, 9, 103, 183, 150, 201, 217, 63, 155, 0, 195, 242, 231, 219, 218, 63,
+	87, 208, 180, 196, 202, 232, 229, 63, 253, 164, 218, 167, 227, 49, 209, 63,
+	7, 66, 178, 128, 9, 92, 224, 63, 109, 86, 125, 174, 182, 98, 205, 63,
+	70, 7, 36, 97, 223, 78, 202, 63, 148, 22, 46, 171, 176, 25, 227, 63,
+	154, 153, 153, 153, 153, 153, 233, 63, 0, 0, 0, 0, 0, 0, 240, 63,
+	67, 87, 34, 80, 253, 131, 218, 63, 57, 240, 106, 185, 51, 147, 228, 63,
+	212, 96, 26, 134, 143, 136, 203, 63, 0, 230, 90, 180, 0, 237, 225, 63,
+	22, 75, 145, 124, 37, 144, 228, 63, 38, 168, 225, 91, 88, 183, 224, 63,
+	55, 227, 52, 68, 21, 254, 209, 63, 213, 79, 73, 231, 13, 65, 159, 63,
+	24, 152, 21, 138, 116, 63, 217, 63, 97, 25, 27, 186, 217, 31, 218, 63,
+	176, 229, 149, 235, 109, 51, 218, 63, 150, 175, 203, 240, 159, 110, 225, 63,
+	185, 150, 127, 227, 33, 66, 180, 63, 208, 40, 93, 250, 151, 164, 206, 63,
+	106, 222, 113, 138, 142, 228, 186, 63, 0, 0, 0, 0, 0, 0, 240, 63,
+	202, 84, 193, 168, 164, 78, 222, 63, 205, 91, 117, 29, 170, 169, 227, 63,
+	234, 93, 188, 31, 183, 95, 226, 63, 78, 124, 181, 163, 56, 199, 227, 63,
+	179, 178, 125, 200, 91, 174, 227, 63, 179, 10, 155, 1, 46, 200, 223, 63,
+	217, 8, 196, 235, 250, 5, 220, 63, 238, 119, 40, 10, 244, 137, 214, 63,
+	37, 88, 28, 206, 252, 106, 214, 63, 49, 67, 227, 137, 32, 206, 213, 63,
+	48, 16, 4, 200, 208, 177, 214, 63, 40, 70, 150, 204, 177, 188, 209, 63,
+	132, 213, 88, 194, 218, 24, 222, 63, 149, 15, 65, 213, 232, 213, 202, 63,
+	226, 34, 247, 116, 117, 199, 224, 63, 159, 32, 177, 221, 61, 64, 220, 63,
+	227, 24, 201, 30, 161, 102, 218, 63, 214, 228, 41, 171, 233, 122, 211, 63,
+	163, 115, 126, 138, 227, 64, 224, 63, 71, 176, 113, 253, 187, 62, 219, 63,
+	10, 44, 128, 41, 3, 7, 225, 63, 183, 123, 185, 79, 142, 2, 219, 63,
+	113, 141, 207, 100, 255, 188, 224, 63, 152, 190, 215, 16, 28, 151, 216, 63,
+	66, 119, 73, 156, 21, 209, 224, 63, 199, 243, 25, 80, 111, 70, 205, 63,
+	126, 54, 114, 221, 148, 114, 225, 63, 61, 210, 224, 182, 182, 240, 220, 63,
+	53, 65, 212, 125, 0, 82, 221, 63, 121, 177, 48, 68, 78, 223, 224, 63,
+	169, 216, 152, 215, 17, 135, 220, 63, 167, 5, 47, 250, 10, 210, 221, 63,
+	60, 250, 95, 174, 69, 139, 227, 63, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	217, 94, 11, 122, 111, 12, 199, 63, 123, 74, 206, 137, 61, 180, 199, 63,
+	130, 254, 66, 143, 24, 61, 208, 63, 184, 233, 207, 126, 164, 136, 211, 63,
+	253, 216, 36, 63, 226, 87, 213, 63, 59, 172, 112, 203, 71, 82, 217, 63,
+	40, 130, 56, 15, 39, 48, 219, 63, 89, 135, 163, 171, 116, 119, 220, 63,
+	92, 198, 77, 13, 52, 159, 221, 63, 8, 147, 226, 227, 19, 178, 221, 63,
+	200, 120, 148, 74, 120, 194, 224, 63, 231, 143, 105, 109, 26, 219, 226, 63,
+	45, 65, 70, 64, 133, 35, 219, 63, 217, 36, 63, 226, 87, 172, 205, 63,
+	210, 0, 222, 2, 9, 138, 219, 63, 213, 151, 165, 157, 154, 203, 223, 63,
+	198, 163, 84, 194, 19, 122, 207, 63, 76, 221, 149, 93, 48, 184, 218, 63,
+	154, 153, 153, 153, 153, 153, 233, 63, 0, 0, 0, 0, 0, 0, 240, 63,
+	134, 230, 58, 141, 180, 84, 218, 63, 92, 204, 207, 13, 77, 89, 226, 63,
+	155, 86, 10, 129, 92, 226, 219, 63, 148, 162, 149, 123, 129, 89, 203, 63,
+	219, 190, 71, 253, 245, 10, 221, 63, 67, 114, 50, 113, 171, 32, 233, 63,
+	170, 10, 13, 196, 178, 153, 215, 63, 128, 70, 233, 210, 191, 36, 215, 63,
+	83, 92, 85, 246, 93, 17, 217, 63, 220, 104, 0, 111, 129, 4, 216, 63,
+	243, 226, 196, 87, 59, 138, 213, 63, 120, 213, 3, 230, 33, 83, 220, 63,
+	249, 245, 67, 108, 176, 112, 204, 63, 77, 190, 217, 230, 198, 244, 211, 63,
+	145, 97, 21, 111, 100, 30, 195, 63, 222, 0, 51, 223, 193, 207, 230, 63,
+	112, 94, 156, 248, 106, 71, 210, 63, 79, 4, 113, 30, 78, 96, 223, 63,
+	217, 8, 196, 235, 250, 5, 220, 63, 218, 227, 133, 116, 120, 8, 222, 63,
+	229, 211, 99, 91, 6, 156, 213, 63, 119, 191, 10, 240, 221, 230, 211, 63,
+	11, 123, 218, 225, 175, 201, 224, 63, 66, 67, 255, 4, 23, 43, 213, 63,
+	14, 248, 252, 48, 66, 120, 219, 63, 54, 172, 169, 44, 10, 187, 214, 63,
+	140, 244, 162, 118, 191, 10, 216, 63, 33, 86, 127, 132, 97, 192, 226, 63,
+	178, 71, 168, 25, 82, 69, 222, 63, 59, 29, 200, 122, 106, 245, 211, 63,
+	11, 181, 166, 121, 199, 41, 222, 63, 250, 13, 19, 13, 82, 240, 213, 63,
+	231, 251, 169, 241, 210, 77, 215, 63, 105, 115, 156, 219, 132, 123, 219, 63,
+	206, 250, 148, 99, 178, 56, 224, 63, 120, 210, 194, 101, 21, 54, 219, 63,
+	227, 140, 97, 78, 208, 166, 224, 63, 150, 37, 58, 203, 44, 66, 212, 63,
+	158, 178, 154, 174, 39, 186, 221, 63, 46, 228, 17, 220, 72, 89, 225, 63,
+	239, 1, 186, 47, 103, 182, 224, 63, 207, 72, 132, 70, 176, 113, 220, 63,
+	84, 139, 136, 98, 242, 6, 224, 63, 230, 31, 125, 147, 166, 65, 216, 63,
+	249, 186, 12, 255, 233, 6, 221, 63, 151, 112, 232, 45, 30, 222, 224, 63,
+	228, 103, 35, 215, 77, 41, 207, 63, 233, 242, 230, 112, 173, 246, 221, 63,
+	145, 124, 37, 144, 18, 59, 225, 63, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	114, 167, 116, 176, 254, 207, 201, 63, 40, 69, 43, 247, 2, 179, 202, 63,
+	200, 182, 12, 56, 75, 201, 224, 63, 206, 226, 197, 194, 16, 57, 211, 63,
+	156, 78, 178, 213, 229, 148, 212, 63, 47, 133, 7, 205, 174, 251, 224, 63,
+	18, 190, 247, 55, 104, 175, 218, 63, 96, 228, 101, 77, 44, 240, 219, 63,
+	88, 174, 183, 205, 84, 136, 208, 63, 31, 75, 31, 186, 160, 190, 214, 63,
+	32, 42, 141, 152, 217, 231, 201, 63, 197, 89, 17, 53, 209, 231, 211, 63,
+	164, 0, 81, 48, 99, 10, 229, 63, 118, 250, 65, 93, 164, 80, 222, 63,
+	68, 253, 46, 108, 205, 86, 218, 63, 226, 92, 195, 12, 141, 39, 206, 63,
+	232, 133, 59, 23, 70, 122, 203, 63, 61, 156, 192, 116, 90, 183, 218, 63,
+	154, 153, 153, 153, 153, 153, 233, 63, 0, 0, 0, 0, 0, 0, 240, 63,
+	22, 22, 220, 15, 120, 96, 202, 63, 36, 183, 38, 221, 150, 200, 208, 63,
+	62, 123, 46, 83, 147, 224, 214, 63, 184, 148, 243, 197, 222, 139, 221, 63,
+	101, 74, 144, 182, 150, 110, 171, 63, 157, 188, 200, 4, 252, 26, 216, 63,
+	113, 229, 236, 157, 209, 86, 216, 63, 162, 255, 47, 232, 206, 93, 164, 63,
+	53, 184, 173, 45, 60, 47, 219, 63, 253, 105, 163, 58, 29, 200, 219, 63,
+	57, 37, 32, 38, 225, 66, 196, 63, 167, 173, 17, 193, 56, 184, 218, 63,
+	144, 217, 89, 244, 78, 5, 223, 63, 167, 31, 212, 69, 10, 101, 193, 63,
+	235, 199, 38, 249, 17, 63, 227, 63, 222, 0, 51, 223, 193, 207, 230, 63,
+	19, 183, 10, 98, 160, 107, 212, 63, 75, 33, 144, 75, 28, 121, 224, 63,
+	82, 242, 234, 28, 3, 178, 218, 63, 0, 0, 0, 0, 0, 0, 0, 0,
+	25, 230, 4, 109, 114, 248, 226, 63, 106, 80, 52, 15, 96, 145, 211, 63,
+	216, 44, 151, 141, 206, 121, 225, 63, 178, 127, 158, 6, 12, 146, 213, 63,
+	147, 138, 198, 218, 223, 217, 218, 63, 118, 113, 27, 13, 224, 45, 215, 63,
+	0, 113, 87, 175, 34, 163, 199, 63, 100, 205, 200, 32, 119, 17, 212, 63,
+	24, 36, 125, 90, 69, 127, 221, 63, 146, 146, 30, 134, 86, 39, 223, 63,
+	121, 203, 213, 143, 77, 242, 219, 63, 164, 225, 148, 185, 249, 198, 224, 63,
+	146, 94, 212, 238, 87, 1, 212, 63, 156, 134, 168, 194, 159, 225, 218, 63,
+	160, 195, 124, 121, 1, 246, 217, 63, 126, 26, 247, 230, 55, 76, 218, 63,
+	100, 149, 210, 51, 189, 196, 192, 63, 12, 176, 143, 78, 93, 249, 218, 63,
+	238, 120, 147, 223, 162, 147, 215, 63, 120, 237, 210, 134, 195, 82, 226, 63,
+	33, 90, 43, 218, 28, 231, 219, 63, 244, 26, 187, 68, 245, 86, 224, 63,
+	254, 214, 78, 148, 132, 68, 215, 63, 212, 158, 146, 115, 98, 15, 226, 63,
+	181, 51, 76, 109, 169, 131, 220, 63, 178, 100, 142, 229, 93, 245, 206, 63,
+	8, 33, 32, 95, 66, 133, 224, 63, 2, 97, 167, 88, 53, 8, 222, 63,
+	179, 154, 174, 39, 186, 46, 222, 63, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	84, 89, 83, 86, 88, 71, 87, 85, 99, 75, 76, 107, 78, 51, 72, 90,
+	55, 77, 95, 46, 67, 69, 50, 53, 70, 44, 105, 47, 73, 49, 102, 104,
+	74, 63, 106, 33, 108, 109, 110, 114, 115, 116, 117, 118, 119, 120, 121, 122,
+	48, 52, 54, 57, 64, 65, 68, 79, 80, 81, 82, 97, 98, 100, 101, 103,
+	111, 112, 113, 56, 66, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 25, 228, 46, 194, 20, 229, 200, 63,
+	215, 35, 30, 154, 195, 255, 171, 63, 82, 162, 128, 72, 26, 55, 180, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 213, 79, 73, 231, 13, 65, 159, 63,
+	145, 97, 21, 111, 100, 30, 195, 63, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 64, 0, 0, 0, 0, 0, 0, 240, 63,
+	250, 237, 235, 192, 57, 227, 31, 64, 0, 0, 0, 0, 0, 0, 240, 63,
+	0, 0, 0, 0, 0, 0, 240, 63, 0, 0, 0, 0, 0, 0, 240, 63,
+	0, 0, 0, 0, 0, 0, 240, 63, 0, 0, 0, 0, 0, 0, 240, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 10, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 25, 228, 46, 194, 20, 229, 200, 63,
+	215, 35, 30, 154, 195, 255, 171, 63, 82, 162, 128, 72, 26, 55, 180, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 213, 79, 73, 231, 13, 65, 159, 63,
+	145, 97, 21, 111, 100, 30, 195, 63, 162, 255, 47, 232, 206, 93, 164, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 240, 63,
+	250, 237, 235, 192, 57, 227, 31, 64, 0, 0, 0, 0, 0, 0, 240, 63,
+	0, 0, 0, 0, 0, 0, 240, 63, 0, 0, 0, 0, 0, 0, 240, 63,
+	0, 0, 0, 0, 0, 0, 240, 63, 0, 0, 0, 0, 0, 0, 240, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 7, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 101, 222, 170, 235, 80, 77, 208, 63,
+	215, 35, 30, 154, 195, 255, 171, 63, 46, 199, 43, 16, 61, 41, 191, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 70, 7, 36, 97, 223, 78, 202, 63,
+	217, 94, 11, 122, 111, 12, 199, 63, 114, 167, 116, 176, 254, 207, 201, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 240, 63,
+	38, 223, 108, 115, 99, 122, 250, 63, 0, 0, 0, 0, 0, 0, 240, 63,
+	0, 0, 0, 0, 0, 0, 240, 63, 0, 0, 0, 0, 0, 0, 240, 63,
+	0, 0, 0, 0, 0, 0, 240, 63, 0, 0, 0, 0, 0, 0, 240, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 6, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 101, 222, 170, 235, 80, 77, 208, 63,
+	16, 93, 80, 223, 50, 167, 242, 63, 46, 199, 43, 16, 61, 41, 191, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 224, 46, 251, 117, 167, 59, 212, 63,
+	217, 94, 11, 122, 111, 12, 199, 63, 114, 167, 116, 176, 254, 207, 201, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 218, 30, 189, 225, 62, 114, 219, 63,
+	153, 245, 98, 40, 39, 90, 250, 63, 81, 191, 11, 91, 179, 21, 228, 63,
+	174, 154, 231, 136, 124, 151, 216, 63, 54, 171, 62, 87, 91, 49, 226, 63,
+	231, 143, 105, 109, 26, 219, 226, 63, 47, 133, 7, 205, 174, 251, 224, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 5, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 101, 222, 170, 235, 80, 77, 208, 63,
+	16, 93, 80, 223, 50, 167, 242, 63, 46, 199, 43, 16, 61, 41, 191, 63,
+	120, 238, 61, 92, 114, 220, 203, 63, 224, 46, 251, 117, 167, 59, 212, 63,
+	217, 94, 11, 122, 111, 12, 199, 63, 114, 167, 116, 176, 254, 207, 201, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 218, 30, 189, 225, 62, 114, 219, 63,
+	153, 245, 98, 40, 39, 90, 250, 63, 81, 191, 11, 91, 179, 21, 228, 63,
+	174, 154, 231, 136, 124, 151, 216, 63, 229, 13, 48, 243, 29, 252, 224, 63,
+	89, 135, 163, 171, 116, 119, 220, 63, 47, 133, 7, 205, 174, 251, 224, 63,
+	0, 0, 0, 0, 8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 9, 139, 138, 56, 157, 100, 210, 63,
+	168, 53, 205, 59, 78, 209, 245, 63, 118, 165, 101, 164, 222, 83, 213, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 250, 9, 103, 183, 150, 201, 217, 63,
+	92, 198, 77, 13, 52, 159, 221, 63, 32, 42, 141, 152, 217, 231, 201, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 52, 47, 135, 221, 119, 12, 218, 63,
+	162, 93, 133, 148, 159, 84, 250, 63, 22, 223, 80, 248, 108, 29, 226, 63,
+	33, 202, 23, 180, 144, 128, 209, 63, 54, 171, 62, 87, 91, 49, 226, 63,
+	231, 143, 105, 109, 26, 219, 226, 63, 31, 75, 31, 186, 160, 190, 214, 63,
+	8, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 142, 235, 223, 245, 153, 179, 210, 63,
+	215, 35, 30, 154, 195, 255, 171, 63, 204, 212, 36, 120, 67, 26, 207, 63,
+	83, 89, 20, 118, 81, 244, 218, 63, 70, 7, 36, 97, 223, 78, 202, 63,
+	217, 36, 63, 226, 87, 172, 205, 63, 232, 133, 59, 23, 70, 122, 203, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 240, 63,
+	38, 223, 108, 115, 99, 122, 250, 63, 0, 0, 0, 0, 0, 0, 240, 63,
+	0, 0, 0, 0, 0, 0, 240, 63, 0, 0, 0, 0, 0, 0, 240, 63,
+	0, 0, 0, 0, 0, 0, 240, 63, 0, 0, 0, 0, 0, 0, 240, 63,
+	12, 0, 0, 0, 8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 25, 228, 46, 194, 20, 229, 200, 63,
+	201, 60, 242, 7, 3, 207, 250, 63, 82, 162, 128, 72, 26, 55, 180, 63,
+	179, 125, 200, 91, 174, 126, 198, 63, 213, 79, 73, 231, 13, 65, 159, 63,
+	145, 97, 21, 111, 100, 30, 195, 63, 162, 255, 47, 232, 206, 93, 164, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 126, 87, 4, 255, 91, 73, 235, 63,
+	250, 237, 235, 192, 57, 227, 31, 64, 38, 142, 60, 16, 89, 164, 235, 63,
+	0, 0, 0, 0, 0, 0, 240, 63, 0, 0, 0, 0, 0, 0, 240, 63,
+	67, 114, 50, 113, 171, 32, 233, 63, 222, 0, 51, 223, 193, 207, 230, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 8, 0, 0, 0, 9, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 25, 228, 46, 194, 20, 229, 200, 63,
+	201, 60, 242, 7, 3, 207, 250, 63, 82, 162, 128, 72, 26, 55, 180, 63,
+	179, 125, 200, 91, 174, 126, 198, 63, 213, 79, 73, 231, 13, 65, 159, 63,
+	148, 162, 149, 123, 129, 89, 203, 63, 162, 255, 47, 232, 206, 93, 164, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 65, 69, 213, 175, 116, 62, 228, 63,
+	235, 28, 3, 178, 215, 59, 252, 63, 180, 5, 132, 214, 195, 151, 231, 63,
+	8, 28, 9, 52, 216, 84, 238, 63, 57, 240, 106, 185, 51, 147, 228, 63,
+	67, 114, 50, 113, 171, 32, 233, 63, 184, 148, 243, 197, 222, 139, 221, 63,
+	20, 0, 0, 0, 8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 7, 151, 142, 57, 207, 216, 210, 63,
+	51, 109, 255, 202, 74, 19, 253, 63, 45, 66, 177, 21, 52, 45, 201, 63,
+	240, 51, 46, 28, 8, 201, 208, 63, 185, 150, 127, 227, 33, 66, 180, 63,
+	145, 97, 21, 111, 100, 30, 195, 63, 167, 31, 212, 69, 10, 101, 193, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 126, 87, 4, 255, 91, 73, 235, 63,
+	250, 237, 235, 192, 57, 227, 31, 64, 38, 142, 60, 16, 89, 164, 235, 63,
+	0, 0, 0, 0, 0, 0, 240, 63, 0, 0, 0, 0, 0, 0, 240, 63,
+	222, 0, 51, 223, 193, 207, 230, 63, 222, 0, 51, 223, 193, 207, 230, 63,
+	28, 0, 0, 0, 8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 120, 207, 129, 229, 8, 25, 210, 63,
+	166, 66, 60, 18, 47, 79, 237, 63, 56, 103, 68, 105, 111, 240, 193, 63,
+	165, 162, 177, 246, 119, 182, 195, 63, 149, 15, 65, 213, 232, 213, 202, 63,
+	228, 103, 35, 215, 77, 41, 207, 63, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 64, 186, 247, 112, 201, 113, 39, 225, 63,
+	31, 162, 209, 29, 196, 206, 253, 63, 61, 186, 17, 22, 21, 241, 229, 63,
+	197, 26, 46, 114, 79, 87, 228, 63, 78, 124, 181, 163, 56, 199, 227, 63,
+	33, 86, 127, 132, 97, 192, 226, 63, 25, 230, 4, 109, 114, 248, 226, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 11, 0, 0, 0, 14, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 120, 207, 129, 229, 8, 25, 210, 63,
+	166, 66, 60, 18, 47, 79, 237, 63, 56, 103, 68, 105, 111, 240, 193, 63,
+	165, 162, 177, 246, 119, 182, 195, 63, 149, 15, 65, 213, 232, 213, 202, 63,
+	112, 94, 156, 248, 106, 71, 210, 63, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 240, 63, 186, 247, 112, 201, 113, 39, 225, 63,
+	31, 162, 209, 29, 196, 206, 253, 63, 61, 186, 17, 22, 21, 241, 229, 63,
+	16, 149, 70, 204, 236, 243, 226, 63, 78, 124, 181, 163, 56, 199, 227, 63,
+	33, 86, 127, 132, 97, 192, 226, 63, 25, 230, 4, 109, 114, 248, 226, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 12, 0, 0, 0, 13, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 120, 207, 129, 229, 8, 25, 210, 63,
+	59, 252, 53, 89, 163, 158, 241, 63, 203, 213, 143, 77, 242, 35, 196, 63,
+	165, 162, 177, 246, 119, 182, 195, 63, 238, 119, 40, 10, 244, 137, 214, 63,
+	112, 94, 156, 248, 106, 71, 210, 63, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 186, 247, 112, 201, 113, 39, 225, 63,
+	31, 162, 209, 29, 196, 206, 253, 63, 61, 186, 17, 22, 21, 241, 229, 63,
+	63, 196, 6, 11, 39, 105, 226, 63, 78, 124, 181, 163, 56, 199, 227, 63,
+	11, 123, 218, 225, 175, 201, 224, 63, 25, 230, 4, 109, 114, 248, 226, 63,
+	36, 0, 0, 0, 8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 220, 189, 220, 39, 71, 1, 212, 63,
+	166, 66, 60, 18, 47, 79, 237, 63, 56, 103, 68, 105, 111, 240, 193, 63,
+	101, 113, 255, 145, 233, 208, 213, 63, 149, 15, 65, 213, 232, 213, 202, 63,
+	59, 29, 200, 122, 106, 245, 211, 63, 0, 113, 87, 175, 34, 163, 199, 63,
+	0, 0, 0, 0, 0, 0, 240, 63, 157, 131, 103, 66, 147, 196, 221, 63,
+	245, 219, 215, 129, 115, 198, 249, 63, 147, 56, 43, 162, 38, 122, 225, 63,
+	16, 149, 70, 204, 236, 243, 226, 63, 226, 34, 247, 116, 117, 199, 224, 63,
+	33, 86, 127, 132, 97, 192, 226, 63, 164, 225, 148, 185, 249, 198, 224, 63,
+	44, 0, 0, 0, 8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 240, 63, 220, 242, 145, 148, 244, 48, 215, 63,
+	253, 130, 221, 176, 109, 209, 242, 63, 24, 153, 128, 95, 35, 73, 194, 63,
+	242, 40, 149, 240, 132, 94, 205, 63, 199, 243, 25, 80, 111, 70, 205, 63,
+	228, 103, 35, 215, 77, 41, 207, 63, 100, 149, 210, 51, 189, 196, 192, 63,
+	0, 0, 0, 0, 0, 0, 0, 64, 212, 155, 81, 243, 85, 242, 224, 63,
+	116, 94, 99, 151, 168, 222, 252, 63, 253, 102, 98, 186, 16, 43, 227, 63,
+	197, 26, 46, 114, 79, 87, 228, 63, 60, 250, 95, 174, 69, 139, 227, 63,
+	46, 228, 17, 220, 72, 89, 225, 63, 120, 237, 210, 134, 195, 82, 226, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 15, 0, 0, 0, 16, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 240, 63, 220, 242, 145, 148, 244, 48, 215, 63,
+	152, 192, 173, 187, 121, 42, 244, 63, 24, 153, 128, 95, 35, 73, 194, 63,
+	107, 216, 239, 137, 117, 170, 211, 63, 214, 228, 41, 171, 233, 122, 211, 63,
+	150, 37, 58, 203, 44, 66, 212, 63, 100, 149, 210, 51, 189, 196, 192, 63,
+	0, 0, 0, 0, 0, 0, 240, 63, 212, 155, 81, 243, 85, 242, 224, 63,
+	116, 94, 99, 151, 168, 222, 252, 63, 1, 167, 119, 241, 126, 220, 226, 63,
+	197, 26, 46, 114, 79, 87, 228, 63, 10, 44, 128, 41, 3, 7, 225, 63,
+	46, 228, 17, 220, 72, 89, 225, 63, 120, 237, 210, 134, 195, 82, 226, 63,
+	52, 0, 0, 0, 8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 240, 63, 156, 48, 97, 52, 43, 219, 219, 63,
+	253, 130, 221, 176, 109, 209, 242, 63, 192, 174, 38, 79, 89, 77, 205, 63,
+	242, 40, 149, 240, 132, 94, 205, 63, 199, 243, 25, 80, 111, 70, 205, 63,
+	228, 103, 35, 215, 77, 41, 207, 63, 178, 100, 142, 229, 93, 245, 206, 63,
+	0, 0, 0, 0, 0, 0, 0, 64, 141, 65, 39, 132, 14, 186, 224, 63,
+	33, 60, 218, 56, 98, 173, 251, 63, 253, 102, 98, 186, 16, 43, 227, 63,
+	73, 186, 102, 242, 205, 182, 225, 63, 60, 250, 95, 174, 69, 139, 227, 63,
+	145, 124, 37, 144, 18, 59, 225, 63, 212, 158, 146, 115, 98, 15, 226, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 17, 0, 0, 0, 18, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 240, 63, 156, 48, 97, 52, 43, 219, 219, 63,
+	253, 130, 221, 176, 109, 209, 242, 63, 158, 153, 96, 56, 215, 48, 210, 63,
+	242, 40, 149, 240, 132, 94, 205, 63, 199, 243, 25, 80, 111, 70, 205, 63,
+	230, 31, 125, 147, 166, 65, 216, 63, 254, 214, 78, 148, 132, 68, 215, 63,
+	0, 0, 0, 0, 0, 0, 240, 63, 27, 245, 16, 141, 238, 32, 223, 63,
+	33, 60, 218, 56, 98, 173, 251, 63, 181, 53, 34, 24, 7, 151, 222, 63,
+	73, 186, 102, 242, 205, 182, 225, 63, 126, 54, 114, 221, 148, 114, 225, 63,
+	239, 1, 186, 47, 103, 182, 224, 63, 212, 158, 146, 115, 98, 15, 226, 63,
+	60, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 240, 63, 166, 99, 206, 51, 246, 37, 220, 63,
+	67, 86, 183, 122, 78, 122, 243, 63, 192, 174, 38, 79, 89, 77, 205, 63,
+	221, 237, 122, 105, 138, 0, 220, 63, 169, 216, 152, 215, 17, 135, 220, 63,
+	228, 103, 35, 215, 77, 41, 207, 63, 178, 100, 142, 229, 93, 245, 206, 63,
+	0, 0, 0, 0, 0, 0, 0, 64, 141, 65, 39, 132, 14, 186, 224, 63,
+	240, 133, 201, 84, 193, 40, 251, 63, 253, 102, 98, 186, 16, 43, 227, 63,
+	150, 152, 103, 37, 173, 120, 224, 63, 60, 250, 95, 174, 69, 139, 227, 63,
+	145, 124, 37, 144, 18, 59, 225, 63, 8, 33, 32, 95, 66, 133, 224, 63,
+	64, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	33, 44, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 63, 64,
+	65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80,
+	81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 95, 97, 98, 99, 100, 101,
+	102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117,
+	118, 119, 120, 121, 122, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 192, 3, 0, 0, 192, 3, 0, 0, 192, 3, 0, 0, 192, 3, 0,
+	0, 192, 3, 0, 0, 192, 3, 0, 0, 192, 3, 0, 0, 192, 3, 0,
+	0, 192, 3, 0, 0, 192, 3, 0, 0, 192, 3, 0, 0, 192, 3, 0,
+	0, 192, 3, 0, 0, 192, 3, 0, 0, 192, 3, 0, 0, 192, 3, 0,
+	0, 192, 3, 0, 0, 192, 3, 0, 0, 192, 3, 0, 0, 192, 3, 0,
+	0, 192, 3, 0, 0, 192, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 192, 3, 0,
+	0, 192, 3, 0, 0, 192, 3, 0, 0, 192, 3, 0, 0, 192, 3, 0,
+	0, 240, 255, 3, 0, 240, 255, 3, 0, 240, 255, 3, 0, 240, 255, 3,
+	0, 240, 255, 3, 0, 240, 255, 3, 0, 240, 255, 3, 0, 240, 255, 3,
+	0, 240, 255, 3, 0, 240, 255, 3, 0, 240, 255, 3, 0, 240, 255, 3,
+	0, 240, 255, 3, 0, 240, 255, 0, 0, 248, 255, 0, 0, 252, 255, 0,
+	0, 252, 127, 0, 0, 252, 127, 0, 0, 252, 63, 0, 0, 252, 31, 0,
+	0, 254, 31, 0, 0, 254, 31, 0, 0, 254, 15, 0, 0, 254, 15, 0,
+	0, 254, 7, 0, 0, 254, 3, 0, 0, 255, 1, 0, 0, 255, 1, 0,
+	128, 255, 0, 0, 128, 255, 0, 0, 128, 127, 0, 0, 128, 127, 0, 0,
+	248, 255, 255, 31, 248, 255, 255, 31, 248, 255, 255, 31, 248, 255, 255, 31,
+	248, 255, 255, 31, 248, 255, 255, 31, 248, 255, 255, 31, 248, 255, 255, 31,
+	248, 255, 255, 31, 248, 255, 255, 31, 248, 255, 255, 31, 248, 255, 255, 31,
+	248, 255, 255, 31, 248, 255, 255, 31, 248, 255, 255, 31, 248, 255, 255, 31,
+	248, 255, 255, 31, 248, 255, 255, 31, 248, 255, 255, 31, 248, 255, 255, 31,
+	248, 255, 255, 31, 248, 255, 255, 31, 248, 255, 255, 31, 248, 255, 255, 31,
+	248, 255, 255, 31, 248, 255, 255, 31, 248, 255, 255, 31, 248, 255, 255, 31,
+	248, 255, 255, 31, 248, 255, 255, 31, 248, 255, 255, 31, 248, 255, 255, 31,
+	0, 0, 224, 1, 0, 0, 224, 0, 0, 0, 240, 0, 0, 0, 240, 0,
+	0, 0, 112, 0, 0, 0, 120, 0, 0, 0, 60, 0, 0, 0, 60, 0,
+	0, 0, 28, 0, 0, 0, 30, 0, 0, 0, 30, 0, 0, 0, 15, 0,
+	0, 0, 15, 0, 0, 128, 7, 0, 0, 128, 7, 0, 0, 192, 3, 0,
+	0, 192, 3, 0, 0, 224, 1, 0, 0, 224, 1, 0, 0, 224, 0, 0,
+	0, 240, 0, 0, 0, 112, 0, 0, 0, 120, 0, 0, 0, 56, 0, 0,
+	0, 60, 0, 0, 0, 60, 0, 0, 0, 30, 0, 0, 0, 30, 0, 0,
+	0, 15, 0, 0, 0, 15, 0, 0, 128, 7, 0, 0, 128, 7, 0, 0,
+	0, 224, 15, 0, 0, 248, 31, 0, 0, 252, 63, 0, 0, 254, 127, 0,
+	0, 30, 248, 0, 0, 15, 240, 0, 128, 15, 224, 1, 128, 7, 224, 1,
+	128, 7, 224, 1, 128, 7, 224, 1, 128, 7, 192, 3, 192, 3, 192, 3,
+	192, 3, 192, 3, 192, 131, 193, 3, 192, 195, 195, 3, 192, 227, 199, 3,
+	192, 227, 199, 3, 192, 195, 195, 3, 192, 131, 193, 3, 192, 3, 192, 3,
+	192, 3, 192, 3, 128, 7, 192, 3, 128, 7, 224, 3, 128, 7, 224, 1,
+	128, 7, 224, 1, 128, 15, 224, 1, 0, 15, 240, 0, 0, 31, 248, 0,
+	0, 62, 124, 0, 0, 252, 127, 0, 0, 248, 63, 0, 0, 240, 15, 0,
+	0, 240, 3, 0, 128, 255, 3, 0, 128, 255, 3, 0, 128, 255, 3, 0,
+	128, 207, 3, 0, 128, 193, 3, 0, 0, 192, 3, 0, 0, 192, 3, 0,
+	0, 192, 3, 0, 0, 192, 3, 0, 0, 192, 3, 0, 0, 192, 3, 0,
+	0, 192, 3, 0, 0, 192, 3, 0, 0, 192, 3, 0, 0, 192, 3, 0,
+	0, 192, 3, 0, 0, 192, 3, 0, 0, 192, 3, 0, 0, 192, 3, 0,
+	0, 192, 3, 0, 0, 192, 3, 0, 0, 192, 3, 0, 0, 192, 3, 0,
+	0, 192, 3, 0, 0, 192, 3, 0, 0, 192, 3, 0, 0, 192, 3, 0,
+	0, 192, 3, 0, 128, 255, 255, 1, 128, 255, 255, 1, 128, 255, 255, 1,
+	0, 248, 7, 0, 0, 255, 31, 0, 128, 255, 63, 0, 128, 255, 127, 0,
+	128, 7, 248, 0, 128, 0, 240, 1, 0, 0, 224, 1, 0, 0, 224, 3,
+	0, 0, 224, 3, 0, 0, 224, 3, 0, 0, 224, 3, 0, 0, 224, 1,
+	0, 0, 224, 1, 0, 0, 240, 0, 0, 0, 240, 0, 0, 0, 120, 0,
+	0, 0, 124, 0, 0, 0, 62, 0, 0, 0, 31, 0, 0, 128, 15, 0,
+	0, 128, 7, 0, 0, 224, 3, 0, 0, 224, 1, 0, 0, 240, 1, 0,
+	0, 248, 0, 0, 0, 124, 0, 0, 0, 62, 0, 0, 0, 31, 0, 0,
+	128, 15, 0, 0, 128, 255, 255, 3, 128, 255, 255, 3, 128, 255, 255, 3,
+	0, 248, 7, 0, 0, 255, 31, 0, 128, 255, 63, 0, 128, 255, 127, 0,
+	128, 1, 248, 0, 0, 0, 240, 0, 0, 0, 240, 1, 0, 0, 224, 1,
+	0, 0, 224, 1, 0, 0, 224, 1, 0, 0, 240, 1, 0, 0, 240, 0,
+	0, 0, 248, 0, 0, 240, 127, 0, 0, 240, 31, 0, 0, 240, 31, 0,
+	0, 240, 127, 0, 0, 0, 124, 0, 0, 0, 240, 1, 0, 0, 224, 1,
+	0, 0, 224, 1, 0, 0, 192, 3, 0, 0, 192, 3, 0, 0, 192, 3,
+	0, 0, 192, 3, 0, 0, 224, 3, 0, 0, 224, 1, 192, 0, 248, 1,
+	192, 7, 254, 0, 192, 255, 127, 0, 192, 255, 63, 0, 0, 255, 15, 0,
+	0, 0, 126, 0, 0, 0, 126, 0, 0, 0, 126, 0, 0, 0, 127, 0,
+	0, 128, 127, 0, 0, 192, 127, 0, 0, 192, 125, 0, 0, 224, 125, 0,
+	0, 224, 124, 0, 0, 112, 124, 0, 0, 120, 124, 0, 0, 60, 124, 0,
+	0, 60, 124, 0, 0, 28, 124, 0, 0, 30, 124, 0, 0, 15, 124, 0,
+	0, 7, 124, 0, 128, 7, 124, 0, 192, 3, 124, 0, 192, 3, 124, 0,
+	224, 1, 124, 0, 224, 255, 255, 7, 224, 255, 255, 7, 224, 255, 255, 7,
+	224, 255, 255, 7, 0, 0, 124, 0, 0, 0, 124, 0, 0, 0, 124, 0,
+	0, 0, 124, 0, 0, 0, 124, 0, 0, 0, 124, 0, 0, 0, 124, 0,
+	0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 127, 0,
+	0, 15, 0, 0, 0, 15, 0, 0, 0, 15, 0, 0, 0, 15, 0, 0,
+	0, 15, 0, 0, 0, 15, 0, 0, 0, 15, 0, 0, 0, 255, 15, 0,
+	0, 255, 63, 0, 0, 255, 127, 0, 0, 15, 254, 0, 0, 1, 248, 0,
+	0, 0, 240, 1, 0, 0, 224, 1, 0, 0, 224, 3, 0, 0, 192, 3,
+	0, 0, 192, 3, 0, 0, 192, 3, 0, 0, 192, 3, 0, 0, 192, 3,
+	0, 0, 224, 3, 0, 0, 224, 1, 0, 0, 240, 1, 128, 0, 248, 1,
+	128, 7, 254, 0, 128, 255, 127, 0, 128, 255, 63, 0, 0, 255, 15, 0,
+	0, 192, 63, 0, 0, 240, 255, 0, 0, 248, 255, 0, 0, 254, 255, 0,
+	0, 62, 128, 0, 0, 31, 0, 0, 0, 15, 0, 0, 128, 15, 0, 0,
+	128, 7, 0, 0, 128, 7, 0, 0, 128, 7, 0, 0, 192, 195, 15, 0,
+	192, 243, 63, 0, 192, 251, 127, 0, 192, 251, 255, 0, 192, 31, 240, 1,
+	192, 15, 224, 1, 192, 15, 224, 3, 192, 7, 192, 3, 192, 7, 192, 3,
+	192, 7, 192, 3, 192, 7, 192, 3, 128, 7, 192, 3, 128, 7, 192, 3,
+	128, 7, 192, 3, 128, 7, 224, 3, 128, 15, 224, 1, 0, 31, 240, 1,
+	0, 63, 248, 0, 0, 254, 255, 0, 0, 252, 127, 0, 0, 240, 31, 0,
+	192, 255, 255, 3, 192, 255, 255, 3, 192, 255, 255, 3, 192, 255, 255, 3,
+	0, 0, 224, 1, 0, 0, 224, 1, 0, 0, 240, 1, 0, 0, 240, 0,
+	0, 0, 248, 0, 0, 0, 248, 0, 0, 0, 120, 0, 0, 0, 124, 0,
+	0, 0, 60, 0, 0, 0, 60, 0, 0, 0, 30, 0, 0, 0, 30, 0,
+	0, 0, 31, 0, 0, 0, 15, 0, 0, 128, 15, 0, 0, 128, 15, 0,
+	0, 192, 7, 0, 0, 192, 7, 0, 0, 192, 7, 0, 0, 224, 3, 0,
+	0, 224, 3, 0, 0, 224, 1, 0, 0, 240, 1, 0, 0, 240, 1, 0,
+	0, 240, 0, 0, 0, 248, 0, 0, 0, 120, 0, 0, 0, 124, 0, 0,
+	0, 240, 15, 0, 0, 252, 63, 0, 0, 254, 127, 0, 0, 255, 255, 0,
+	0, 31, 240, 1, 128, 15, 224, 1, 128, 7, 224, 1, 128, 7, 224, 1,
+	128, 7, 224, 1, 128, 7, 224, 1, 128, 7, 224, 1, 0, 15, 224, 1,
+	0, 15, 240, 0, 0, 62, 124, 0, 0, 252, 63, 0, 0, 248, 31, 0,
+	0, 254, 127, 0, 0, 63, 248, 0, 128, 15, 240, 1, 128, 7, 224, 1,
+	128, 7, 192, 3, 192, 3, 192, 7, 192, 3, 192, 7, 192, 3, 192, 7,
+	192, 3, 192, 7, 192, 7, 192, 7, 128, 7, 224, 3, 128, 15, 240, 1,
+	0, 63, 248, 1, 0, 255, 255, 0, 0, 254, 127, 0, 0, 248, 31, 0,
+	0, 240, 15, 0, 0, 252, 31, 0, 0, 254, 63, 0, 0, 255, 127, 0,
+	128, 31, 248, 0, 128, 7, 240, 1, 128, 7, 224, 1, 192, 7, 224, 1,
+	192, 3, 224, 3, 192, 3, 224, 3, 192, 3, 224, 3, 192, 3, 224, 3,
+	192, 3, 224, 7, 192, 3, 224, 7, 128, 7, 224, 7, 128, 7, 240, 7,
+	128, 15, 248, 7, 0, 31, 252, 7, 0, 255, 223, 7, 0, 254, 223, 7,
+	0, 248, 199, 3, 0, 192, 193, 3, 0, 0, 192, 3, 0, 0, 224, 1,
+	0, 0, 224, 1, 0, 0, 240, 1, 0, 0, 240, 0, 0, 0, 248, 0,
+	0, 7, 127, 0, 0, 255, 63, 0, 0, 255, 31, 0, 0, 254, 7, 0,
+	0, 240, 15, 0, 0, 254, 31, 0, 0, 255, 127, 0, 0, 255, 127, 0,
+	0, 7, 248, 0, 0, 3, 240, 0, 0, 0, 240, 1, 0, 0, 240, 1,
+	0, 0, 240, 1, 0, 0, 240, 1, 0, 0, 248, 0, 0, 0, 124, 0,
+	0, 0, 62, 0, 0, 0, 63, 0, 0, 128, 15, 0, 0, 128, 7, 0,
+	0, 192, 7, 0, 0, 224, 3, 0, 0, 224, 1, 0, 0, 224, 1, 0,
+	0, 224, 1, 0, 0, 224, 1, 0, 0, 224, 1, 0, 0, 224, 1, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 224, 1, 0,
+	0, 224, 1, 0, 0, 224, 1, 0, 0, 224, 1, 0, 0, 224, 1, 0,
+	0, 128, 15, 0, 0, 224, 127, 0, 0, 248, 255, 0, 0, 252, 224, 1,
+	0, 62, 192, 3, 0, 15, 128, 3, 0, 7, 0, 3, 128, 3, 0, 7,
+	128, 3, 62, 7, 192, 131, 255, 7, 192, 193, 255, 7, 192, 225, 195, 7,
+	192, 225, 128, 7, 224, 225, 0, 7, 224, 225, 0, 7, 224, 225, 0, 7,
+	224, 225, 0, 7, 224, 225, 0, 7, 224, 225, 0, 7, 192, 225, 0, 7,
+	192, 193, 131, 7, 192, 129, 255, 7, 192, 131, 127, 7, 128, 3, 62, 6,
+	128, 7, 0, 0, 0, 7, 0, 0, 0, 15, 0, 0, 0, 62, 0, 0,
+	0, 124, 0, 0, 0, 248, 255, 0, 0, 224, 255, 0, 0, 128, 255, 0,
+	0, 224, 7, 0, 0, 224, 7, 0, 0, 224, 15, 0, 0, 224, 15, 0,
+	0, 240, 15, 0, 0, 240, 15, 0, 0, 112, 30, 0, 0, 120, 30, 0,
+	0, 120, 30, 0, 0, 120, 60, 0, 0, 60, 60, 0, 0, 60, 60, 0,
+	0, 60, 120, 0, 0, 62, 120, 0, 0, 30, 120, 0, 0, 30, 120, 0,
+	0, 31, 240, 0, 0, 31, 240, 0, 0, 15, 240, 0, 0, 15, 240, 1,
+	128, 15, 240, 1, 128, 255, 255, 1, 128, 255, 255, 3, 192, 255, 255, 3,
+	192, 7, 192, 3, 192, 3, 192, 3, 192, 3, 192, 7, 224, 3, 128, 7,
+	224, 1, 128, 15, 224, 1, 128, 15, 240, 1, 0, 15, 240, 0, 0, 15,
+	192, 255, 7, 0, 192, 255, 63, 0, 192, 255, 127, 0, 192, 255, 255, 0,
+	192, 3, 248, 1, 192, 3, 240, 1, 192, 3, 224, 1, 192, 3, 224, 3,
+	192, 3, 224, 3, 192, 3, 224, 3, 192, 3, 224, 3, 192, 3, 224, 1,
+	192, 3, 240, 1, 192, 255, 255, 0, 192, 255, 63, 0, 192, 255, 31, 0,
+	192, 255, 127, 0, 192, 3, 252, 0, 192, 3, 240, 1, 192, 3, 224, 3,
+	192, 3, 192, 3, 192, 3, 192, 7, 192, 3, 192, 7, 192, 3, 192, 7,
+	192, 3, 192, 7, 192, 3, 192, 7, 192, 3, 224, 3, 192, 3, 224, 3,
+	192, 3, 248, 1, 192, 255, 255, 1, 192, 255, 127, 0, 192, 255, 31, 0,
+	0, 128, 255, 0, 0, 224, 255, 3, 0, 240, 255, 3, 0, 248, 255, 3,
+	0, 124, 0, 3, 0, 62, 0, 0, 0, 30, 0, 0, 0, 15, 0, 0,
+	0, 15, 0, 0, 128, 15, 0, 0, 128, 7, 0, 0, 128, 7, 0, 0,
+	128, 7, 0, 0, 128, 7, 0, 0, 128, 7, 0, 0, 128, 7, 0, 0,
+	128, 7, 0, 0, 128, 7, 0, 0, 128, 7, 0, 0, 128, 7, 0, 0,
+	128, 7, 0, 0, 128, 7, 0, 0, 128, 7, 0, 0, 0, 15, 0, 0,
+	0, 15, 0, 0, 0, 31, 0, 0, 0, 30, 0, 0, 0, 62, 0, 3,
+	0, 252, 192, 3, 0, 248, 255, 3, 0, 240, 255, 3, 0, 128, 255, 0,
+	192, 255, 1, 0, 192, 255, 15, 0, 192, 255, 31, 0, 192, 255, 127, 0,
+	192, 3, 254, 0, 192, 3, 248, 0, 192, 3, 240, 1, 192, 3, 224, 1,
+	192, 3, 224, 3, 192, 3, 224, 3, 192, 3, 224, 3, 192, 3, 192, 3,
+	192, 3, 192, 7, 192, 3, 192, 7, 192, 3, 192, 7, 192, 3, 192, 7,
+	192, 3, 192, 7, 192, 3, 192, 7, 192, 3, 192, 7, 192, 3, 192, 7,
+	192, 3, 192, 7, 192, 3, 192, 3, 192, 3, 224, 3, 192, 3, 224, 3,
+	192, 3, 224, 3, 192, 3, 240, 1, 192, 3, 240, 1, 192, 3, 252, 0,
+	192, 3, 127, 0, 192, 255, 63, 0, 192, 255, 31, 0, 192, 255, 7, 0,
+	192, 255, 255, 3, 192, 255, 255, 3, 192, 255, 255, 3, 192, 255, 255, 3,
+	192, 7, 0, 0, 192, 7, 0, 0, 192, 7, 0, 0, 192, 7, 0, 0,
+	192, 7, 0, 0, 192, 7, 0, 0, 192, 7, 0, 0, 192, 7, 0, 0,
+	192, 7, 0, 0, 192, 255, 255, 1, 192, 255, 255, 1, 192, 255, 255, 1,
+	192, 255, 255, 1, 192, 7, 0, 0, 192, 7, 0, 0, 192, 7, 0, 0,
+	192, 7, 0, 0, 192, 7, 0, 0, 192, 7, 0, 0, 192, 7, 0, 0,
+	192, 7, 0, 0, 192, 7, 0, 0, 192, 7, 0, 0, 192, 7, 0, 0,
+	192, 7, 0, 0, 192, 255, 255, 3, 192, 255, 255, 3, 192, 255, 255, 3,
+	128, 255, 255, 3, 128, 255, 255, 3, 128, 255, 255, 3, 128, 255, 255, 3,
+	128, 7, 0, 0, 128, 7, 0, 0, 128, 7, 0, 0, 128, 7, 0, 0,
+	128, 7, 0, 0, 128, 7, 0, 0, 128, 7, 0, 0, 128, 7, 0, 0,
+	128, 7, 0, 0, 128, 255, 255, 0, 128, 255, 255, 0, 128, 255, 255, 0,
+	128, 255, 255, 0, 128, 7, 0, 0, 128, 7, 0, 0, 128, 7, 0, 0,
+	128, 7, 0, 0, 128, 7, 0, 0, 128, 7, 0, 0, 128, 7, 0, 0,
+	128, 7, 0, 0, 128, 7, 0, 0, 128, 7, 0, 0, 128, 7, 0, 0,
+	128, 7, 0, 0, 128, 7, 0, 0, 128, 7, 0, 0, 128, 7, 0, 0,
+	0, 192, 63, 0, 0, 240, 255, 0, 0, 248, 255, 3, 0, 252, 255, 3,
+	0, 62, 128, 3, 0, 31, 0, 2, 0, 15, 0, 0, 128, 15, 0, 0,
+	128, 7, 0, 0, 128, 7, 0, 0, 128, 7, 0, 0, 192, 7, 0, 0,
+	192, 3, 0, 0, 192, 3, 0, 0, 192, 3, 0, 0, 192, 3, 0, 0,
+	192, 3, 252, 7, 192, 3, 252, 7, 192, 3, 252, 7, 192, 3, 128, 7,
+	192, 3, 128, 7, 192, 7, 128, 7, 128, 7, 128, 7, 128, 7, 128, 7,
+	128, 7, 128, 7, 128, 15, 128, 7, 0, 15, 128, 7, 0, 31, 128, 7,
+	0, 126, 224, 7, 0, 252, 255, 7, 0, 248, 255, 1, 0, 192, 127, 0,
+	192, 3, 192, 3, 192, 3, 192, 3, 192, 3, 192, 3, 192, 3, 192, 3,
+	192, 3, 192, 3, 192, 3, 192, 3, 192, 3, 192, 3, 192, 3, 192, 3,
+	192, 3, 192, 3, 192, 3, 192, 3, 192, 3, 192, 3, 192, 3, 192, 3,
+	192, 3, 192, 3, 192, 255, 255, 3, 192, 255, 255, 3, 192, 255, 255, 3,
+	192, 255, 255, 3, 192, 3, 192, 3, 192, 3, 192, 3, 192, 3, 192, 3,
+	192, 3, 192, 3, 192, 3, 192, 3, 192, 3, 192, 3, 192, 3, 192, 3,
+	192, 3, 192, 3, 192, 3, 192, 3, 192, 3, 192, 3, 192, 3, 192, 3,
+	192, 3, 192, 3, 192, 3, 192, 3, 192, 3, 192, 3, 192, 3, 192, 3,
+	128, 255, 255, 1, 128, 255, 255, 1, 128, 255, 255, 1, 128, 255, 255, 1,
+	0, 192, 3, 0, 0, 192, 3, 0, 0, 192, 3, 0, 0, 192, 3, 0,
+	0, 192, 3, 0, 0, 192, 3, 0, 0, 192, 3, 0, 0, 192, 3, 0,
+	0, 192, 3, 0, 0, 192, 3, 0, 0, 192, 3, 0, 0, 192, 3, 0,
+	0, 192, 3, 0, 0, 192, 3, 0, 0, 192, 3, 0, 0, 192, 3, 0,
+	0, 192, 3, 0, 0, 192, 3, 0, 0, 192, 3, 0, 0, 192, 3, 0,
+	0, 192, 3, 0, 0, 192, 3, 0, 0, 192, 3, 0, 0, 192, 3, 0,
+	0, 192, 3, 0, 128, 255, 255, 1, 128, 255, 255, 1, 128, 255, 255, 1,
+	0, 224, 255, 1, 0, 224, 255, 1, 0, 224, 255, 1, 0, 224, 255, 1,
+	0, 0, 224, 1, 0, 0, 224, 1, 0, 0, 224, 1, 0, 0, 224, 1,
+	0, 0, 224, 1, 0, 0, 224, 1, 0, 0, 224, 1, 0, 0, 224, 1,
+	0, 0, 224, 1, 0, 0, 224, 1, 0, 0, 224, 1, 0, 0, 224, 1,
+	0, 0, 224, 1, 0, 0, 224, 1, 0, 0, 224, 1, 0, 0, 224, 1,
+	0, 0, 224, 1, 0, 0, 224, 1, 0, 0, 224, 1, 0, 0, 224, 1,
+	0, 0, 224, 1, 0, 0, 240, 1, 128, 1, 240, 0, 128, 3, 248, 0,
+	128, 31, 252, 0, 128, 255, 127, 0, 128, 255, 63, 0, 0, 252, 15, 0,
+	224, 1, 192, 7, 224, 1, 224, 3, 224, 1, 240, 1, 224, 1, 248, 0,
+	224, 1, 252, 0, 224, 1, 126, 0, 224, 1, 31, 0, 224, 129, 31, 0,
+	224, 129, 15, 0, 224, 193, 7, 0, 224, 225, 3, 0, 224, 241, 1, 0,
+	224, 249, 0, 0, 224, 125, 0, 0, 224, 255, 0, 0, 224, 255, 0, 0,
+	224, 255, 1, 0, 224, 231, 3, 0, 224, 227, 3, 0, 224, 193, 7, 0,
+	224, 129, 15, 0, 224, 1, 31, 0, 224, 1, 31, 0, 224, 1, 62, 0,
+	224, 1, 126, 0, 224, 1, 124, 0, 224, 1, 248, 0, 224, 1, 248, 1,
+	224, 1, 240, 1, 224, 1, 224, 3, 224, 1, 224, 3, 224, 1, 192, 15,
+	192, 3, 0, 0, 192, 3, 0, 0, 192, 3, 0, 0, 192, 3, 0, 0,
+	192, 3, 0, 0, 192, 3, 0, 0, 192, 3, 0, 0, 192, 3, 0, 0,
+	192, 3, 0, 0, 192, 3, 0, 0, 192, 3, 0, 0, 192, 3, 0, 0,
+	192, 3, 0, 0, 192, 3, 0, 0, 192, 3, 0, 0, 192, 3, 0, 0,
+	192, 3, 0, 0, 192, 3, 0, 0, 192, 3, 0, 0, 192, 3, 0, 0,
+	192, 3, 0, 0, 192, 3, 0, 0, 192, 3, 0, 0, 192, 3, 0, 0,
+	192, 3, 0, 0, 192, 3, 0, 0, 192, 3, 0, 0, 192, 3, 0, 0,
+	192, 3, 0, 0, 192, 255, 255, 3, 192, 255, 255, 3, 192, 255, 255, 3,
+	224, 7, 224, 15, 224, 7, 224, 15, 224, 15, 224, 15, 224, 15, 240, 15,
+	224, 15, 240, 15, 224, 31, 240, 15, 224, 29, 240, 15, 224, 29, 184, 15,
+	224, 57, 184, 15, 224, 57, 184, 15, 224, 57, 156, 15, 224, 113, 156, 15,
+	224, 113, 156, 15, 224, 113, 142, 15, 224, 225, 142, 15, 224, 225, 143, 15,
+	224, 225, 135, 15, 224, 225, 135, 15, 224, 193, 135, 15, 224, 193, 135, 15,
+	224, 129, 131, 15, 224, 1, 128, 15, 224, 1, 128, 15, 224, 1, 128, 15,
+	224, 1, 128, 15, 224, 1, 128, 15, 224, 1, 128, 15, 224, 1, 128, 15,
+	224, 1, 128, 15, 224, 1, 128, 15, 224, 1, 128, 15, 224, 1, 128, 15,
+	192, 15, 192, 3, 192, 15, 192, 3, 192, 15, 192, 3, 192, 31, 192, 3,
+	192, 31, 192, 3, 192, 63, 192, 3, 192, 63, 192, 3, 192, 59, 192, 3,
+	192, 123, 192, 3, 192, 115, 192, 3, 192, 243, 192, 3, 192, 243, 192, 3,
+	192, 227, 192, 3, 192, 227, 193, 3, 192, 227, 193, 3, 192, 195, 195, 3,
+	192, 195, 195, 3, 192, 131, 199, 3, 192, 131, 199, 3, 192, 3, 199, 3,
+	192, 3, 207, 3, 192, 3, 207, 3, 192, 3, 222, 3, 192, 3, 222, 3,
+	192, 3, 220, 3, 192, 3, 252, 3, 192, 3, 252, 3, 192, 3, 248, 3,
+	192, 3, 248, 3, 192, 3, 240, 3, 192, 3, 240, 3, 192, 3, 224, 3,
+	0, 240, 15, 0, 0, 248, 31, 0, 0, 252, 127, 0, 0, 254, 127, 0,
+	0, 31, 248, 0, 0, 15, 240, 1, 128, 15, 224, 1, 128, 7, 224, 1,
+	128, 7, 224, 3, 128, 7, 192, 3, 192, 3, 192, 3, 192, 3, 192, 7,
+	192, 3, 192, 7, 192, 3, 192, 7, 192, 3, 192, 7, 192, 3, 192, 7,
+	192, 3, 192, 7, 192, 3, 192, 7, 192, 3, 192, 7, 192, 3, 192, 7,
+	192, 3, 192, 7, 192, 3, 192, 3, 192, 7, 192, 3, 128, 7, 192, 3,
+	128, 7, 224, 3, 128, 7, 224, 1, 128, 15, 224, 1, 0, 31, 240, 0,
+	0, 63, 252, 0, 0, 254, 127, 0, 0, 252, 63, 0, 0, 240, 15, 0,
+	192, 255, 7, 0, 192, 255, 63, 0, 192, 255, 255, 0, 192, 255, 255, 0,
+	192, 3, 248, 1, 192, 3, 240, 3, 192, 3, 224, 3, 192, 3, 192, 3,
+	192, 3, 192, 3, 192, 3, 192, 3, 192, 3, 192, 3, 192, 3, 192, 3,
+	192, 3, 224, 3, 192, 3, 224, 3, 192, 3, 240, 3, 192, 3, 252, 1,
+	192, 255, 255, 0, 192, 255, 127, 0, 192, 255, 31, 0, 192, 255, 3, 0,
+	192, 3, 0, 0, 192, 3, 0, 0, 192, 3, 0, 0, 192, 3, 0, 0,
+	192, 3, 0, 0, 192, 3, 0, 0, 192, 3, 0, 0, 192, 3, 0, 0,
+	192, 3, 0, 0, 192, 3, 0, 0, 192, 3, 0, 0, 192, 3, 0, 0,
+	0, 224, 7, 0, 0, 248, 31, 0, 0, 252, 63, 0, 0, 62, 124, 0,
+	0, 30, 120, 0, 0, 15, 240, 0, 0, 15, 224, 0, 0, 15, 224, 0,
+	0, 15, 224, 1, 128, 7, 224, 1, 128, 7, 224, 1, 128, 7, 224, 1,
+	128, 7, 224, 1, 128, 7, 224, 1, 128, 7, 224, 1, 128, 7, 224, 1,
+	128, 7, 224, 1, 128, 7, 224, 1, 128, 7, 224, 1, 128, 15, 224, 1,
+	0, 15, 224, 1, 0, 15, 224, 0, 0, 15, 240, 0, 0, 30, 240, 0,
+	0, 62, 124, 0, 0, 252, 63, 0, 0, 248, 31, 0, 0, 224, 31, 0,
+	0, 0, 62, 0, 0, 0, 124, 0, 0, 0, 120, 0, 0, 0, 112, 0,
+	224, 255, 1, 0, 224, 255, 15, 0, 224, 255, 63, 0, 224, 255, 127, 0,
+	224, 1, 254, 0, 224, 1, 248, 0, 224, 1, 248, 0, 224, 1, 240, 0,
+	224, 1, 240, 1, 224, 1, 240, 1, 224, 1, 240, 1, 224, 1, 240, 0,
+	224, 1, 248, 0, 224, 1, 248, 0, 224, 1, 124, 0, 224, 255, 63, 0,
+	224, 255, 15, 0, 224, 255, 7, 0, 224, 255, 31, 0, 224, 1, 63, 0,
+	224, 1, 62, 0, 224, 1, 124, 0, 224, 1, 120, 0, 224, 1, 248, 0,
+	224, 1, 240, 0, 224, 1, 240, 1, 224, 1, 224, 1, 224, 1, 224, 3,
+	224, 1, 192, 3, 224, 1, 192, 7, 224, 1, 192, 7, 224, 1, 128, 15,
+	0, 240, 31, 0, 0, 252, 255, 0, 0, 254, 255, 0, 0, 255, 255, 0,
+	128, 31, 192, 0, 128, 7, 0, 0, 128, 7, 0, 0, 192, 3, 0, 0,
+	192, 3, 0, 0, 192, 3, 0, 0, 192, 7, 0, 0, 192, 7, 0, 0,
+	128, 31, 0, 0, 128, 127, 0, 0, 0, 255, 15, 0, 0, 254, 63, 0,
+	0, 248, 255, 0, 0, 224, 255, 0, 0, 0, 252, 1, 0, 0, 240, 1,
+	0, 0, 224, 3, 0, 0, 192, 3, 0, 0, 192, 3, 0, 0, 192, 3,
+	0, 0, 192, 3, 0, 0, 192, 3, 0, 0, 224, 3, 128, 1, 224, 1,
+	128, 15, 252, 1, 128, 255, 255, 0, 128, 255, 127, 0, 0, 254, 31, 0,
+	240, 255, 255, 15, 240, 255, 255, 15, 240, 255, 255, 15, 240, 255, 255, 15,
+	0, 192, 3, 0, 0, 192, 3, 0, 0, 192, 3, 0, 0, 192, 3, 0,
+	0, 192, 3, 0, 0, 192, 3, 0, 0, 192, 3, 0, 0, 192, 3, 0,
+	0, 192, 3, 0, 0, 192, 3, 0, 0, 192, 3, 0, 0, 192, 3, 0,
+	0, 192, 3, 0, 0, 192, 3, 0, 0, 192, 3, 0, 0, 192, 3, 0,
+	0, 192, 3, 0, 0, 192, 3, 0, 0, 192, 3, 0, 0, 192, 3, 0,
+	0, 192, 3, 0, 0, 192, 3, 0, 0, 192, 3, 0, 0, 192, 3, 0,
+	0, 192, 3, 0, 0, 192, 3, 0, 0, 192, 3, 0, 0, 192, 3, 0,
+	192, 3, 192, 3, 192, 3, 192, 3, 192, 3, 192, 3, 192, 3, 192, 3,
+	192, 3, 192, 3, 192, 3, 192, 3, 192, 3, 192, 3, 192, 3, 192, 3,
+	192, 3, 192, 3, 192, 3, 192, 3, 192, 3, 192, 3, 192, 3, 192, 3,
+	192, 3, 192, 3, 192, 3, 192, 3, 192, 3, 192, 3, 192, 3, 192, 3,
+	192, 3, 192, 3, 192, 3, 192, 3, 192, 3, 192, 3, 192, 3, 192, 3,
+	192, 3, 192, 3, 192, 3, 192, 3, 192, 3, 192, 3, 192, 3, 192, 3,
+	192, 3, 192, 3, 128, 7, 192, 3, 128, 7, 224, 1, 128, 15, 240, 1,
+	0, 63, 248, 0, 0, 254, 255, 0, 0, 252, 63, 0, 0, 240, 15, 0,
+	240, 1, 128, 15, 240, 1, 128, 15, 224, 1, 128, 15, 224, 3, 192, 7,
+	224, 3, 192, 7, 224, 3, 192, 3, 192, 3, 192, 3, 192, 3, 224, 3,
+	192, 7, 224, 3, 128, 7, 224, 1, 128, 7, 224, 1, 128, 15, 224, 0,
+	0, 15, 240, 0, 0, 15, 240, 0, 0, 15, 248, 0, 0, 31, 120, 0,
+	0, 30, 120, 0, 0, 30, 120, 0, 0, 30, 120, 0, 0, 62, 124, 0,
+	0, 60, 60, 0, 0, 60, 60, 0, 0, 56, 62, 0, 0, 120, 30, 0,
+	0, 120, 30, 0, 0, 120, 30, 0, 0, 240, 14, 0, 0, 240, 15, 0,
+	0, 240, 15, 0, 0, 224, 7, 0, 0, 224, 7, 0, 0, 224, 7, 0,
+	60, 0, 0, 15, 60, 0, 0, 15, 120, 0, 0, 15, 120, 0, 0, 15,
+	120, 0, 0, 15, 120, 0, 0, 15, 120, 0, 0, 15, 120, 0, 128, 15,
+	248, 0, 128, 7, 240, 224, 131, 7, 240, 224, 131, 7, 240, 224, 131, 7,
+	240, 240, 131, 7, 240, 240, 135, 7, 240, 240, 135, 3, 240, 112, 135, 3,
+	224, 56, 199, 3, 224, 56, 199, 3, 224, 57, 207, 3, 224, 57, 206, 3,
+	224, 57, 206, 3, 224, 61, 206, 1, 224, 29, 206, 1, 224, 29, 220, 1,
+	192, 31, 220, 1, 192, 31, 252, 1, 192, 15, 252, 1, 192, 15, 252, 0,
+	192, 15, 248, 0, 192, 15, 248, 0, 128, 15, 248, 0, 128, 7, 248, 32,
+	224, 3, 128, 15, 224, 3, 192, 15, 192, 7, 192, 7, 128, 7, 192, 3,
+	128, 15, 224, 3, 0, 15, 240, 1, 0, 30, 240, 0, 0, 62, 120, 0,
+	0, 62, 124, 0, 0, 124, 60, 0, 0, 120, 62, 0, 0, 240, 30, 0,
+	0, 240, 15, 0, 0, 224, 15, 0, 0, 224, 7, 0, 0, 224, 7, 0,
+	0, 224, 7, 0, 0, 240, 15, 0, 0, 240, 15, 0, 0, 248, 30, 0,
+	0, 120, 62, 0, 0, 60, 60, 0, 0, 62, 120, 0, 0, 30, 120, 0,
+	0, 31, 240, 0, 128, 15, 240, 1, 128, 15, 224, 1, 192, 7, 224, 3,
+	224, 3, 192, 7, 224, 3, 192, 7, 240, 1, 128, 15, 248, 0, 128, 15,
+	240, 1, 0, 15, 224, 1, 128, 15, 224, 3, 128, 7, 192, 3, 192, 7,
+	192, 7, 224, 3, 128, 15, 224, 3, 128, 15, 240, 1, 0, 31, 240, 0,
+	0, 30, 248, 0, 0, 62, 120, 0, 0, 60, 124, 0, 0, 124, 60, 0,
+	0, 120, 30, 0, 0, 240, 30, 0, 0, 240, 15, 0, 0, 224, 15, 0,
+	0, 224, 7, 0, 0, 192, 7, 0, 0, 192, 3, 0, 0, 192, 3, 0,
+	0, 192, 3, 0, 0, 192, 3, 0, 0, 192, 3, 0, 0, 192, 3, 0,
+	0, 192, 3, 0, 0, 192, 3, 0, 0, 192, 3, 0, 0, 192, 3, 0,
+	0, 192, 3, 0, 0, 192, 3, 0, 0, 192, 3, 0, 0, 192, 3, 0,
+	192, 255, 255, 7, 192, 255, 255, 7, 192, 255, 255, 7, 192, 255, 255, 7,
+	0, 0, 224, 3, 0, 0, 224, 1, 0, 0, 240, 1, 0, 0, 248, 0,
+	0, 0, 120, 0, 0, 0, 124, 0, 0, 0, 62, 0, 0, 0, 30, 0,
+	0, 0, 31, 0, 0, 128, 15, 0, 0, 128, 15, 0, 0, 192, 7, 0,
+	0, 224, 3, 0, 0, 224, 3, 0, 0, 240, 1, 0, 0, 240, 0, 0,
+	0, 248, 0, 0, 0, 124, 0, 0, 0, 60, 0, 0, 0, 62, 0, 0,
+	0, 31, 0, 0, 0, 15, 0, 0, 128, 7, 0, 0, 192, 7, 0, 0,
+	192, 3, 0, 0, 224, 255, 255, 7, 224, 255, 255, 7, 224, 255, 255, 7,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 255, 255, 255, 255,
+	255, 255, 255, 255, 255, 255, 255, 255, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 240, 15, 0, 0, 254, 127, 0, 192, 255, 255, 1, 192, 255, 255, 3,
+	192, 255, 255, 7, 192, 3, 224, 15, 64, 0, 192, 15, 0, 0, 128, 15,
+	0, 0, 128, 31, 0, 0, 0, 31, 0, 0, 0, 31, 0, 0, 0, 31,
+	0, 240, 255, 31, 0, 252, 255, 31, 128, 255, 255, 31, 192, 255, 255, 31,
+	224, 31, 128, 31, 224, 15, 0, 31, 240, 7, 0, 31, 240, 3, 0, 31,
+	240, 1, 0, 31, 240, 1, 128, 31, 240, 1, 128, 31, 240, 1, 192, 31,
+	240, 1, 192, 31, 240, 3, 224, 31, 240, 3, 240, 31, 224, 15, 252, 31,
+	224, 255, 127, 31, 192, 255, 63, 31, 128, 255, 31, 31, 0, 254, 7, 31,
+	128, 7, 0, 0, 128, 7, 0, 0, 128, 7, 0, 0, 128, 7, 0, 0,
+	128, 7, 0, 0, 128, 7, 0, 0, 128, 7, 0, 0, 128, 7, 0, 0,
+	128, 135, 3, 0, 128, 231, 31, 0, 128, 247, 63, 0, 128, 247, 127, 0,
+	128, 63, 252, 0, 128, 31, 240, 0, 128, 15, 240, 1, 128, 15, 224, 1,
+	128, 15, 224, 1, 128, 7, 192, 3, 128, 7, 192, 3, 128, 7, 192, 3,
+	128, 7, 192, 3, 128, 7, 192, 3, 128, 7, 192, 3, 128, 7, 224, 3,
+	128, 7, 224, 1, 128, 15, 224, 1, 128, 15, 224, 1, 128, 31, 240, 0,
+	128, 63, 252, 0, 128, 255, 127, 0, 128, 247, 63, 0, 128, 231, 31, 0,
+	0, 128, 127, 0, 0, 224, 255, 3, 0, 248, 255, 15, 0, 252, 255, 15,
+	0, 255, 255, 15, 0, 127, 0, 15, 128, 63, 0, 12, 192, 15, 0, 0,
+	192, 15, 0, 0, 224, 7, 0, 0, 224, 7, 0, 0, 224, 7, 0, 0,
+	224, 3, 0, 0, 240, 3, 0, 0, 240, 3, 0, 0, 240, 3, 0, 0,
+	240, 3, 0, 0, 240, 3, 0, 0, 240, 3, 0, 0, 240, 3, 0, 0,
+	224, 7, 0, 0, 224, 7, 0, 0, 224, 7, 0, 0, 192, 7, 0, 0,
+	192, 15, 0, 0, 128, 31, 0, 0, 128, 63, 0, 12, 0, 255, 128, 15,
+	0, 254, 255, 15, 0, 252, 255, 15, 0, 240, 255, 7, 0, 192, 255, 1,
+	0, 0, 192, 3, 0, 0, 192, 3, 0, 0, 192, 3, 0, 0, 192, 3,
+	0, 0, 192, 3, 0, 0, 192, 3, 0, 0, 192, 3, 0, 0, 192, 3,
+	0, 192, 193, 3, 0, 240, 199, 3, 0, 248, 207, 3, 0, 252, 223, 3,
+	0, 62, 252, 3, 0, 31, 240, 3, 0, 15, 240, 3, 0, 15, 224, 3,
+	0, 15, 224, 3, 128, 7, 192, 3, 128, 7, 192, 3, 128, 7, 192, 3,
+	128, 7, 192, 3, 128, 7, 192, 3, 128, 7, 192, 3, 128, 7, 224, 3,
+	128, 7, 224, 3, 0, 15, 224, 3, 0, 15, 224, 3, 0, 31, 240, 3,
+	0, 62, 252, 3, 0, 252, 255, 3, 0, 248, 223, 3, 0, 240, 199, 3,
+	0, 192, 31, 0, 0, 248, 127, 0, 0, 254, 255, 0, 128, 255, 255, 3,
+	128, 255, 255, 7, 192, 31, 224, 7, 224, 7, 192, 15, 224, 3, 128, 15,
+	240, 3, 0, 31, 240, 1, 0, 31, 248, 1, 0, 31, 248, 0, 0, 63,
+	248, 0, 0, 63, 252, 255, 255, 63, 252, 255, 255, 63, 252, 255, 255, 63,
+	252, 255, 255, 63, 252, 255, 255, 63, 252, 0, 0, 0, 252, 0, 0, 0,
+	248, 0, 0, 0, 248, 0, 0, 0, 240, 1, 0, 0, 240, 1, 0, 0,
+	240, 3, 0, 0, 224, 7, 0, 0, 224, 15, 0, 12, 192, 63, 224, 15,
+	128, 255, 255, 15, 0, 255, 255, 15, 0, 252, 255, 7, 0, 240, 255, 0,
+	0, 0, 252, 1, 0, 128, 255, 1, 0, 128, 255, 1, 0, 192, 255, 1,
+	0, 192, 3, 0, 0, 224, 3, 0, 0, 224, 1, 0, 0, 224, 1, 0,
+	0, 224, 1, 0, 128, 255, 255, 1, 128, 255, 255, 1, 128, 255, 255, 1,
+	128, 255, 255, 1, 0, 224, 1, 0, 0, 224, 1, 0, 0, 224, 1, 0,
+	0, 224, 1, 0, 0, 224, 1, 0, 0, 224, 1, 0, 0, 224, 1, 0,
+	0, 224, 1, 0, 0, 224, 1, 0, 0, 224, 1, 0, 0, 224, 1, 0,
+	0, 224, 1, 0, 0, 224, 1, 0, 0, 224, 1, 0, 0, 224, 1, 0,
+	0, 224, 1, 0, 0, 224, 1, 0, 0, 224, 1, 0, 0, 224, 1, 0,
+	0, 240, 199, 3, 0, 248, 207, 3, 0, 252, 223, 3, 0, 254, 255, 3,
+	0, 31, 240, 3, 0, 15, 240, 3, 0, 15, 224, 3, 128, 7, 224, 3,
+	128, 7, 224, 3, 128, 7, 192, 3, 128, 7, 192, 3, 128, 7, 192, 3,
+	128, 7, 192, 3, 128, 7, 192, 3, 128, 7, 192, 3, 128, 7, 224, 3,
+	128, 15, 224, 3, 0, 15, 224, 3, 0, 31, 240, 3, 0, 62, 248, 3,
+	0, 254, 255, 3, 0, 252, 207, 3, 0, 248, 199, 3, 0, 192, 195, 3,
+	0, 0, 192, 3, 0, 0, 224, 1, 0, 0, 224, 1, 0, 4, 240, 1,
+	0, 30, 248, 0, 0, 254, 255, 0, 0, 254, 127, 0, 0, 248, 31, 0,
+	128, 7, 0, 0, 128, 7, 0, 0, 128, 7, 0, 0, 128, 7, 0, 0,
+	128, 7, 0, 0, 128, 7, 0, 0, 128, 7, 0, 0, 128, 7, 0, 0,
+	128, 7, 0, 0, 128, 199, 31, 0, 128, 231, 63, 0, 128, 247, 127, 0,
+	128, 63, 252, 0, 128, 31, 240, 0, 128, 15, 240, 1, 128, 15, 224, 1,
+	128, 15, 224, 1, 128, 7, 224, 1, 128, 7, 224, 1, 128, 7, 224, 1,
+	128, 7, 224, 1, 128, 7, 224, 1, 128, 7, 224, 1, 128, 7, 224, 1,
+	128, 7, 224, 1, 128, 7, 224, 1, 128, 7, 224, 1, 128, 7, 224, 1,
+	128, 7, 224, 1, 128, 7, 224, 1, 128, 7, 224, 1, 128, 7, 224, 1,
+	0, 192, 3, 0, 0, 192, 3, 0, 0, 192, 3, 0, 0, 192, 3, 0,
+	0, 192, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 255, 3, 0, 0, 255, 3, 0, 0, 255, 3, 0,
+	0, 254, 3, 0, 0, 192, 3, 0, 0, 192, 3, 0, 0, 192, 3, 0,
+	0, 192, 3, 0, 0, 192, 3, 0, 0, 192, 3, 0, 0, 192, 3, 0,
+	0, 192, 3, 0, 0, 192, 3, 0, 0, 192, 3, 0, 0, 192, 3, 0,
+	0, 192, 3, 0, 0, 192, 3, 0, 0, 192, 3, 0, 0, 192, 3, 0,
+	0, 192, 3, 0, 128, 255, 255, 3, 128, 255, 255, 3, 128, 255, 255, 3,
+	0, 0, 28, 0, 0, 0, 28, 0, 0, 0, 28, 0, 0, 0, 28, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 224, 31, 0,
+	0, 224, 31, 0, 0, 224, 31, 0, 0, 0, 28, 0, 0, 0, 28, 0,
+	0, 0, 28, 0, 0, 0, 28, 0, 0, 0, 28, 0, 0, 0, 28, 0,
+	0, 0, 28, 0, 0, 0, 28, 0, 0, 0, 28, 0, 0, 0, 28, 0,
+	0, 0, 28, 0, 0, 0, 28, 0, 0, 0, 28, 0, 0, 0, 28, 0,
+	0, 0, 28, 0, 0, 0, 28, 0, 0, 0, 28, 0, 0, 0, 28, 0,
+	0, 0, 30, 0, 0, 0, 15, 0, 0, 248, 7, 0, 0, 248, 3, 0,
+	128, 7, 0, 0, 128, 7, 0, 0, 128, 7, 0, 0, 128, 7, 0, 0,
+	128, 7, 0, 0, 128, 7, 0, 0, 128, 7, 0, 0, 128, 7, 0, 0,
+	128, 7, 0, 0, 128, 7, 240, 0, 128, 7, 248, 0, 128, 7, 124, 0,
+	128, 7, 62, 0, 128, 7, 31, 0, 128, 135, 15, 0, 128, 199, 3, 0,
+	128, 231, 1, 0, 128, 247, 0, 0, 128, 255, 0, 0, 128, 255, 1, 0,
+	128, 255, 3, 0, 128, 207, 3, 0, 128, 199, 7, 0, 128, 135, 15, 0,
+	128, 7, 31, 0, 128, 7, 30, 0, 128, 7, 62, 0, 128, 7, 124, 0,
+	128, 7, 120, 0, 128, 7, 240, 0, 128, 7, 240, 1, 128, 7, 224, 3,
+	128, 255, 1, 0, 128, 255, 1, 0, 128, 255, 1, 0, 0, 255, 1, 0,
+	0, 224, 1, 0, 0, 224, 1, 0, 0, 224, 1, 0, 0, 224, 1, 0,
+	0, 224, 1, 0, 0, 224, 1, 0, 0, 224, 1, 0, 0, 224, 1, 0,
+	0, 224, 1, 0, 0, 224, 1, 0, 0, 224, 1, 0, 0, 224, 1, 0,
+	0, 224, 1, 0, 0, 224, 1, 0, 0, 224, 1, 0, 0, 224, 1, 0,
+	0, 224, 1, 0, 0, 224, 1, 0, 0, 224, 1, 0, 0, 224, 1, 0,
+	0, 224, 1, 0, 0, 224, 1, 0, 0, 192, 1, 0, 0, 192, 3, 0,
+	0, 192, 7, 0, 0, 128, 255, 1, 0, 128, 255, 1, 0, 0, 254, 1,
+	0, 60, 224, 3, 124, 255, 240, 15, 252, 255, 249, 15, 252, 255, 253, 31,
+	252, 255, 255, 31, 252, 240, 15, 63, 124, 224, 7, 62, 124, 192, 7, 62,
+	124, 192, 7, 60, 124, 192, 7, 124, 124, 192, 7, 124, 124, 192, 7, 124,
+	124, 192, 7, 124, 124, 192, 7, 124, 124, 192, 7, 124, 124, 192, 7, 124,
+	124, 192, 7, 124, 124, 192, 7, 124, 124, 192, 7, 124, 124, 192, 7, 124,
+	124, 192, 7, 124, 124, 192, 7, 124, 124, 192, 7, 124, 124, 192, 7, 124,
+	124, 192, 7, 124, 124, 192, 7, 124, 124, 192, 7, 124, 124, 192, 7, 124,
+	124, 192, 7, 124, 124, 192, 7, 124, 124, 192, 7, 124, 124, 192, 7, 124,
+	0, 128, 63, 0, 240, 195, 255, 0, 240, 243, 255, 1, 240, 251, 255, 3,
+	240, 255, 255, 3, 240, 63, 248, 7, 240, 15, 224, 7, 240, 7, 192, 15,
+	240, 7, 192, 15, 240, 3, 128, 15, 240, 3, 128, 15, 240, 3, 128, 15,
+	240, 3, 128, 15, 240, 3, 128, 15, 240, 3, 128, 15, 240, 3, 128, 15,
+	240, 3, 128, 15, 240, 3, 128, 15, 240, 3, 128, 15, 240, 3, 128, 15,
+	240, 3, 128, 15, 240, 3, 128, 15, 240, 3, 128, 15, 240, 3, 128, 15,
+	240, 3, 128, 15, 240, 3, 128, 15, 240, 3, 128, 15, 240, 3, 128, 15,
+	240, 3, 128, 15, 240, 3, 128, 15, 240, 3, 128, 15, 240, 3, 128, 15,
+	0, 224, 15, 0, 0, 252, 63, 0, 0, 255, 255, 0, 128, 255, 255, 1,
+	192, 255, 255, 3, 192, 31, 240, 7, 224, 7, 224, 7, 224, 7, 192, 15,
+	240, 3, 128, 15, 240, 3, 128, 15, 240, 1, 128, 31, 240, 1, 0, 31,
+	248, 1, 0, 31, 248, 1, 0, 31, 248, 0, 0, 31, 248, 0, 0, 31,
+	248, 0, 0, 31, 248, 0, 0, 31, 248, 0, 0, 31, 248, 1, 0, 31,
+	248, 1, 0, 31, 240, 1, 128, 31, 240, 1, 128, 15, 240, 3, 128, 15,
+	240, 3, 192, 15, 224, 7, 192, 15, 224, 7, 224, 7, 192, 63, 248, 7,
+	128, 255, 255, 3, 0, 255, 255, 1, 0, 254, 255, 0, 0, 248, 63, 0,
+	0, 192, 15, 0, 128, 231, 31, 0, 128, 247, 63, 0, 128, 255, 127, 0,
+	128, 31, 248, 0, 128, 15, 240, 0, 128, 15, 224, 1, 128, 7, 224, 1,
+	128, 7, 224, 3, 128, 7, 192, 3, 128, 7, 192, 3, 128, 7, 192, 3,
+	128, 7, 192, 3, 128, 7, 192, 3, 128, 7, 192, 3, 128, 7, 224, 3,
+	128, 7, 224, 1, 128, 15, 224, 1, 128, 15, 224, 1, 128, 31, 240, 0,
+	128, 63, 248, 0, 128, 255, 127, 0, 128, 247, 63, 0, 128, 231, 31, 0,
+	128, 7, 0, 0, 128, 7, 0, 0, 128, 7, 0, 0, 128, 7, 0, 0,
+	128, 7, 0, 0, 128, 7, 0, 0, 128, 7, 0, 0, 128, 7, 0, 0,
+	0, 224, 3, 0, 0, 248, 207, 3, 0, 252, 223, 3, 0, 254, 255, 3,
+	0, 31, 248, 3, 0, 15, 240, 3, 128, 15, 224, 3, 128, 7, 224, 3,
+	128, 7, 224, 3, 128, 7, 192, 3, 128, 7, 192, 3, 128, 7, 192, 3,
+	128, 7, 192, 3, 128, 7, 192, 3, 128, 7, 192, 3, 128, 7, 224, 3,
+	128, 7, 224, 3, 128, 7, 224, 3, 128, 15, 240, 3, 0, 31, 240, 3,
+	0, 62, 252, 3, 0, 252, 255, 3, 0, 252, 207, 3, 0, 240, 199, 3,
+	0, 0, 192, 3, 0, 0, 192, 3, 0, 0, 192, 3, 0, 0, 192, 3,
+	0, 0, 192, 3, 0, 0, 192, 3, 0, 0, 192, 3, 0, 0, 192, 3,
+	0, 0, 252, 0, 224, 7, 255, 3, 224, 199, 255, 7, 224, 231, 255, 7,
+	224, 247, 255, 7, 224, 247, 1, 7, 224, 63, 0, 4, 224, 31, 0, 0,
+	224, 31, 0, 0, 224, 15, 0, 0, 224, 15, 0, 0, 224, 7, 0, 0,
+	224, 7, 0, 0, 224, 7, 0, 0, 224, 7, 0, 0, 224, 7, 0, 0,
+	224, 7, 0, 0, 224, 7, 0, 0, 224, 7, 0, 0, 224, 7, 0, 0,
+	224, 7, 0, 0, 224, 7, 0, 0, 224, 7, 0, 0, 224, 7, 0, 0,
+	224, 7, 0, 0, 224, 7, 0, 0, 224, 7, 0, 0, 224, 7, 0, 0,
+	224, 7, 0, 0, 224, 7, 0, 0, 224, 7, 0, 0, 224, 7, 0, 0,
+	0, 224, 31, 0, 0, 252, 255, 0, 0, 255, 255, 3, 128, 255, 255, 3,
+	192, 255, 255, 3, 192, 15, 128, 3, 224, 7, 0, 2, 224, 7, 0, 0,
+	224, 3, 0, 0, 224, 3, 0, 0, 224, 7, 0, 0, 224, 7, 0, 0,
+	192, 31, 0, 0, 192, 127, 0, 0, 128, 255, 31, 0, 0, 255, 255, 0,
+	0, 252, 255, 1, 0, 248, 255, 3, 0, 0, 254, 7, 0, 0, 240, 7,
+	0, 0, 224, 15, 0, 0, 192, 15, 0, 0, 192, 15, 0, 0, 192, 15,
+	0, 0, 192, 15, 0, 0, 224, 7, 224, 0, 224, 7, 224, 15, 248, 3,
+	224, 255, 255, 3, 224, 255, 255, 1, 224, 255, 127, 0, 0, 255, 63, 0,
+	0, 224, 1, 0, 0, 224, 1, 0, 0, 224, 1, 0, 0, 224, 1, 0,
+	0, 224, 1, 0, 0, 224, 1, 0, 0, 224, 1, 0, 192, 255, 255, 3,
+	192, 255, 255, 3, 192, 255, 255, 3, 192, 255, 255, 3, 0, 224, 1, 0,
+	0, 224, 1, 0, 0, 224, 1, 0, 0, 224, 1, 0, 0, 224, 1, 0,
+	0, 224, 1, 0, 0, 224, 1, 0, 0, 224, 1, 0, 0, 224, 1, 0,
+	0, 224, 1, 0, 0, 224, 1, 0, 0, 224, 1, 0, 0, 224, 1, 0,
+	0, 224, 1, 0, 0, 224, 1, 0, 0, 224, 1, 0, 0, 224, 3, 0,
+	0, 192, 7, 0, 0, 192, 255, 3, 0, 128, 255, 3, 0, 0, 255, 3,
+	240, 3, 128, 15, 240, 3, 128, 15, 240, 3, 128, 15, 240, 3, 128, 15,
+	240, 3, 128, 15, 240, 3, 128, 15, 240, 3, 128, 15, 240, 3, 128, 15,
+	240, 3, 128, 15, 240, 3, 128, 15, 240, 3, 128, 15, 240, 3, 128, 15,
+	240, 3, 128, 15, 240, 3, 128, 15, 240, 3, 128, 15, 240, 3, 128, 15,
+	240, 3, 128, 15, 240, 3, 128, 15, 240, 3, 128, 15, 240, 3, 128, 15,
+	240, 3, 128, 15, 240, 3, 128, 15, 240, 3, 128, 15, 240, 3, 192, 15,
+	224, 7, 192, 15, 224, 7, 224, 15, 192, 15, 240, 15, 192, 31, 248, 15,
+	192, 255, 191, 15, 128, 255, 159, 15, 0, 255, 143, 15, 0, 254, 131, 15,
+	124, 0, 0, 126, 124, 0, 0, 126, 252, 0, 0, 62, 252, 0, 0, 63,
+	248, 0, 0, 31, 248, 0, 0, 31, 240, 1, 128, 31, 240, 1, 128, 15,
+	224, 3, 128, 15, 224, 3, 128, 15, 224, 3, 192, 7, 224, 7, 192, 7,
+	192, 7, 224, 7, 192, 7, 224, 3, 192, 15, 224, 3, 128, 15, 240, 3,
+	128, 15, 240, 1, 128, 31, 248, 1, 128, 31, 248, 0, 0, 31, 248, 0,
+	0, 63, 252, 0, 0, 62, 252, 0, 0, 126, 124, 0, 0, 126, 126, 0,
+	0, 124, 126, 0, 0, 252, 62, 0, 0, 248, 63, 0, 0, 248, 31, 0,
+	0, 248, 31, 0, 0, 240, 31, 0, 0, 240, 15, 0, 0, 224, 15, 0,
+	0, 0, 0, 0, 31, 0, 0, 240, 31, 0, 0, 248, 30, 0, 0, 248,
+	62, 0, 0, 248, 62, 0, 0, 248, 60, 0, 0, 124, 124, 0, 0, 124,
+	124, 0, 0, 124, 124, 0, 0, 124, 124, 192, 7, 62, 124, 192, 7, 62,
+	248, 224, 7, 62, 248, 224, 15, 62, 248, 224, 15, 30, 240, 240, 15, 30,
+	240, 240, 14, 31, 240, 241, 14, 31, 240, 113, 30, 15, 240, 113, 28, 15,
+	224, 121, 156, 15, 224, 57, 188, 15, 224, 57, 184, 15, 224, 63, 184, 7,
+	192, 63, 248, 7, 192, 31, 248, 7, 192, 31, 240, 3, 192, 31, 240, 3,
+	192, 31, 240, 3, 128, 15, 224, 3, 128, 15, 224, 3, 0, 0, 0, 0,
+	252, 0, 0, 63, 248, 1, 0, 63, 240, 1, 128, 31, 240, 3, 128, 15,
+	224, 7, 192, 7, 192, 15, 224, 7, 128, 15, 240, 3, 128, 31, 240, 1,
+	0, 63, 248, 0, 0, 127, 252, 0, 0, 126, 126, 0, 0, 252, 127, 0,
+	0, 248, 31, 0, 0, 248, 31, 0, 0, 240, 15, 0, 0, 192, 7, 0,
+	0, 224, 15, 0, 0, 240, 15, 0, 0, 248, 31, 0, 0, 248, 63, 0,
+	0, 252, 126, 0, 0, 126, 124, 0, 0, 127, 252, 0, 0, 63, 248, 1,
+	128, 15, 240, 3, 192, 15, 240, 7, 224, 7, 224, 7, 224, 7, 192, 15,
+	240, 3, 128, 31, 248, 1, 128, 63, 252, 0, 0, 63, 126, 0, 0, 126,
+	224, 3, 128, 7, 192, 3, 128, 7, 192, 3, 192, 3, 128, 7, 192, 3,
+	128, 7, 224, 1, 128, 15, 224, 1, 0, 15, 224, 1, 0, 15, 240, 0,
+	0, 30, 240, 0, 0, 30, 248, 0, 0, 30, 120, 0, 0, 60, 120, 0,
+	0, 60, 60, 0, 0, 60, 60, 0, 0, 120, 60, 0, 0, 120, 30, 0,
+	0, 240, 30, 0, 0, 240, 31, 0, 0, 224, 15, 0, 0, 224, 15, 0,
+	0, 224, 7, 0, 0, 192, 7, 0, 0, 192, 7, 0, 0, 192, 3, 0,
+	0, 192, 3, 0, 0, 224, 3, 0, 0, 224, 1, 0, 0, 240, 1, 0,
+	0, 248, 0, 0, 128, 127, 0, 0, 128, 127, 0, 0, 128, 63, 0, 0,
+	224, 255, 255, 15, 224, 255, 255, 15, 224, 255, 255, 15, 224, 255, 255, 15,
+	224, 255, 255, 15, 0, 0, 192, 15, 0, 0, 192, 7, 0, 0, 240, 3,
+	0, 0, 248, 3, 0, 0, 252, 1, 0, 0, 252, 0, 0, 0, 126, 0,
+	0, 0, 63, 0, 0, 128, 63, 0, 0, 128, 31, 0, 0, 192, 15, 0,
+	0, 224, 7, 0, 0, 240, 3, 0, 0, 248, 3, 0, 0, 248, 1, 0,
+	0, 252, 0, 0, 0, 126, 0, 0, 0, 127, 0, 0, 128, 63, 0, 0,
+	192, 15, 0, 0, 192, 15, 0, 0, 224, 7, 0, 0, 240, 3, 0, 0,
+	240, 255, 255, 15, 240, 255, 255, 15, 240, 255, 255, 15, 240, 255, 255, 15,
+	33, 44, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 63, 64,
+	65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80,
+	81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 95, 97, 98, 99, 100, 101,
+	102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117,
+	118, 119, 120, 121, 122, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	4, 4, 255, 255, 255, 255, 255, 255, 255, 255, 191, 191, 191, 191, 172, 172,
+	172, 172, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 4, 4, 0, 200, 255, 255, 2, 202, 255, 228, 63, 247, 248, 61,
+	192, 249, 71, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 4, 4, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 255, 255, 255, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 4, 4, 0, 0, 43, 146, 0, 22, 171, 10,
+	7, 169, 27, 0, 151, 52, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 104, 132, 121, 115, 210, 34,
+	38, 186, 210, 41, 41, 187, 109, 125, 115, 117, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 128, 176, 138, 0,
+	0, 97, 138, 0, 0, 97, 138, 0, 97, 160, 184, 102, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 122, 112,
+	121, 136, 0, 0, 25, 185, 0, 73, 146, 18, 175, 182, 100, 100, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4,
+	93, 107, 124, 126, 0, 70, 107, 132, 0, 20, 50, 182, 110, 100, 114, 147,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	4, 4, 0, 38, 208, 67, 26, 134, 123, 67, 197, 88, 164, 128, 22, 22,
+	134, 83, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 4, 4, 189, 133, 109, 61, 171, 116, 122, 56, 0, 0, 6, 208,
+	116, 100, 115, 137, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 4, 4, 86, 141, 105, 68, 215, 99, 108, 67, 244, 16,
+	0, 187, 112, 128, 104, 140, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 4, 4, 111, 111, 124, 210, 0, 0, 148, 64,
+	0, 53, 164, 0, 4, 190, 25, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 131, 123, 115, 135, 129, 98,
+	88, 131, 179, 52, 44, 169, 151, 111, 105, 150, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 140, 118, 122, 119,
+	213, 1, 3, 220, 67, 117, 105, 202, 60, 100, 124, 100, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 119, 105,
+	122, 170, 0, 18, 134, 135, 0, 169, 75, 0, 0, 127, 39, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4,
+	76, 109, 78, 88, 134, 103, 73, 130, 131, 95, 76, 120, 54, 92, 81, 41,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	4, 4, 0, 142, 151, 0, 11, 151, 150, 18, 101, 161, 153, 109, 181, 4,
+	1, 174, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 4, 4, 228, 106, 117, 121, 222, 75, 97, 132, 214, 29, 48, 169,
+	227, 99, 104, 150, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 4, 4, 68, 143, 104, 119, 215, 7, 0, 0, 217, 5,
+	0, 0, 74, 135, 97, 112, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 4, 4, 228, 108, 130, 88, 209, 0, 0, 189,
+	209, 0, 0, 190, 227, 101, 122, 94, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 245, 109, 109, 107, 243, 81,
+	81, 65, 238, 26, 26, 21, 244, 102, 102, 102, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 245, 109, 109, 109,
+	242, 78, 78, 54, 239, 29, 29, 20, 236, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 73, 136,
+	104, 98, 205, 2, 3, 5, 206, 1, 60, 210, 82, 127, 98, 178, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4,
+	209, 0, 0, 197, 223, 81, 81, 216, 213, 25, 25, 202, 209, 0, 0, 197,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	4, 4, 109, 171, 183, 109, 0, 109, 129, 0, 0, 109, 129, 0, 102, 167,
+	179, 102, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 4, 4, 0, 75, 109, 233, 0, 0, 0, 218, 0, 0, 0, 218,
+	124, 101, 109, 163, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 4, 4, 189, 3, 126, 90, 207, 176, 50, 0, 215, 82,
+	146, 1, 189, 0, 84, 135, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 4, 4, 218, 0, 0, 0, 218, 0, 0, 0,
+	218, 0, 0, 0, 232, 102, 102, 102, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 236, 82, 56, 239, 196, 129,
+	132, 176, 196, 56, 72, 176, 196, 0, 0, 176, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 249, 103, 0, 197,
+	209, 152, 24, 197, 209, 23, 157, 197, 209, 0, 90, 247, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 105, 131,
+	119, 117, 215, 0, 0, 186, 216, 0, 0, 186, 110, 125, 112, 119, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4,
+	231, 106, 122, 147, 214, 0, 22, 209, 230, 104, 97, 29, 214, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	4, 4, 120, 114, 102, 126, 217, 0, 0, 187, 199, 15, 5, 184, 25, 93,
+	145, 98, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 4, 4, 217, 106, 154, 49, 195, 19, 117, 86, 211, 87, 168, 24,
+	189, 0, 27, 163, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 4, 4, 139, 115, 104, 81, 192, 104, 58, 8, 1, 40,
+	83, 191, 106, 100, 106, 149, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 4, 4, 111, 155, 164, 111, 0, 78, 94, 0,
+	0, 78, 94, 0, 0, 78, 94, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 218, 0, 0, 203, 218, 0,
+	0, 203, 218, 0, 0, 203, 142, 108, 106, 145, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 188, 5, 3, 176,
+	107, 71, 62, 109, 15, 146, 145, 20, 0, 143, 149, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 153, 0,
+	0, 142, 142, 101, 79, 131, 133, 109, 130, 104, 95, 108, 141, 64, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4,
+	104, 80, 51, 119, 0, 140, 150, 5, 4, 153, 150, 11, 143, 45, 35, 135,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	4, 4, 150, 39, 27, 153, 10, 158, 155, 18, 0, 83, 101, 0, 0, 78,
+	94, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 4, 4, 98, 109, 139, 193, 0, 23, 173, 18, 13, 164, 22, 0,
+	198, 130, 102, 102, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 4, 4, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 255, 255, 255, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 4, 4, 94, 139, 150, 143, 35, 115, 126, 229,
+	217, 31, 5, 217, 164, 139, 131, 213, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 218, 0, 0, 0, 237, 99,
+	111, 115, 226, 0, 0, 205, 227, 97, 109, 137, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 66, 172, 140, 150,
+	228, 21, 0, 0, 231, 17, 0, 0, 71, 164, 130, 135, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 0, 0,
+	0, 203, 109, 116, 98, 231, 220, 0, 0, 210, 134, 114, 95, 221, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4,
+	79, 160, 148, 118, 226, 91, 88, 204, 215, 44, 44, 44, 85, 153, 128, 118,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	4, 4, 0, 99, 148, 101, 95, 192, 137, 95, 0, 155, 66, 0, 0, 155,
+	66, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 4, 4, 131, 124, 102, 225, 223, 0, 0, 209, 116, 125, 101, 231,
+	46, 100, 105, 146, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 4, 4, 244, 0, 0, 0, 249, 94, 108, 154, 245, 1,
+	0, 213, 244, 0, 0, 213, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 4, 4, 0, 64, 67, 0, 61, 144, 90, 0,
+	0, 103, 107, 0, 95, 160, 162, 95, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 7, 25, 47, 148, 15, 52,
+	90, 255, 0, 0, 46, 255, 77, 78, 125, 184, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 209, 0, 0, 0,
+	209, 23, 126, 51, 233, 173, 89, 0, 209, 0, 110, 116, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 101, 198,
+	61, 0, 0, 161, 61, 0, 0, 161, 61, 0, 0, 99, 144, 93, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4,
+	205, 178, 148, 171, 175, 77, 91, 156, 175, 77, 91, 156, 175, 77, 91, 156,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	4, 4, 235, 128, 153, 165, 249, 8, 0, 215, 244, 0, 0, 213, 244, 0,
+	0, 213, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 4, 4, 102, 165, 156, 113, 212, 1, 0, 193, 211, 0, 0, 191,
+	109, 154, 144, 119, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 4, 4, 229, 106, 117, 133, 224, 0, 0, 203, 241, 103,
+	114, 135, 218, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 4, 4, 129, 123, 103, 225, 218, 0, 0, 207,
+	132, 120, 100, 234, 0, 1, 1, 203, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 241, 128, 140, 149, 255, 35,
+	0, 0, 255, 0, 0, 0, 255, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 156, 159, 138, 107,
+	209, 115, 64, 15, 1, 40, 96, 213, 144, 129, 137, 157, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 21, 167,
+	67, 21, 85, 191, 119, 85, 0, 159, 51, 0, 0, 108, 147, 104, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4,
+	244, 0, 0, 213, 244, 0, 0, 213, 245, 0, 0, 222, 153, 160, 121, 216,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	4, 4, 190, 8, 0, 175, 99, 85, 53, 124, 10, 165, 151, 29, 0, 146,
+	174, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 4, 4, 154, 0, 0, 140, 145, 63, 75, 137, 113, 128, 113, 123,
+	55, 148, 124, 74, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 4, 4, 115, 81, 49, 137, 1, 153, 173, 7, 4, 162,
+	173, 15, 144, 60, 33, 155, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 4, 4, 173, 25, 11, 169, 35, 143, 129, 52,
+	0, 132, 154, 0, 70, 159, 23, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 117, 141, 153, 236, 0, 22,
+	182, 49, 30, 185, 34, 0, 231, 165, 135, 135, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	33, 44, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 63, 64,
+	65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80,
+	81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 95, 97, 98, 99, 100, 101,
+	102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117,
+	118, 119, 120, 121, 122, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 241, 7, 217, 220, 255, 255, 255, 255, 182, 182, 182, 182, 0, 0,
+	0, 0, 0, 0, 0, 0, 182, 1, 161, 96, 242, 242, 133, 133, 200, 200,
+	96, 96, 0, 0, 0, 0, 0, 0, 0, 0, 58, 1, 255, 255, 255, 255,
+	255, 255, 255, 255, 255, 255, 0, 0, 0, 0, 0, 0, 0, 0, 194, 1,
+	49, 20, 91, 91, 8, 8, 92, 92, 10, 10, 0, 0, 0, 0, 0, 0,
+	1, 0, 155, 1, 119, 81, 118, 118, 120, 120, 121, 121, 118, 118, 0, 0,
+	0, 0, 0, 0, 0, 0, 208, 1, 90, 82, 74, 74, 104, 104, 96, 96,
+	111, 111, 0, 0, 0, 0, 0, 0, 0, 0, 175, 1, 94, 94, 116, 116,
+	55, 55, 111, 111, 91, 91, 0, 0, 0, 0, 0, 0, 0, 0, 166, 1,
+	93, 62, 122, 122, 68, 68, 59, 59, 121, 121, 0, 0, 0, 0, 0, 0,
+	1, 0, 123, 1, 94, 43, 113, 113, 53, 53, 79, 79, 124, 124, 0, 0,
+	0, 0, 0, 0, 0, 0, 175, 1, 102, 89, 88, 88, 143, 143, 55, 55,
+	118, 118, 0, 0, 0, 0, 0, 0, 1, 0, 151, 1, 114, 72, 87, 87,
+	134, 134, 120, 120, 111, 111, 0, 0, 0, 0, 0, 0, 0, 0, 150, 1,
+	74, 73, 130, 130, 52, 52, 63, 63, 55, 55, 0, 0, 0, 0, 0, 0,
+	2, 0, 150, 1, 120, 58, 119, 119, 119, 119, 119, 119, 120, 120, 0, 0,
+	0, 0, 0, 0, 1, 0, 150, 1, 114, 73, 120, 120, 113, 113, 87, 87,
+	134, 134, 0, 0, 0, 0, 0, 0, 0, 0, 240, 1, 75, 50, 137, 137,
+	61, 61, 80, 80, 35, 35, 0, 0, 0, 0, 0, 0, 1, 0, 95, 1,
+	92, 67, 92, 92, 105, 105, 93, 93, 80, 80, 0, 0, 0, 0, 0, 0,
+	1, 0, 81, 1, 94, 36, 78, 78, 78, 78, 110, 110, 107, 107, 0, 0,
+	0, 0, 0, 0, 2, 0, 140, 1, 133, 153, 119, 119, 156, 156, 137, 137,
+	120, 120, 0, 0, 0, 0, 0, 0, 0, 0, 171, 1, 80, 74, 54, 54,
+	106, 106, 105, 105, 53, 53, 0, 0, 0, 0, 0, 0, 1, 0, 142, 1,
+	119, 150, 103, 103, 129, 129, 129, 129, 103, 103, 0, 0, 0, 0, 0, 0,
+	0, 0, 174, 1, 115, 188, 94, 94, 164, 164, 146, 146, 67, 67, 0, 0,
+	0, 0, 0, 0, 0, 0, 180, 1, 94, 145, 92, 92, 164, 164, 116, 116,
+	14, 14, 0, 0, 0, 0, 0, 0, 0, 0, 138, 1, 99, 86, 55, 55,
+	101, 101, 101, 101, 136, 136, 0, 0, 0, 0, 0, 0, 0, 0, 150, 1,
+	118, 194, 126, 126, 130, 130, 110, 110, 105, 105, 0, 0, 0, 0, 0, 0,
+	0, 0, 207, 1, 100, 121, 109, 109, 101, 101, 100, 100, 108, 108, 0, 0,
+	0, 0, 0, 0, 0, 0, 216, 1, 88, 129, 140, 140, 20, 20, 57, 57,
+	123, 123, 0, 0, 0, 0, 0, 0, 0, 0, 102, 1, 104, 117, 65, 65,
+	145, 145, 118, 118, 90, 90, 0, 0, 0, 0, 0, 0, 0, 0, 160, 1,
+	73, 145, 0, 0, 103, 103, 134, 134, 52, 52, 0, 0, 0, 0, 0, 0,
+	0, 0, 107, 1, 130, 195, 149, 149, 152, 152, 107, 107, 106, 106, 0, 0,
+	0, 0, 0, 0, 0, 0, 150, 1, 142, 202, 108, 108, 175, 175, 108, 108,
+	168, 168, 0, 0, 0, 0, 0, 0, 1, 0, 143, 1, 109, 82, 105, 105,
+	109, 109, 108, 108, 105, 105, 0, 0, 0, 0, 0, 0, 1, 0, 154, 1,
+	106, 134, 124, 124, 136, 136, 133, 133, 33, 33, 0, 0, 0, 0, 0, 0,
+	1, 0, 204, 1, 102, 66, 104, 104, 107, 107, 81, 81, 108, 108, 0, 0,
+	0, 0, 0, 0, 1, 0, 101, 1, 111, 123, 100, 100, 133, 133, 119, 119,
+	94, 94, 0, 0, 0, 0, 0, 0, 0, 0, 155, 1, 99, 65, 65, 65,
+	135, 135, 64, 64, 134, 134, 0, 0, 0, 0, 0, 0, 0, 0, 82, 1,
+	65, 78, 93, 93, 89, 89, 46, 46, 51, 51, 0, 0, 0, 0, 0, 0,
+	0, 0, 164, 1, 109, 160, 98, 98, 103, 103, 113, 113, 111, 111, 0, 0,
+	0, 0, 0, 0, 0, 0, 90, 1, 83, 38, 86, 86, 88, 88, 78, 78,
+	76, 76, 0, 0, 0, 0, 0, 0, 0, 0, 42, 1, 102, 41, 90, 90,
+	99, 99, 108, 108, 106, 106, 0, 0, 0, 0, 0, 0, 0, 0, 68, 1,
+	83, 42, 80, 80, 81, 81, 85, 85, 82, 82, 0, 0, 0, 0, 0, 0,
+	0, 0, 85, 1, 66, 31, 86, 86, 87, 87, 47, 47, 53, 53, 0, 0,
+	0, 0, 0, 0, 0, 0, 121, 1, 93, 120, 126, 126, 59, 59, 127, 127,
+	60, 60, 0, 0, 0, 0, 0, 0, 0, 0, 18, 0, 255, 255, 255, 255,
+	255, 255, 255, 255, 255, 255, 0, 0, 0, 0, 0, 0, 1, 0, 65, 1,
+	135, 109, 162, 162, 98, 98, 138, 138, 146, 146, 0, 0, 0, 0, 0, 0,
+	1, 0, 185, 1, 111, 122, 58, 58, 134, 134, 133, 133, 111, 111, 0, 0,
+	0, 0, 0, 0, 0, 0, 92, 1, 94, 85, 70, 70, 119, 119, 118, 118,
+	66, 66, 0, 0, 0, 0, 0, 0, 1, 0, 185, 1, 111, 121, 132, 132,
+	58, 58, 113, 113, 130, 130, 0, 0, 0, 0, 0, 0, 1, 0, 44, 1,
+	122, 73, 141, 141, 139, 139, 128, 128, 93, 93, 0, 0, 0, 0, 0, 0,
+	0, 0, 208, 1, 83, 51, 124, 124, 104, 104, 86, 86, 41, 41, 0, 0,
+	0, 0, 0, 0, 1, 0, 178, 1, 124, 112, 131, 131, 115, 115, 97, 97,
+	144, 144, 0, 0, 0, 0, 0, 0, 0, 0, 214, 1, 109, 158, 67, 67,
+	139, 139, 113, 113, 106, 106, 0, 0, 0, 0, 0, 0, 0, 0, 184, 1,
+	72, 70, 45, 45, 72, 72, 94, 94, 97, 97, 0, 0, 0, 0, 0, 0,
+	0, 0, 85, 3, 92, 109, 136, 136, 27, 27, 38, 38, 153, 153, 0, 0,
+	0, 0, 0, 0, 0, 0, 164, 1, 95, 110, 44, 44, 107, 107, 150, 150,
+	79, 79, 0, 0, 0, 0, 0, 0, 0, 0, 219, 1, 72, 55, 39, 39,
+	121, 121, 73, 73, 81, 81, 0, 0, 0, 0, 0, 0, 0, 0, 29, 1,
+	137, 174, 147, 147, 157, 157, 125, 125, 132, 132, 0, 0, 0, 0, 0, 0,
+	0, 0, 85, 1, 128, 175, 132, 132, 146, 146, 112, 112, 106, 106, 0, 0,
+	0, 0, 0, 0, 1, 0, 54, 1, 117, 82, 115, 115, 117, 117, 116, 116,
+	114, 114, 0, 0, 0, 0, 0, 0, 1, 0, 177, 1, 112, 124, 112, 112,
+	134, 134, 135, 135, 62, 62, 0, 0, 0, 0, 0, 0, 1, 0, 177, 1,
+	112, 123, 131, 131, 114, 114, 62, 62, 132, 132, 0, 0, 0, 0, 0, 0,
+	0, 0, 113, 1, 89, 122, 70, 70, 158, 158, 120, 120, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 106, 1, 117, 87, 81, 81, 157, 157, 86, 86,
+	151, 151, 0, 0, 0, 0, 0, 0, 0, 0, 155, 1, 85, 55, 77, 77,
+	127, 127, 79, 79, 78, 78, 0, 0, 0, 0, 0, 0, 0, 0, 87, 1,
+	127, 169, 106, 106, 112, 112, 134, 134, 139, 139, 0, 0, 0, 0, 0, 0,
+	0, 0, 25, 1, 88, 40, 88, 88, 90, 90, 84, 84, 86, 86, 0, 0,
+	0, 0, 0, 0, 0, 0, 233, 0, 100, 45, 91, 91, 89, 89, 110, 110,
+	107, 107, 0, 0, 0, 0, 0, 0, 0, 0, 18, 1, 91, 50, 90, 90,
+	87, 87, 90, 90, 92, 92, 0, 0, 0, 0, 0, 0, 0, 0, 130, 1,
+	80, 36, 88, 88, 91, 91, 96, 96, 47, 47, 0, 0, 0, 0, 0, 0,
+	0, 0, 86, 1, 113, 139, 151, 151, 71, 71, 150, 150, 80, 80, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	33, 44, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 63, 64,
+	65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80,
+	81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 95, 97, 98, 99, 100, 101,
+	102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117,
+	118, 119, 120, 121, 122, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 126, 87, 4, 255, 91, 73, 235, 63,
+	250, 237, 235, 192, 57, 227, 31, 64, 38, 142, 60, 16, 89, 164, 235, 63,
+	0, 0, 0, 0, 0, 0, 240, 63, 0, 0, 0, 0, 0, 0, 240, 63,
+	222, 0, 51, 223, 193, 207, 230, 63, 222, 0, 51, 223, 193, 207, 230, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 235, 213, 32, 162, 131, 31, 118, 63,
+	86, 240, 199, 26, 186, 178, 206, 63, 26, 172, 214, 166, 159, 55, 122, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	195, 164, 85, 73, 51, 85, 132, 63, 195, 164, 85, 73, 51, 85, 132, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 65, 69, 213, 175, 116, 62, 228, 63,
+	189, 58, 199, 128, 236, 117, 251, 63, 153, 131, 160, 163, 85, 45, 216, 63,
+	8, 28, 9, 52, 216, 84, 238, 63, 38, 168, 225, 91, 88, 183, 224, 63,
+	67, 114, 50, 113, 171, 32, 233, 63, 157, 188, 200, 4, 252, 26, 216, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 245, 158, 27, 207, 140, 91, 151, 63,
+	13, 74, 74, 53, 210, 169, 181, 63, 131, 80, 252, 37, 178, 7, 161, 63,
+	35, 30, 45, 71, 203, 39, 135, 63, 249, 8, 253, 48, 224, 46, 176, 63,
+	231, 49, 201, 149, 115, 180, 168, 63, 26, 103, 193, 1, 163, 78, 164, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 240, 63,
+	18, 20, 63, 198, 220, 181, 243, 63, 0, 0, 0, 0, 0, 0, 240, 63,
+	0, 0, 0, 0, 0, 0, 240, 63, 0, 0, 0, 0, 0, 0, 240, 63,
+	0, 0, 0, 0, 0, 0, 240, 63, 0, 0, 0, 0, 0, 0, 240, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	20, 245, 69, 35, 96, 42, 186, 63, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 25, 228, 46, 194, 20, 229, 200, 63,
+	235, 28, 3, 178, 215, 59, 252, 63, 82, 162, 128, 72, 26, 55, 180, 63,
+	2, 211, 105, 221, 6, 181, 214, 63, 213, 79, 73, 231, 13, 65, 159, 63,
+	128, 70, 233, 210, 191, 36, 215, 63, 162, 255, 47, 232, 206, 93, 164, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 154, 185, 36, 99, 45, 168, 99, 63,
+	84, 5, 128, 175, 242, 150, 161, 63, 120, 15, 128, 95, 215, 202, 111, 63,
+	24, 84, 227, 25, 102, 205, 112, 63, 5, 21, 225, 44, 79, 202, 102, 63,
+	232, 91, 18, 183, 200, 144, 123, 63, 244, 236, 155, 221, 62, 83, 133, 63,
+	0, 0, 0, 0, 0, 0, 240, 63, 157, 131, 103, 66, 147, 196, 221, 63,
+	245, 219, 215, 129, 115, 198, 249, 63, 168, 30, 105, 112, 91, 91, 212, 63,
+	191, 11, 91, 179, 149, 151, 221, 63, 132, 213, 88, 194, 218, 24, 222, 63,
+	178, 71, 168, 25, 82, 69, 222, 63, 24, 36, 125, 90, 69, 127, 221, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 209, 184, 189, 242, 26, 172, 103, 63,
+	241, 46, 65, 162, 48, 231, 164, 63, 71, 41, 174, 63, 229, 23, 176, 63,
+	124, 76, 36, 167, 195, 160, 133, 63, 7, 174, 98, 165, 157, 245, 114, 63,
+	158, 87, 109, 139, 52, 129, 141, 63, 127, 62, 241, 158, 13, 210, 119, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 173, 109, 138, 199, 69, 181, 214, 63,
+	135, 138, 113, 254, 38, 20, 253, 63, 30, 195, 99, 63, 139, 165, 212, 63,
+	134, 29, 198, 164, 191, 151, 210, 63, 97, 25, 27, 186, 217, 31, 218, 63,
+	220, 104, 0, 111, 129, 4, 216, 63, 253, 105, 163, 58, 29, 200, 219, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 202, 16, 235, 129, 29, 62, 134, 63,
+	82, 247, 67, 254, 124, 76, 164, 63, 187, 206, 152, 50, 51, 131, 139, 63,
+	46, 129, 80, 250, 109, 160, 135, 63, 235, 59, 203, 55, 68, 26, 153, 63,
+	161, 42, 228, 113, 157, 54, 157, 63, 252, 248, 76, 109, 150, 1, 145, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 148, 219, 246, 61, 234, 175, 215, 63,
+	16, 175, 235, 23, 236, 6, 251, 63, 224, 19, 235, 84, 249, 158, 215, 63,
+	51, 137, 122, 193, 167, 57, 221, 63, 212, 96, 26, 134, 143, 136, 203, 63,
+	155, 86, 10, 129, 92, 226, 219, 63, 62, 123, 46, 83, 147, 224, 214, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 1, 208, 59, 107, 196, 144, 128, 63,
+	209, 245, 25, 214, 167, 193, 159, 63, 80, 7, 244, 68, 165, 161, 179, 63,
+	70, 222, 135, 215, 21, 67, 134, 63, 65, 46, 21, 161, 54, 245, 133, 63,
+	140, 21, 212, 89, 158, 39, 129, 63, 163, 209, 124, 111, 111, 72, 138, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 87, 121, 2, 97, 167, 88, 215, 63,
+	38, 223, 108, 115, 99, 122, 250, 63, 204, 212, 36, 120, 67, 26, 207, 63,
+	55, 85, 247, 200, 230, 170, 222, 63, 253, 164, 218, 167, 227, 49, 209, 63,
+	217, 36, 63, 226, 87, 172, 205, 63, 118, 250, 65, 93, 164, 80, 222, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 54, 240, 187, 242, 92, 136, 132, 63,
+	215, 242, 144, 51, 169, 86, 164, 63, 53, 191, 40, 137, 7, 179, 175, 63,
+	35, 184, 127, 164, 134, 47, 122, 63, 121, 94, 235, 226, 236, 63, 146, 63,
+	172, 58, 89, 65, 78, 241, 135, 63, 188, 127, 9, 47, 235, 181, 143, 63,
+	0, 0, 0, 0, 0, 0, 240, 63, 134, 199, 126, 22, 75, 145, 215, 63,
+	27, 187, 68, 245, 214, 192, 247, 63, 221, 38, 220, 43, 243, 86, 197, 63,
+	117, 204, 121, 198, 190, 100, 220, 63, 149, 15, 65, 213, 232, 213, 202, 63,
+	59, 29, 200, 122, 106, 245, 211, 63, 146, 146, 30, 134, 86, 39, 223, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 37, 196, 51, 238, 125, 126, 114, 63,
+	84, 108, 1, 134, 99, 215, 171, 63, 247, 186, 194, 5, 38, 179, 114, 63,
+	193, 182, 105, 154, 77, 97, 132, 63, 235, 1, 57, 14, 253, 250, 106, 63,
+	249, 90, 121, 93, 46, 210, 132, 63, 161, 171, 30, 90, 67, 186, 129, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 230, 5, 216, 71, 167, 174, 217, 63,
+	229, 39, 213, 62, 29, 15, 251, 63, 62, 233, 68, 130, 169, 102, 214, 63,
+	147, 24, 4, 86, 14, 45, 214, 63, 0, 230, 90, 180, 0, 237, 225, 63,
+	148, 162, 149, 123, 129, 89, 203, 63, 184, 148, 243, 197, 222, 139, 221, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 44, 46, 201, 96, 72, 153, 130, 63,
+	215, 116, 228, 184, 228, 92, 164, 63, 168, 232, 217, 217, 224, 177, 163, 63,
+	121, 94, 82, 77, 241, 18, 151, 63, 1, 5, 148, 171, 37, 58, 147, 63,
+	79, 232, 199, 190, 221, 80, 138, 63, 172, 245, 174, 100, 16, 193, 133, 63,
+	0, 0, 0, 0, 0, 0, 240, 63, 56, 45, 120, 209, 87, 144, 220, 63,
+	156, 138, 84, 24, 91, 136, 249, 63, 233, 126, 78, 65, 126, 54, 210, 63,
+	101, 113, 255, 145, 233, 208, 213, 63, 226, 34, 247, 116, 117, 199, 224, 63,
+	11, 181, 166, 121, 199, 41, 222, 63, 121, 203, 213, 143, 77, 242, 219, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 97, 197, 11, 89, 132, 255, 117, 63,
+	187, 140, 204, 169, 31, 29, 143, 63, 166, 1, 108, 232, 177, 241, 177, 63,
+	41, 42, 80, 64, 94, 145, 135, 63, 246, 140, 191, 139, 89, 107, 121, 63,
+	248, 226, 190, 201, 91, 28, 118, 63, 122, 23, 22, 222, 83, 4, 121, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 142, 235, 223, 245, 153, 179, 210, 63,
+	62, 150, 62, 116, 65, 125, 249, 63, 175, 96, 27, 241, 100, 55, 210, 63,
+	110, 107, 11, 207, 75, 69, 224, 63, 70, 7, 36, 97, 223, 78, 202, 63,
+	198, 163, 84, 194, 19, 122, 207, 63, 232, 133, 59, 23, 70, 122, 203, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 160, 95, 54, 126, 120, 106, 129, 63,
+	27, 255, 50, 163, 9, 101, 165, 63, 140, 208, 250, 34, 185, 103, 129, 63,
+	210, 80, 205, 233, 217, 26, 146, 63, 72, 62, 224, 96, 58, 196, 147, 63,
+	202, 161, 183, 119, 177, 52, 113, 63, 87, 232, 148, 148, 223, 252, 128, 63,
+	0, 0, 0, 0, 0, 0, 0, 64, 210, 111, 95, 7, 206, 25, 222, 63,
+	245, 16, 141, 238, 32, 118, 249, 63, 192, 174, 38, 79, 89, 77, 205, 63,
+	33, 3, 121, 118, 249, 214, 221, 63, 167, 5, 47, 250, 10, 210, 221, 63,
+	233, 242, 230, 112, 173, 246, 221, 63, 2, 97, 167, 88, 53, 8, 222, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 95, 209, 194, 118, 132, 65, 101, 63,
+	124, 80, 251, 29, 235, 55, 145, 63, 193, 239, 248, 196, 217, 181, 169, 63,
+	50, 186, 8, 40, 124, 26, 101, 63, 188, 95, 179, 77, 251, 205, 116, 63,
+	250, 109, 66, 235, 109, 127, 124, 63, 53, 197, 232, 153, 82, 40, 119, 63,
+	0, 0, 0, 0, 0, 0, 240, 63, 64, 250, 38, 77, 131, 162, 220, 63,
+	245, 16, 141, 238, 32, 118, 249, 63, 26, 81, 218, 27, 124, 97, 210, 63,
+	172, 201, 83, 86, 211, 245, 221, 63, 159, 32, 177, 221, 61, 64, 220, 63,
+	250, 13, 19, 13, 82, 240, 213, 63, 164, 225, 148, 185, 249, 198, 224, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 193, 129, 129, 89, 220, 74, 117, 63,
+	124, 80, 251, 29, 235, 55, 145, 63, 193, 239, 165, 37, 112, 47, 177, 63,
+	196, 113, 240, 48, 210, 46, 133, 63, 152, 97, 151, 118, 138, 126, 125, 63,
+	154, 251, 247, 132, 122, 198, 118, 63, 150, 136, 160, 14, 121, 3, 128, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 7, 151, 142, 57, 207, 216, 210, 63,
+	53, 36, 238, 177, 244, 33, 255, 63, 45, 66, 177, 21, 52, 45, 201, 63,
+	40, 239, 227, 104, 142, 44, 225, 63, 208, 40, 93, 250, 151, 164, 206, 63,
+	77, 190, 217, 230, 198, 244, 211, 63, 167, 31, 212, 69, 10, 101, 193, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 143, 179, 143, 30, 177, 44, 116, 63,
+	249, 91, 34, 157, 45, 109, 132, 63, 237, 189, 180, 92, 163, 159, 154, 63,
+	207, 206, 52, 68, 96, 226, 135, 63, 45, 69, 216, 71, 20, 217, 117, 63,
+	140, 148, 162, 19, 51, 120, 152, 63, 167, 134, 138, 23, 144, 215, 149, 63,
+	0, 0, 0, 0, 0, 0, 240, 63, 220, 242, 145, 148, 244, 48, 215, 63,
+	156, 162, 35, 185, 252, 7, 246, 63, 3, 125, 34, 79, 146, 174, 208, 63,
+	110, 77, 186, 45, 145, 11, 215, 63, 227, 24, 201, 30, 161, 102, 218, 63,
+	231, 251, 169, 241, 210, 77, 215, 63, 146, 94, 212, 238, 87, 1, 212, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 215, 134, 22, 123, 159, 176, 183, 63,
+	125, 230, 90, 100, 87, 148, 212, 63, 19, 102, 169, 245, 164, 105, 180, 63,
+	78, 130, 53, 215, 144, 252, 201, 63, 69, 198, 12, 134, 203, 146, 130, 63,
+	170, 39, 16, 72, 131, 26, 170, 63, 213, 63, 156, 65, 91, 161, 192, 63,
+	0, 0, 0, 0, 0, 0, 240, 63, 114, 248, 164, 19, 9, 166, 215, 63,
+	48, 76, 166, 10, 70, 37, 245, 63, 24, 153, 128, 95, 35, 73, 194, 63,
+	107, 216, 239, 137, 117, 170, 211, 63, 214, 228, 41, 171, 233, 122, 211, 63,
+	105, 115, 156, 219, 132, 123, 219, 63, 156, 134, 168, 194, 159, 225, 218, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 155, 28, 71, 229, 134, 223, 107, 63,
+	218, 253, 253, 85, 125, 38, 160, 63, 184, 122, 222, 17, 35, 231, 133, 63,
+	30, 54, 251, 74, 215, 213, 124, 63, 243, 81, 153, 45, 86, 81, 120, 63,
+	111, 173, 124, 79, 68, 132, 116, 63, 254, 2, 6, 179, 244, 222, 128, 63,
+	0, 0, 0, 0, 0, 0, 0, 64, 141, 65, 39, 132, 14, 186, 224, 63,
+	171, 149, 9, 191, 212, 207, 248, 63, 253, 102, 98, 186, 16, 43, 227, 63,
+	167, 178, 40, 236, 162, 232, 221, 63, 60, 250, 95, 174, 69, 139, 227, 63,
+	145, 124, 37, 144, 18, 59, 225, 63, 179, 154, 174, 39, 186, 46, 222, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 249, 114, 229, 61, 156, 20, 136, 63,
+	241, 74, 112, 52, 124, 42, 143, 63, 142, 62, 163, 136, 53, 121, 145, 63,
+	168, 252, 107, 254, 24, 42, 146, 63, 35, 197, 157, 31, 209, 191, 143, 63,
+	57, 241, 226, 180, 71, 43, 142, 63, 32, 220, 85, 47, 89, 50, 134, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 194, 217, 173, 101, 50, 28, 212, 63,
+	201, 60, 242, 7, 3, 207, 250, 63, 84, 116, 36, 151, 255, 144, 210, 63,
+	11, 209, 33, 112, 36, 208, 202, 63, 67, 87, 34, 80, 253, 131, 218, 63,
+	134, 230, 58, 141, 180, 84, 218, 63, 22, 22, 220, 15, 120, 96, 202, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 132, 252, 60, 73, 55, 97, 128, 63,
+	78, 111, 68, 29, 197, 133, 159, 63, 161, 36, 70, 85, 114, 174, 169, 63,
+	1, 210, 144, 254, 47, 212, 108, 63, 65, 77, 191, 90, 231, 179, 143, 63,
+	154, 199, 80, 74, 121, 105, 142, 63, 222, 155, 223, 63, 59, 130, 109, 63,
+	0, 0, 0, 0, 0, 0, 240, 63, 135, 82, 123, 17, 109, 199, 221, 63,
+	10, 128, 241, 12, 26, 250, 248, 63, 1, 167, 119, 241, 126, 220, 226, 63,
+	133, 124, 208, 179, 89, 245, 217, 63, 163, 115, 126, 138, 227, 64, 224, 63,
+	206, 250, 148, 99, 178, 56, 224, 63, 160, 195, 124, 121, 1, 246, 217, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 254, 14, 228, 104, 138, 67, 136, 63,
+	240, 147, 150, 23, 243, 41, 155, 63, 128, 220, 144, 90, 81, 77, 153, 63,
+	248, 23, 161, 181, 199, 17, 147, 63, 204, 187, 202, 108, 80, 30, 142, 63,
+	90, 6, 27, 208, 51, 94, 139, 63, 232, 149, 82, 151, 10, 138, 147, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 43, 50, 58, 32, 9, 251, 220, 63,
+	22, 24, 178, 186, 213, 243, 250, 63, 180, 5, 132, 214, 195, 151, 231, 63,
+	232, 219, 130, 165, 186, 128, 215, 63, 57, 240, 106, 185, 51, 147, 228, 63,
+	92, 204, 207, 13, 77, 89, 226, 63, 36, 183, 38, 221, 150, 200, 208, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 34, 196, 236, 90, 19, 186, 148, 63,
+	58, 147, 166, 60, 167, 151, 164, 63, 221, 133, 150, 57, 150, 9, 136, 63,
+	124, 165, 206, 34, 79, 129, 152, 63, 217, 26, 172, 218, 136, 235, 151, 63,
+	59, 227, 154, 230, 82, 180, 152, 63, 87, 133, 21, 13, 118, 211, 155, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 182, 188, 114, 189, 109, 166, 215, 63,
+	139, 253, 101, 247, 228, 97, 251, 63, 55, 194, 162, 34, 78, 39, 226, 63,
+	44, 13, 252, 168, 134, 253, 214, 63, 22, 75, 145, 124, 37, 144, 228, 63,
+	219, 190, 71, 253, 245, 10, 221, 63, 101, 74, 144, 182, 150, 110, 171, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 34, 50, 92, 184, 236, 68, 145, 63,
+	94, 27, 153, 3, 27, 180, 150, 63, 193, 27, 184, 38, 25, 134, 116, 63,
+	73, 164, 117, 162, 93, 61, 158, 63, 252, 76, 73, 217, 19, 0, 151, 63,
+	69, 100, 186, 17, 37, 109, 142, 63, 211, 226, 34, 183, 166, 12, 135, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 102, 163, 115, 126, 138, 227, 216, 63,
+	83, 145, 10, 99, 11, 193, 248, 63, 127, 47, 133, 7, 205, 174, 213, 63,
+	120, 238, 61, 92, 114, 220, 203, 63, 242, 211, 184, 55, 191, 97, 217, 63,
+	59, 172, 112, 203, 71, 82, 217, 63, 47, 133, 7, 205, 174, 251, 224, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 235, 108, 97, 37, 238, 37, 128, 63,
+	38, 163, 238, 244, 52, 92, 152, 63, 42, 196, 110, 50, 191, 12, 175, 63,
+	105, 132, 114, 180, 187, 212, 148, 63, 201, 94, 252, 80, 110, 201, 139, 63,
+	58, 4, 126, 4, 54, 23, 138, 63, 9, 31, 209, 248, 133, 67, 141, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 115, 75, 171, 33, 113, 143, 221, 63,
+	153, 187, 150, 144, 15, 122, 249, 63, 212, 68, 159, 143, 50, 98, 232, 63,
+	49, 149, 126, 194, 217, 173, 223, 63, 7, 66, 178, 128, 9, 92, 224, 63,
+	210, 0, 222, 2, 9, 138, 219, 63, 68, 253, 46, 108, 205, 86, 218, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 18, 38, 255, 143, 206, 222, 131, 63,
+	206, 110, 30, 46, 111, 69, 162, 63, 120, 150, 107, 158, 105, 170, 109, 63,
+	68, 139, 38, 46, 180, 29, 145, 63, 50, 26, 218, 5, 82, 131, 133, 63,
+	240, 161, 162, 203, 255, 57, 145, 63, 98, 228, 166, 148, 101, 239, 143, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 182, 159, 140, 241, 97, 246, 216, 63,
+	51, 109, 255, 202, 74, 19, 253, 63, 64, 195, 155, 53, 120, 95, 222, 63,
+	207, 107, 236, 18, 213, 91, 219, 63, 24, 152, 21, 138, 116, 63, 217, 63,
+	83, 92, 85, 246, 93, 17, 217, 63, 53, 184, 173, 45, 60, 47, 219, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 129, 214, 146, 221, 190, 6, 147, 63,
+	214, 59, 125, 169, 71, 90, 153, 63, 132, 89, 123, 168, 68, 103, 145, 63,
+	203, 74, 209, 170, 231, 113, 152, 63, 177, 128, 27, 158, 231, 205, 152, 63,
+	179, 192, 178, 150, 70, 188, 150, 63, 107, 224, 92, 197, 144, 111, 152, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 70, 38, 224, 215, 72, 18, 214, 63,
+	53, 181, 108, 173, 47, 146, 253, 63, 227, 164, 48, 239, 113, 38, 224, 63,
+	240, 82, 234, 146, 113, 140, 225, 63, 185, 150, 127, 227, 33, 66, 180, 63,
+	249, 245, 67, 108, 176, 112, 204, 63, 144, 217, 89, 244, 78, 5, 223, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 105, 236, 245, 240, 91, 58, 129, 63,
+	180, 135, 244, 164, 36, 21, 162, 63, 178, 109, 52, 117, 71, 130, 161, 63,
+	84, 140, 56, 224, 74, 81, 155, 63, 145, 69, 203, 90, 29, 71, 139, 63,
+	107, 149, 5, 213, 46, 229, 110, 63, 206, 149, 156, 22, 168, 203, 137, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 52, 47, 135, 221, 119, 12, 218, 63,
+	31, 128, 212, 38, 78, 110, 246, 63, 150, 121, 171, 174, 67, 53, 221, 63,
+	209, 119, 183, 178, 68, 103, 208, 63, 54, 171, 62, 87, 91, 49, 226, 63,
+	8, 147, 226, 227, 19, 178, 221, 63, 31, 75, 31, 186, 160, 190, 214, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 189, 244, 27, 88, 160, 26, 107, 63,
+	122, 105, 246, 51, 211, 44, 150, 63, 220, 156, 94, 4, 30, 135, 107, 63,
+	14, 162, 237, 53, 31, 188, 110, 63, 108, 44, 243, 98, 114, 67, 130, 63,
+	21, 170, 52, 62, 78, 82, 132, 63, 42, 20, 147, 6, 64, 132, 110, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 9, 139, 138, 56, 157, 100, 210, 63,
+	29, 85, 77, 16, 117, 31, 250, 63, 22, 223, 80, 248, 108, 29, 226, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 250, 9, 103, 183, 150, 201, 217, 63,
+	200, 120, 148, 74, 120, 194, 224, 63, 32, 42, 141, 152, 217, 231, 201, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 226, 168, 132, 219, 178, 244, 132, 63,
+	180, 90, 25, 35, 30, 232, 148, 63, 170, 163, 47, 238, 134, 64, 116, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 45, 142, 169, 203, 223, 128, 133, 63,
+	226, 80, 153, 97, 217, 238, 142, 63, 74, 7, 227, 17, 253, 20, 147, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 69, 155, 227, 220, 38, 92, 224, 63,
+	64, 193, 197, 138, 26, 204, 246, 63, 76, 56, 244, 22, 15, 111, 232, 63,
+	76, 112, 234, 3, 201, 187, 226, 63, 148, 22, 46, 171, 176, 25, 227, 63,
+	76, 221, 149, 93, 48, 184, 218, 63, 61, 156, 192, 116, 90, 183, 218, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 87, 163, 72, 10, 146, 158, 128, 63,
+	121, 42, 4, 158, 41, 68, 143, 63, 183, 215, 121, 6, 156, 29, 105, 63,
+	220, 36, 217, 217, 52, 217, 140, 63, 35, 107, 201, 92, 59, 73, 138, 63,
+	214, 184, 228, 189, 24, 62, 130, 63, 254, 113, 21, 89, 7, 102, 131, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 153, 72, 105, 54, 143, 195, 225, 63,
+	153, 187, 150, 144, 15, 122, 249, 63, 70, 92, 0, 26, 165, 75, 233, 63,
+	83, 89, 20, 118, 81, 244, 218, 63, 87, 208, 180, 196, 202, 232, 229, 63,
+	45, 65, 70, 64, 133, 35, 219, 63, 164, 0, 81, 48, 99, 10, 229, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 253, 42, 62, 162, 87, 76, 119, 63,
+	206, 110, 30, 46, 111, 69, 162, 63, 189, 231, 191, 24, 66, 166, 106, 63,
+	41, 144, 150, 242, 65, 121, 121, 63, 213, 232, 253, 158, 139, 137, 131, 63,
+	178, 8, 149, 208, 101, 15, 129, 63, 111, 68, 38, 31, 130, 71, 139, 63,
+	0, 0, 0, 0, 0, 0, 240, 63, 107, 244, 106, 128, 210, 80, 219, 63,
+	218, 56, 98, 45, 62, 5, 249, 63, 73, 159, 86, 209, 31, 154, 212, 63,
+	109, 3, 119, 160, 78, 121, 218, 63, 71, 176, 113, 253, 187, 62, 219, 63,
+	120, 210, 194, 101, 21, 54, 219, 63, 126, 26, 247, 230, 55, 76, 218, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 233, 185, 84, 241, 162, 214, 137, 63,
+	153, 195, 170, 199, 186, 237, 158, 63, 43, 195, 104, 191, 139, 108, 179, 63,
+	108, 148, 252, 64, 67, 72, 144, 63, 181, 119, 58, 250, 160, 26, 146, 63,
+	95, 197, 6, 69, 218, 119, 146, 63, 242, 68, 212, 84, 174, 67, 145, 63,
+	0, 0, 0, 0, 0, 0, 240, 63, 246, 152, 72, 105, 54, 143, 218, 63,
+	82, 97, 108, 33, 200, 193, 249, 63, 141, 239, 139, 75, 85, 218, 224, 63,
+	64, 138, 58, 115, 15, 9, 223, 63, 10, 44, 128, 41, 3, 7, 225, 63,
+	227, 140, 97, 78, 208, 166, 224, 63, 100, 149, 210, 51, 189, 196, 192, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 140, 153, 37, 200, 77, 49, 127, 63,
+	216, 242, 53, 33, 138, 137, 164, 63, 23, 43, 75, 232, 239, 43, 146, 63,
+	234, 214, 249, 187, 137, 185, 149, 63, 189, 237, 7, 100, 237, 255, 148, 63,
+	35, 191, 180, 75, 32, 192, 133, 63, 148, 133, 117, 20, 4, 254, 132, 63,
+	0, 0, 0, 0, 0, 0, 240, 63, 90, 186, 130, 109, 196, 147, 217, 63,
+	116, 94, 99, 151, 168, 222, 252, 63, 150, 90, 239, 55, 218, 113, 208, 63,
+	180, 116, 5, 219, 136, 39, 218, 63, 183, 123, 185, 79, 142, 2, 219, 63,
+	150, 37, 58, 203, 44, 66, 212, 63, 12, 176, 143, 78, 93, 249, 218, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 66, 32, 18, 21, 88, 224, 132, 63,
+	69, 131, 147, 90, 158, 119, 164, 63, 190, 13, 0, 148, 54, 231, 174, 63,
+	23, 136, 157, 8, 46, 132, 145, 63, 180, 62, 14, 227, 251, 169, 147, 63,
+	79, 109, 86, 233, 11, 52, 135, 63, 106, 24, 236, 203, 198, 102, 130, 63,
+	0, 0, 0, 0, 0, 0, 240, 63, 66, 96, 229, 208, 34, 219, 219, 63,
+	117, 142, 1, 217, 235, 93, 246, 63, 87, 233, 238, 58, 27, 242, 222, 63,
+	0, 87, 178, 99, 35, 16, 217, 63, 113, 141, 207, 100, 255, 188, 224, 63,
+	158, 178, 154, 174, 39, 186, 221, 63, 238, 120, 147, 223, 162, 147, 215, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 158, 87, 19, 248, 116, 130, 121, 63,
+	232, 129, 221, 124, 240, 97, 156, 63, 194, 187, 53, 80, 164, 27, 122, 63,
+	132, 129, 135, 112, 136, 83, 143, 63, 75, 104, 142, 183, 24, 76, 147, 63,
+	166, 65, 53, 183, 180, 147, 140, 63, 149, 172, 8, 46, 112, 215, 114, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 163, 31, 13, 167, 204, 205, 216, 63,
+	245, 219, 215, 129, 115, 198, 249, 63, 8, 89, 22, 76, 252, 81, 208, 63,
+	189, 200, 4, 252, 26, 73, 208, 63, 229, 13, 48, 243, 29, 252, 224, 63,
+	130, 254, 66, 143, 24, 61, 208, 63, 200, 182, 12, 56, 75, 201, 224, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 179, 115, 158, 183, 124, 123, 108, 63,
+	241, 46, 65, 162, 48, 231, 164, 63, 191, 134, 28, 126, 143, 116, 177, 63,
+	122, 223, 191, 205, 94, 203, 122, 63, 101, 242, 165, 197, 178, 236, 133, 63,
+	220, 35, 63, 209, 192, 88, 101, 63, 123, 166, 47, 242, 36, 170, 108, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 101, 222, 170, 235, 80, 77, 208, 63,
+	16, 204, 209, 227, 247, 54, 245, 63, 198, 80, 78, 180, 171, 144, 211, 63,
+	11, 236, 49, 145, 210, 108, 215, 63, 146, 150, 202, 219, 17, 78, 214, 63,
+	217, 94, 11, 122, 111, 12, 199, 63, 114, 167, 116, 176, 254, 207, 201, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 184, 196, 236, 11, 91, 126, 129, 63,
+	93, 174, 132, 205, 38, 209, 160, 63, 246, 1, 209, 44, 60, 162, 131, 63,
+	34, 26, 90, 150, 131, 187, 126, 63, 95, 146, 165, 125, 174, 243, 150, 63,
+	30, 34, 66, 13, 25, 180, 140, 63, 205, 170, 54, 188, 195, 112, 148, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 218, 30, 189, 225, 62, 114, 219, 63,
+	153, 245, 98, 40, 39, 90, 250, 63, 81, 191, 11, 91, 179, 21, 228, 63,
+	174, 154, 231, 136, 124, 151, 216, 63, 250, 9, 103, 183, 150, 201, 217, 63,
+	89, 135, 163, 171, 116, 119, 220, 63, 96, 228, 101, 77, 44, 240, 219, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 134, 153, 69, 117, 234, 201, 127, 63,
+	104, 97, 108, 112, 43, 151, 144, 63, 20, 85, 109, 89, 108, 132, 162, 63,
+	240, 61, 71, 65, 86, 91, 145, 63, 45, 142, 169, 203, 223, 128, 133, 63,
+	194, 28, 85, 151, 122, 121, 125, 63, 131, 185, 4, 27, 244, 146, 136, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 191, 153, 152, 46, 196, 234, 212, 63,
+	200, 94, 239, 254, 120, 175, 245, 63, 34, 51, 23, 184, 60, 214, 194, 63,
+	62, 65, 98, 187, 123, 128, 213, 63, 87, 65, 12, 116, 237, 11, 214, 63,
+	184, 233, 207, 126, 164, 136, 211, 63, 206, 226, 197, 194, 16, 57, 211, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 170, 29, 184, 29, 213, 228, 143, 63,
+	193, 64, 160, 54, 219, 252, 169, 63, 164, 186, 103, 212, 106, 152, 120, 63,
+	148, 129, 8, 23, 49, 146, 148, 63, 251, 250, 23, 76, 162, 204, 140, 63,
+	229, 131, 152, 19, 2, 53, 131, 63, 131, 24, 100, 245, 175, 244, 150, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 80, 58, 145, 96, 170, 153, 217, 63,
+	16, 93, 80, 223, 50, 167, 242, 63, 177, 252, 249, 182, 96, 169, 196, 63,
+	193, 25, 252, 253, 98, 182, 214, 63, 45, 181, 222, 111, 180, 227, 216, 63,
+	40, 130, 56, 15, 39, 48, 219, 63, 18, 190, 247, 55, 104, 175, 218, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 170, 178, 233, 254, 139, 209, 125, 63,
+	55, 62, 125, 57, 82, 52, 136, 63, 245, 179, 76, 108, 178, 242, 125, 63,
+	19, 86, 200, 255, 17, 189, 140, 63, 43, 105, 22, 32, 41, 29, 114, 63,
+	134, 196, 40, 10, 75, 10, 117, 63, 179, 122, 182, 79, 153, 145, 136, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 83, 122, 166, 151, 24, 203, 212, 63,
+	39, 194, 134, 167, 87, 74, 244, 63, 63, 54, 201, 143, 248, 21, 197, 63,
+	110, 161, 43, 17, 168, 254, 211, 63, 224, 46, 251, 117, 167, 59, 212, 63,
+	253, 216, 36, 63, 226, 87, 213, 63, 156, 78, 178, 213, 229, 148, 212, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 247, 157, 244, 103, 37, 118, 137, 63,
+	164, 146, 18, 39, 69, 131, 160, 63, 173, 238, 146, 24, 38, 203, 128, 63,
+	182, 228, 83, 108, 164, 210, 150, 63, 166, 9, 0, 17, 37, 110, 108, 63,
+	245, 75, 24, 163, 178, 223, 129, 63, 238, 213, 224, 242, 88, 223, 148, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 121, 60, 45, 63, 112, 149, 208, 63,
+	141, 69, 211, 217, 201, 96, 245, 63, 46, 199, 43, 16, 61, 41, 191, 63,
+	53, 207, 17, 249, 46, 165, 213, 63, 94, 214, 196, 2, 95, 209, 213, 63,
+	123, 74, 206, 137, 61, 180, 199, 63, 40, 69, 43, 247, 2, 179, 202, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 58, 112, 121, 24, 191, 75, 95, 63,
+	16, 63, 228, 248, 225, 119, 155, 63, 107, 255, 155, 55, 75, 68, 109, 63,
+	211, 44, 126, 111, 33, 198, 109, 63, 30, 18, 254, 89, 186, 63, 106, 63,
+	199, 123, 35, 121, 18, 15, 141, 63, 151, 224, 129, 45, 69, 42, 150, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 145, 238, 231, 20, 228, 103, 215, 63,
+	16, 117, 31, 128, 212, 166, 247, 63, 10, 219, 79, 198, 248, 48, 222, 63,
+	251, 7, 145, 12, 57, 182, 223, 63, 109, 86, 125, 174, 182, 98, 205, 63,
+	213, 151, 165, 157, 154, 203, 223, 63, 226, 92, 195, 12, 141, 39, 206, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 185, 157, 171, 208, 41, 255, 146, 63,
+	117, 200, 18, 138, 248, 135, 148, 63, 36, 43, 183, 237, 234, 108, 134, 63,
+	222, 141, 212, 183, 149, 134, 157, 63, 66, 208, 136, 4, 209, 1, 145, 63,
+	34, 16, 227, 76, 150, 157, 147, 63, 15, 134, 154, 5, 93, 111, 149, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 154, 153, 153, 153, 153, 153, 233, 63,
+	215, 35, 30, 154, 195, 255, 171, 63, 154, 153, 153, 153, 153, 153, 233, 63,
+	154, 153, 153, 153, 153, 153, 233, 63, 154, 153, 153, 153, 153, 153, 233, 63,
+	154, 153, 153, 153, 153, 153, 233, 63, 154, 153, 153, 153, 153, 153, 233, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	104, 109, 173, 194, 223, 29, 123, 63, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 240, 63, 212, 155, 81, 243, 85, 242, 224, 63,
+	152, 192, 173, 187, 121, 42, 244, 63, 31, 190, 76, 20, 33, 117, 219, 63,
+	197, 26, 46, 114, 79, 87, 228, 63, 152, 190, 215, 16, 28, 151, 216, 63,
+	46, 228, 17, 220, 72, 89, 225, 63, 120, 237, 210, 134, 195, 82, 226, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 129, 52, 107, 145, 67, 124, 116, 63,
+	228, 170, 123, 30, 208, 72, 165, 63, 163, 65, 61, 8, 185, 145, 180, 63,
+	105, 163, 124, 166, 8, 77, 122, 63, 90, 122, 84, 0, 226, 172, 123, 63,
+	166, 211, 13, 223, 109, 67, 130, 63, 154, 26, 53, 225, 74, 189, 130, 63,
+	0, 0, 0, 0, 0, 0, 240, 63, 19, 72, 137, 93, 219, 219, 219, 63,
+	33, 60, 218, 56, 98, 173, 251, 63, 181, 53, 34, 24, 7, 151, 222, 63,
+	242, 40, 149, 240, 132, 94, 205, 63, 66, 119, 73, 156, 21, 209, 224, 63,
+	239, 1, 186, 47, 103, 182, 224, 63, 33, 90, 43, 218, 28, 231, 219, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 106, 106, 170, 235, 96, 143, 131, 63,
+	172, 18, 161, 131, 206, 138, 157, 63, 250, 35, 252, 162, 73, 236, 161, 63,
+	243, 107, 41, 229, 183, 155, 145, 63, 185, 250, 20, 192, 198, 41, 136, 63,
+	40, 26, 118, 37, 109, 165, 116, 63, 1, 24, 13, 47, 146, 207, 144, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 203, 105, 79, 201, 57, 177, 215, 63,
+	168, 53, 205, 59, 78, 209, 245, 63, 118, 165, 101, 164, 222, 83, 213, 63,
+	33, 202, 23, 180, 144, 128, 209, 63, 203, 244, 75, 196, 91, 231, 221, 63,
+	92, 198, 77, 13, 52, 159, 221, 63, 88, 174, 183, 205, 84, 136, 208, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 199, 197, 71, 1, 51, 19, 100, 63,
+	126, 100, 159, 200, 37, 35, 156, 63, 207, 92, 195, 60, 116, 215, 178, 63,
+	45, 131, 96, 88, 76, 216, 108, 63, 214, 85, 199, 60, 76, 27, 119, 63,
+	141, 158, 104, 149, 177, 253, 116, 63, 156, 180, 196, 169, 53, 191, 126, 63,
+	0, 0, 0, 0, 0, 0, 240, 63, 156, 48, 97, 52, 43, 219, 219, 63,
+	33, 60, 218, 56, 98, 173, 251, 63, 45, 206, 24, 230, 4, 109, 222, 63,
+	129, 152, 132, 11, 121, 132, 224, 63, 199, 243, 25, 80, 111, 70, 205, 63,
+	207, 72, 132, 70, 176, 113, 220, 63, 244, 26, 187, 68, 245, 86, 224, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 208, 42, 91, 15, 72, 82, 131, 63,
+	172, 18, 161, 131, 206, 138, 157, 63, 217, 75, 202, 223, 244, 83, 162, 63,
+	34, 92, 75, 129, 147, 131, 149, 63, 220, 117, 251, 8, 240, 147, 142, 63,
+	49, 29, 4, 247, 98, 154, 115, 63, 132, 3, 17, 187, 239, 145, 146, 63,
+	0, 0, 0, 0, 0, 0, 240, 63, 211, 219, 159, 139, 134, 140, 222, 63,
+	253, 130, 221, 176, 109, 209, 242, 63, 158, 153, 96, 56, 215, 48, 210, 63,
+	73, 186, 102, 242, 205, 182, 225, 63, 126, 54, 114, 221, 148, 114, 225, 63,
+	84, 139, 136, 98, 242, 6, 224, 63, 254, 214, 78, 148, 132, 68, 215, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 16, 196, 49, 159, 77, 62, 97, 63,
+	240, 17, 14, 42, 150, 121, 160, 63, 111, 7, 241, 18, 75, 208, 177, 63,
+	219, 234, 141, 195, 246, 61, 137, 63, 137, 246, 224, 139, 95, 164, 139, 63,
+	158, 237, 224, 200, 207, 235, 140, 63, 250, 189, 126, 53, 186, 108, 154, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 88, 142, 144, 129, 60, 187, 212, 63,
+	226, 30, 75, 31, 186, 32, 253, 63, 79, 232, 245, 39, 241, 185, 201, 63,
+	13, 54, 117, 30, 21, 255, 222, 63, 176, 229, 149, 235, 109, 51, 218, 63,
+	243, 226, 196, 87, 59, 138, 213, 63, 57, 37, 32, 38, 225, 66, 196, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 71, 154, 156, 59, 96, 237, 128, 63,
+	195, 77, 161, 54, 91, 42, 170, 63, 98, 247, 199, 23, 19, 195, 105, 63,
+	144, 166, 159, 36, 18, 97, 163, 63, 115, 42, 235, 80, 83, 221, 160, 63,
+	11, 234, 197, 223, 94, 195, 169, 63, 170, 37, 148, 233, 72, 122, 175, 63,
+	0, 0, 0, 0, 0, 0, 240, 63, 27, 245, 16, 141, 238, 32, 223, 63,
+	142, 175, 61, 179, 36, 64, 251, 63, 247, 142, 26, 19, 98, 46, 220, 63,
+	70, 12, 59, 140, 73, 127, 224, 63, 61, 210, 224, 182, 182, 240, 220, 63,
+	230, 31, 125, 147, 166, 65, 216, 63, 212, 158, 146, 115, 98, 15, 226, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 193, 79, 196, 169, 159, 205, 99, 63,
+	104, 213, 128, 137, 163, 17, 168, 63, 146, 6, 30, 104, 129, 173, 171, 63,
+	68, 110, 22, 244, 50, 229, 139, 63, 162, 229, 196, 119, 201, 37, 121, 63,
+	234, 126, 243, 250, 251, 26, 112, 63, 148, 38, 162, 196, 80, 225, 130, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 139, 250, 36, 119, 216, 68, 219, 63,
+	194, 81, 242, 234, 28, 131, 253, 63, 87, 205, 115, 68, 190, 203, 227, 63,
+	240, 51, 46, 28, 8, 201, 208, 63, 150, 175, 203, 240, 159, 110, 225, 63,
+	120, 213, 3, 230, 33, 83, 220, 63, 167, 173, 17, 193, 56, 184, 218, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 3, 179, 95, 152, 24, 129, 125, 63,
+	139, 13, 127, 24, 112, 55, 162, 63, 14, 58, 164, 81, 165, 9, 135, 63,
+	115, 100, 216, 188, 191, 98, 136, 63, 190, 13, 209, 7, 145, 233, 139, 63,
+	90, 75, 252, 107, 203, 248, 144, 63, 159, 64, 0, 65, 36, 97, 136, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 154, 8, 27, 158, 94, 41, 210, 63,
+	250, 213, 28, 32, 152, 163, 251, 63, 90, 188, 88, 24, 34, 167, 209, 63,
+	179, 125, 200, 91, 174, 126, 198, 63, 55, 227, 52, 68, 21, 254, 209, 63,
+	170, 10, 13, 196, 178, 153, 215, 63, 113, 229, 236, 157, 209, 86, 216, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 135, 146, 36, 234, 139, 238, 132, 63,
+	122, 3, 212, 201, 231, 1, 154, 63, 133, 160, 167, 242, 37, 183, 115, 63,
+	94, 72, 54, 113, 246, 39, 150, 63, 94, 162, 49, 46, 143, 155, 156, 63,
+	250, 179, 206, 218, 33, 67, 159, 63, 167, 23, 216, 27, 57, 137, 150, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 182, 77, 241, 184, 168, 22, 215, 63,
+	160, 50, 254, 125, 198, 197, 10, 64, 231, 169, 14, 185, 25, 110, 219, 63,
+	86, 128, 239, 54, 111, 28, 225, 63, 106, 222, 113, 138, 142, 228, 186, 63,
+	145, 97, 21, 111, 100, 30, 195, 63, 235, 199, 38, 249, 17, 63, 227, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 117, 22, 232, 52, 106, 246, 132, 63,
+	81, 31, 134, 222, 7, 241, 178, 63, 126, 58, 21, 51, 220, 72, 122, 63,
+	128, 203, 119, 21, 148, 86, 148, 63, 7, 232, 69, 169, 18, 122, 127, 63,
+	246, 202, 90, 150, 240, 25, 113, 63, 23, 202, 238, 122, 159, 45, 141, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 184, 34, 49, 65, 13, 223, 215, 63,
+	162, 93, 133, 148, 159, 84, 250, 63, 64, 78, 152, 48, 154, 149, 219, 63,
+	234, 204, 61, 36, 124, 239, 197, 63, 155, 0, 195, 242, 231, 219, 218, 63,
+	231, 143, 105, 109, 26, 219, 226, 63, 197, 89, 17, 53, 209, 231, 211, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 39, 42, 183, 113, 25, 241, 117, 63,
+	42, 207, 181, 68, 215, 249, 163, 63, 145, 119, 250, 22, 4, 52, 109, 63,
+	44, 45, 123, 137, 237, 109, 118, 63, 13, 202, 238, 67, 152, 117, 130, 63,
+	86, 70, 186, 110, 248, 126, 125, 63, 200, 7, 208, 96, 153, 188, 144, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 120, 207, 129, 229, 8, 25, 210, 63,
+	31, 162, 209, 29, 196, 206, 253, 63, 232, 190, 156, 217, 174, 208, 203, 63,
+	165, 162, 177, 246, 119, 182, 195, 63, 202, 84, 193, 168, 164, 78, 222, 63,
+	112, 94, 156, 248, 106, 71, 210, 63, 19, 183, 10, 98, 160, 107, 212, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 52, 20, 183, 96, 181, 110, 114, 63,
+	36, 143, 196, 106, 203, 5, 156, 63, 205, 87, 156, 141, 90, 114, 114, 63,
+	14, 83, 85, 60, 231, 192, 159, 63, 94, 41, 232, 46, 140, 77, 139, 63,
+	69, 227, 150, 45, 27, 98, 130, 63, 7, 197, 232, 249, 196, 117, 141, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 186, 247, 112, 201, 113, 39, 225, 63,
+	23, 241, 157, 152, 245, 226, 241, 63, 10, 102, 76, 193, 26, 231, 229, 63,
+	63, 196, 6, 11, 39, 105, 226, 63, 205, 91, 117, 29, 170, 169, 227, 63,
+	79, 4, 113, 30, 78, 96, 223, 63, 75, 33, 144, 75, 28, 121, 224, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 236, 27, 191, 246, 210, 91, 161, 63,
+	229, 87, 127, 148, 255, 197, 153, 63, 252, 98, 135, 199, 39, 173, 172, 63,
+	66, 72, 201, 121, 94, 94, 163, 63, 168, 56, 19, 25, 10, 22, 160, 63,
+	170, 192, 180, 24, 91, 106, 161, 63, 163, 11, 182, 252, 156, 152, 165, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 34, 56, 46, 227, 166, 6, 224, 63,
+	141, 93, 162, 122, 107, 96, 245, 63, 61, 186, 17, 22, 21, 241, 229, 63,
+	82, 68, 134, 85, 188, 145, 224, 63, 234, 93, 188, 31, 183, 95, 226, 63,
+	217, 8, 196, 235, 250, 5, 220, 63, 82, 242, 234, 28, 3, 178, 218, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 69, 149, 225, 31, 58, 116, 136, 63,
+	20, 7, 207, 232, 84, 178, 148, 63, 224, 232, 80, 183, 114, 82, 176, 63,
+	125, 65, 5, 230, 188, 17, 115, 63, 241, 161, 214, 101, 21, 85, 150, 63,
+	192, 8, 99, 128, 199, 0, 146, 63, 11, 7, 149, 73, 87, 192, 136, 63,
+	0, 0, 0, 0, 0, 0, 240, 63, 79, 177, 106, 16, 230, 118, 221, 63,
+	67, 86, 183, 122, 78, 122, 243, 63, 130, 229, 8, 25, 200, 179, 212, 63,
+	235, 31, 68, 50, 228, 216, 220, 63, 53, 65, 212, 125, 0, 82, 221, 63,
+	249, 186, 12, 255, 233, 6, 221, 63, 181, 51, 76, 109, 169, 131, 220, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 211, 135, 33, 67, 251, 31, 112, 63,
+	113, 37, 34, 23, 195, 225, 168, 63, 111, 43, 4, 198, 189, 93, 169, 63,
+	218, 111, 68, 191, 150, 49, 118, 63, 158, 18, 186, 236, 59, 115, 124, 63,
+	181, 227, 177, 3, 2, 147, 139, 63, 196, 46, 202, 67, 21, 215, 125, 63,
+	0, 0, 0, 0, 0, 0, 240, 63, 131, 252, 108, 228, 186, 41, 220, 63,
+	240, 133, 201, 84, 193, 40, 251, 63, 238, 96, 196, 62, 1, 20, 223, 63,
+	221, 237, 122, 105, 138, 0, 220, 63, 121, 177, 48, 68, 78, 223, 224, 63,
+	151, 112, 232, 45, 30, 222, 224, 63, 178, 100, 142, 229, 93, 245, 206, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 70, 73, 196, 62, 189, 145, 127, 63,
+	199, 103, 96, 10, 92, 194, 165, 63, 75, 173, 190, 223, 82, 176, 166, 63,
+	160, 231, 206, 169, 162, 85, 137, 63, 201, 209, 63, 23, 157, 49, 143, 63,
+	207, 105, 78, 40, 171, 47, 130, 63, 162, 145, 113, 51, 128, 125, 132, 63,
+	0, 0, 0, 0, 0, 0, 240, 63, 166, 99, 206, 51, 246, 37, 220, 63,
+	240, 133, 201, 84, 193, 40, 251, 63, 56, 17, 253, 218, 250, 233, 222, 63,
+	150, 152, 103, 37, 173, 120, 224, 63, 169, 216, 152, 215, 17, 135, 220, 63,
+	228, 103, 35, 215, 77, 41, 207, 63, 8, 33, 32, 95, 66, 133, 224, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 144, 45, 179, 8, 145, 88, 127, 63,
+	199, 103, 96, 10, 92, 194, 165, 63, 2, 75, 75, 50, 113, 73, 167, 63,
+	19, 172, 227, 73, 147, 116, 138, 63, 197, 241, 64, 114, 194, 170, 116, 63,
+	71, 203, 42, 150, 139, 187, 128, 63, 65, 196, 244, 158, 120, 66, 148, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 97, 113, 56, 243, 171, 57, 214, 63,
+	235, 197, 80, 78, 180, 43, 247, 63, 118, 169, 17, 250, 153, 122, 222, 63,
+	108, 5, 77, 75, 172, 140, 209, 63, 78, 124, 181, 163, 56, 199, 227, 63,
+	218, 227, 133, 116, 120, 8, 222, 63, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 90, 123, 61, 168, 18, 80, 129, 63,
+	205, 133, 58, 2, 216, 184, 155, 63, 82, 204, 230, 186, 24, 158, 168, 63,
+	66, 63, 136, 178, 203, 79, 140, 63, 159, 42, 19, 188, 181, 68, 148, 63,
+	137, 10, 88, 136, 207, 198, 148, 63, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 206, 196, 116, 33, 86, 127, 221, 63,
+	19, 68, 221, 7, 32, 181, 246, 63, 201, 61, 93, 221, 177, 216, 213, 63,
+	225, 9, 189, 254, 36, 62, 212, 63, 179, 178, 125, 200, 91, 174, 227, 63,
+	229, 211, 99, 91, 6, 156, 213, 63, 25, 230, 4, 109, 114, 248, 226, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 36, 204, 210, 206, 233, 255, 101, 63,
+	195, 81, 24, 156, 151, 253, 169, 63, 214, 185, 136, 129, 119, 4, 180, 63,
+	195, 116, 0, 218, 70, 112, 127, 63, 103, 128, 190, 111, 187, 69, 142, 63,
+	38, 51, 173, 248, 193, 178, 112, 63, 125, 19, 73, 225, 169, 191, 126, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 18, 131, 192, 202, 161, 69, 213, 63,
+	39, 218, 85, 72, 249, 201, 249, 63, 121, 62, 3, 234, 205, 168, 203, 63,
+	207, 18, 100, 4, 84, 56, 211, 63, 179, 10, 155, 1, 46, 200, 223, 63,
+	119, 191, 10, 240, 221, 230, 211, 63, 106, 80, 52, 15, 96, 145, 211, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 165, 133, 133, 30, 59, 10, 110, 63,
+	78, 111, 135, 135, 149, 221, 160, 63, 161, 115, 243, 250, 204, 53, 110, 63,
+	252, 123, 24, 174, 249, 79, 160, 63, 20, 113, 237, 182, 243, 54, 153, 63,
+	146, 103, 88, 189, 10, 180, 160, 63, 84, 139, 226, 216, 158, 216, 153, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 121, 115, 184, 86, 123, 216, 223, 63,
+	75, 229, 237, 8, 167, 133, 245, 63, 78, 37, 3, 64, 21, 55, 229, 63,
+	82, 242, 234, 28, 3, 178, 218, 63, 217, 8, 196, 235, 250, 5, 220, 63,
+	11, 123, 218, 225, 175, 201, 224, 63, 216, 44, 151, 141, 206, 121, 225, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 157, 59, 186, 30, 81, 167, 130, 63,
+	87, 115, 225, 107, 67, 225, 148, 63, 121, 122, 211, 114, 22, 192, 169, 63,
+	11, 7, 149, 73, 87, 192, 136, 63, 192, 8, 99, 128, 199, 0, 146, 63,
+	251, 46, 107, 248, 85, 210, 132, 63, 138, 96, 187, 36, 158, 215, 123, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 31, 48, 15, 153, 242, 33, 214, 63,
+	59, 252, 53, 89, 163, 158, 241, 63, 203, 213, 143, 77, 242, 35, 196, 63,
+	227, 52, 68, 21, 254, 12, 214, 63, 238, 119, 40, 10, 244, 137, 214, 63,
+	66, 67, 255, 4, 23, 43, 213, 63, 178, 127, 158, 6, 12, 146, 213, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 83, 237, 118, 42, 188, 87, 117, 63,
+	215, 40, 120, 226, 144, 133, 133, 63, 43, 190, 251, 185, 82, 172, 132, 63,
+	246, 210, 225, 197, 242, 105, 134, 63, 152, 51, 97, 0, 79, 156, 128, 63,
+	215, 139, 156, 118, 72, 10, 112, 63, 36, 151, 149, 28, 247, 80, 127, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 155, 4, 111, 72, 163, 2, 217, 63,
+	166, 66, 60, 18, 47, 79, 237, 63, 249, 75, 139, 250, 36, 119, 198, 63,
+	78, 184, 87, 230, 173, 186, 214, 63, 37, 88, 28, 206, 252, 106, 214, 63,
+	14, 248, 252, 48, 66, 120, 219, 63, 147, 138, 198, 218, 223, 217, 218, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 240, 72, 145, 237, 1, 194, 86, 63,
+	24, 4, 86, 14, 45, 178, 125, 63, 53, 80, 4, 154, 174, 117, 130, 63,
+	188, 88, 196, 101, 79, 19, 128, 63, 53, 70, 58, 199, 191, 93, 105, 63,
+	101, 160, 30, 237, 230, 113, 128, 63, 88, 133, 7, 13, 150, 87, 119, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 142, 119, 71, 198, 106, 243, 214, 63,
+	93, 138, 171, 202, 190, 43, 241, 63, 40, 42, 27, 214, 84, 22, 201, 63,
+	32, 154, 121, 114, 77, 129, 214, 63, 49, 67, 227, 137, 32, 206, 213, 63,
+	54, 172, 169, 44, 10, 187, 214, 63, 118, 113, 27, 13, 224, 45, 215, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 34, 124, 224, 145, 23, 171, 121, 63,
+	54, 92, 109, 209, 97, 239, 146, 63, 189, 90, 149, 39, 247, 178, 136, 63,
+	187, 180, 206, 46, 210, 85, 139, 63, 94, 196, 127, 26, 46, 96, 121, 63,
+	91, 86, 91, 251, 100, 58, 116, 63, 193, 205, 53, 240, 176, 10, 117, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 220, 189, 220, 39, 71, 1, 212, 63,
+	44, 43, 77, 74, 65, 55, 248, 63, 56, 103, 68, 105, 111, 240, 193, 63,
+	191, 71, 253, 245, 10, 11, 214, 63, 48, 16, 4, 200, 208, 177, 214, 63,
+	140, 244, 162, 118, 191, 10, 216, 63, 0, 113, 87, 175, 34, 163, 199, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 45, 30, 146, 164, 221, 76, 116, 63,
+	52, 177, 114, 76, 245, 202, 158, 63, 243, 219, 33, 146, 233, 154, 131, 63,
+	50, 85, 156, 188, 65, 231, 138, 63, 106, 242, 235, 184, 225, 84, 133, 63,
+	64, 209, 41, 103, 86, 240, 130, 63, 242, 47, 122, 85, 36, 72, 130, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 212, 95, 175, 176, 224, 126, 220, 63,
+	45, 207, 131, 187, 179, 118, 245, 63, 147, 56, 43, 162, 38, 122, 225, 63,
+	16, 149, 70, 204, 236, 243, 226, 63, 40, 70, 150, 204, 177, 188, 209, 63,
+	33, 86, 127, 132, 97, 192, 226, 63, 100, 205, 200, 32, 119, 17, 212, 63,
+	0, 0, 0, 0, 0, 0, 0, 0, 116, 147, 199, 14, 89, 130, 125, 63,
+	14, 249, 117, 186, 168, 255, 138, 63, 190, 124, 98, 202, 155, 195, 126, 63,
+	30, 28, 193, 1, 52, 209, 129, 63, 23, 143, 160, 241, 68, 195, 146, 63,
+	136, 232, 179, 147, 9, 107, 128, 63, 12, 170, 56, 168, 14, 231, 125, 63,
+};
+
+/// Embeds every font while the program starts
+struct Embed
+{
+	Embed()
+	{
+		OCR::Font::embed("freesans", font0, sizeof(font0));
+		OCR::Font::embed("monospace", font1, sizeof(font1));
+	}
+} embed;
+
+} // namespace
@@ -0,0 +1,220 @@
+/**
+ * @file BinaryImage.cpp
+ * @date October 2026
+ * @author Omophagic Content Reader contributors
+ * @brief The implementation of the BinaryImage class.
+ * @see BinaryImage.h for the interface and documentation.
+ * @version $Id$
+ */
+/*
+ * Copyright 2026 Omophagic Content Reader contributors
+ *
+ * This file is part of Omophagic Content Reader.
+ *
+ * Omophagic Content Reader is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Omophagic Content Reader is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Omophagic Content Reader.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "BinaryImage.h"
+#include "Profile.h"
+namespace OCR
+{
+
+/**
+ * Binarizes part of an image
+ * @param img    the bitmap image
+ * @param region part of the image to copy, clipped to the image
+ */
+BinaryImage::BinaryImage(BMP & img, const Box & region) :
+	bounds(region)
+{
+	OCR_PROFILE_TIME(BINARIZE);
+	if (bounds.high.x >= (unsigned) img.TellWidth())
+		bounds.high.x = img.TellWidth() - 1;
+	if (bounds.high.y >= (unsigned) img.TellHeight())
+		bounds.high.y = img.TellHeight() - 1;
+	width = bounds.width();
+	height = bounds.height();
+	OCR_PROFILE_COUNT(PIXELS, width * height);
+
+	// Copy each column, then add it to the summed-area table
+	pixels.resize(width * height);
+	sums.assign((width + 1) * (height + 1), 0);
+	for (unsigned x = 0; x < width; ++x)
+	{
+		unsigned columnCount = 0;
+		for (unsigned y = 0; y < height; ++y)
+		{
+			pixels[x * height + y] = isForeground(img(bounds.low.x + x,
+			        bounds.low.y + y));
+			columnCount += pixels[x * height + y];
+			sums[(x + 1) * (height + 1) + y + 1] = sums[x * (height + 1) + y
+			        + 1] + columnCount;
+		}
+	}
+}
+
+/**
+ * Counts the foreground pixels within an area in constant time
+ * @param area area to check (inclusive)
+ * @return number of foreground pixels
+ */
+unsigned BinaryImage::count(const Box & area) const
+{
+	// Clip to the copied region
+	unsigned x1 = area.low.x > bounds.low.x ? area.low.x : bounds.low.x;
+	unsigned y1 = area.low.y > bounds.low.y ? area.low.y : bounds.low.y;
+	unsigned x2 = area.high.x < bounds.high.x ? area.high.x : bounds.high.x;
+	unsigned y2 = area.high.y < bounds.high.y ? area.high.y : bounds.high.y;
+	if (x1 > x2 || y1 > y2)
+		return 0;
+
+	// Convert to exclusive local coordinates
+	x1 -= bounds.low.x;
+	y1 -= bounds.low.y;
+	x2 -= bounds.low.x - 1;
+	y2 -= bounds.low.y - 1;
+	return sums[x2 * (height + 1) + y2] - sums[x1 * (height + 1) + y2]
+	        - sums[x2 * (height + 1) + y1] + sums[x1 * (height + 1) + y1];
+}
+
+/**
+ * Counts the foreground pixels on the border of part of the image,
+ * in the order Box::edge_iterator visits it
+ * @param[in]  part   area whose border to check
+ * @param[out] length number of pixels on the border
+ * @return number of foreground pixels on the border
+ */
+unsigned BinaryImage::countBorder(const Box & part, unsigned & length) const
+{
+	const unsigned w = part.width(), h = part.height();
+	if (w > 1 && h > 1)
+	{
+		length = 2 * (w + h) - 4;
+		unsigned border = count(Box(part.low.x, part.low.y, part.high.x,
+		        part.low.y)) + count(Box(part.low.x, part.high.y, part.high.x,
+		        part.high.y));
+		if (h > 2)
+			border += count(Box(part.low.x, part.low.y + 1, part.low.x,
+			        part.high.y - 1)) + count(Box(part.high.x, part.low.y + 1,
+			        part.high.x, part.high.y - 1));
+		return border;
+	}
+	if (w > 1)
+	{
+		length = w - 1;
+		return count(Box(part.low.x, part.low.y, part.high.x - 1, part.low.y));
+	}
+	length = h - 1;
+	return h > 1 ? count(Box(part.low.x, part.low.y, part.low.x, part.high.y
+	        - 1)) : 0;
+}
+
+/**
+ * Sets the corners of a box
+ * such that they surround the foreground pixels contained
+ * @param[in,out] part box to shrink
+ */
+void BinaryImage::pareDown(Box & part) const
+{
+	// Pare top
+	while (part.low.y <= part.high.y && !count(Box(part.low.x, part.low.y,
+	        part.high.x, part.low.y)))
+		++part.low.y;
+	// Pare bottom
+	while (part.high.y >= part.low.y && !count(Box(part.low.x, part.high.y,
+	        part.high.x, part.high.y)))
+		--part.high.y;
+	// Pare left
+	while (part.low.x <= part.high.x && !count(Box(part.low.x, part.low.y,
+	        part.low.x, part.high.y)))
+		++part.low.x;
+	// Pare right
+	while (part.high.x >= part.low.x && !count(Box(part.high.x, part.low.y,
+	        part.high.x, part.high.y)))
+		--part.high.x;
+}
+
+/**
+ * Counts the number of "holes" within part of the image
+ * @param part area to check
+ * @return number of background areas not connected to the edge of part
+ */
+unsigned char BinaryImage::countHoles(const Box & part) const
+{
+	OCR_PROFILE_TIME(HOLES);
+	const int w = part.width(), h = part.height();
+	unsigned char holeCount = 0;
+	if (w < 3 || h < 3)
+		return holeCount;
+
+	// Mark foreground pixels as visited, so only background is searched
+	std::vector<unsigned char> visited(w * h);
+	for (int x = 0; x < w; ++x)
+		for (int y = 0; y < h; ++y)
+			visited[x * h + y] = (*this)(part.low.x + x, part.low.y + y);
+
+	// Do a search from each background edge pixel
+	std::vector<int> toVisit;
+	for (int x = 0; x < w; ++x)
+		for (int y = 0; y < h; y += (x == 0 || x == w - 1) ? 1 : h - 1)
+			if (!visited[x * h + y])
+			{
+				visited[x * h + y] = true;
+				toVisit.push_back(x * h + y);
+			}
+	fill(visited, toVisit, w, h);
+
+	// Any remaining background pixel is part of a new hole
+	for (int x = 1; x < w - 1; ++x)
+		for (int y = 1; y < h - 1; ++y)
+			if (!visited[x * h + y])
+			{
+				visited[x * h + y] = true;
+				toVisit.push_back(x * h + y);
+				fill(visited, toVisit, w, h);
+				++holeCount;
+			}
+
+	return holeCount;
+}
+
+/**
+ * Visits all background pixels eight-connected to those to visit
+ * @param[in,out] visited which pixels have been visited, column by column
+ * @param[in,out] toVisit indices of pixels to search from; emptied
+ * @param[in]     w       width of the area
+ * @param[in]     h       height of the area
+ */
+void BinaryImage::fill(std::vector<unsigned char> & visited,
+        std::vector<int> & toVisit, int w, int h)
+{
+	unsigned long long pushes = toVisit.size();
+	while (!toVisit.empty())
+	{
+		int x = toVisit.back() / h, y = toVisit.back() % h;
+		toVisit.pop_back();
+		for (int nx = (x > 0 ? x - 1 : 0); nx <= x + 1 && nx < w; ++nx)
+			for (int ny = (y > 0 ? y - 1 : 0); ny <= y + 1 && ny < h; ++ny)
+				if (!visited[nx * h + ny])
+				{
+					visited[nx * h + ny] = true;
+					toVisit.push_back(nx * h + ny);
+					++pushes;
+				}
+	}
+	OCR_PROFILE_COUNT(PUSHES, pushes);
+}
+
+} // namespace OCR
@@ -0,0 +1,133 @@
+/**
+ * @file BinaryImage.h
+ * @date October 2026
+ * @author Omophagic Content Reader contributors
+ * @brief The interface and documentation of the BinaryImage class.
+ * @see BinaryImage.cpp for the implementation.
+ * @version $Id$
+ */
+/*
+ * Copyright 2026 Omophagic Content Reader contributors
+ *
+ * This file is part of Omophagic Content Reader.
+ *
+ * Omophagic Content Reader is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Omophagic Content Reader is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Omophagic Content Reader.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef OCR_BINARYIMAGE_H_
+#define OCR_BINARYIMAGE_H_
+#include <vector>
+#include "EasyBMP/EasyBMP.h"
+#include "OCR.h"
+
+namespace OCR
+{
+
+/**
+ * A foreground/background copy of part of a BMP,
+ * with a summed-area table for counting foreground pixels.
+ *
+ * Pixels are stored column by column, the same order as in a BMP,
+ * so that binarizing a region reads the image sequentially.
+ * All coordinates are those of the original image;
+ * pixels outside the region are background.
+ */
+class BinaryImage
+{
+public:
+	/**
+	 * Binarizes part of an image
+	 * @param img    the bitmap image
+	 * @param region part of the image to copy, clipped to the image
+	 */
+	BinaryImage(BMP & img, const Box & region);
+
+	/**
+	 * Determines whether a pixel is a foreground pixel
+	 * @param x X coordinate
+	 * @param y Y coordinate
+	 * @return whether this is a foreground pixel
+	 */
+	bool operator()(unsigned x, unsigned y) const
+	{
+		if (x < bounds.low.x || x > bounds.high.x || y < bounds.low.y || y
+		        > bounds.high.y)
+			return false;
+		return pixels[(x - bounds.low.x) * height + (y - bounds.low.y)];
+	}
+
+	/**
+	 * Counts the foreground pixels within an area in constant time
+	 * @param area area to check (inclusive)
+	 * @return number of foreground pixels
+	 */
+	unsigned count(const Box & area) const;
+
+	/**
+	 * Counts the foreground pixels on the border of part of the image,
+	 * in the order Box::edge_iterator visits it
+	 * @param[in]  part   area whose border to check
+	 * @param[out] length number of pixels on the border
+	 * @return number of foreground pixels on the border
+	 */
+	unsigned countBorder(const Box & part, unsigned & length) const;
+
+	/**
+	 * Sets the corners of a box
+	 * such that they surround the foreground pixels contained
+	 * @param[in,out] part box to shrink
+	 */
+	void pareDown(Box & part) const;
+
+	/**
+	 * Counts the number of "holes" within part of the image
+	 * @param part area to check
+	 * @return number of background areas not connected to the edge of part
+	 */
+	unsigned char countHoles(const Box & part) const;
+
+	/**
+	 * Get the part of the image that was copied
+	 * @return region of the image
+	 */
+	const Box & region() const
+	{
+		return bounds;
+	}
+
+private:
+	/**
+	 * Visits all background pixels eight-connected to those to visit
+	 * @param[in,out] visited which pixels have been visited, column by column
+	 * @param[in,out] toVisit indices of pixels to search from; emptied
+	 * @param[in]     w       width of the area
+	 * @param[in]     h       height of the area
+	 */
+	static void fill(std::vector<unsigned char> & visited,
+	        std::vector<int> & toVisit, int w, int h);
+
+	/// The part of the image copied
+	Box bounds;
+	/// Dimensions of the region
+	unsigned width, height;
+	/// Whether each pixel is foreground, column by column
+	std::vector<unsigned char> pixels;
+	/// Foreground pixels above and left of each point, (width+1) x (height+1)
+	std::vector<unsigned> sums;
+};
+
+} // namespace OCR
+
+#endif /*OCR_BINARYIMAGE_H_*/
@@ -55,6 +55,18 @@ struct Point
 	{
 	}
 
+	/**
+	 * Copies the coordinates of another Point
+	 * @param other another Point
+	 * @return this Point
+	 */
+	Point & operator=(const Point & other)
+	{
+		x = other.x;
+		y = other.y;
+		return *this;
+	}
+
 	/**
 	 * Equality operator
 	 * @param rhs another Point
@@ -123,6 +135,18 @@ public:
 	{
 	}
 
+	/**
+	 * Copies the corners of another Box
+	 * @param other another Box
+	 * @return this Box
+	 */
+	Box & operator=(const Box & other)
+	{
+		low = other.low;
+		high = other.high;
+		return *this;
+	}
+
 	/**
 	 * Get the width of the box
 	 * @return box width
@@ -0,0 +1,334 @@
+/**
+ * @file FeatureBatch.cpp
+ * @date October 2026
+ * @author Omophagic Content Reader contributors
+ * @brief The implementation of the FeatureBatch class.
+ * @see FeatureBatch.h for the interface and documentation.
+ * @version $Id$
+ */
+/*
+ * Copyright 2026 Omophagic Content Reader contributors
+ *
+ * This file is part of Omophagic Content Reader.
+ *
+ * Omophagic Content Reader is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Omophagic Content Reader is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Omophagic Content Reader.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "FeatureBatch.h"
+#include "Profile.h"
+namespace OCR
+{
+
+/**
+ * Divides one column of counts by another
+ * @param[in]  numerator   counts to divide
+ * @param[in]  denominator counts to divide by
+ * @param[out] quotient    result, resized to match
+ */
+static void divide(const std::vector<unsigned> & numerator,
+        const std::vector<unsigned> & denominator,
+        std::vector<double> & quotient)
+{
+	const unsigned n = numerator.size();
+	quotient.resize(n);
+	for (unsigned i = 0; i < n; ++i)
+		quotient[i] = numerator[i] / (double) denominator[i];
+}
+
+/**
+ * Initializes an empty batch
+ * @param optional which Optional information to extract, combined with |
+ * @param grid     size of the grid for ZONES
+ */
+FeatureBatch::FeatureBatch(unsigned optional, const Zones & grid) :
+	optional(optional), grid(grid)
+{
+}
+
+/**
+ * Extracts statistics on characters in a binarized image
+ * @param img   binarized image containing the characters
+ * @param parts the part of the image for each character
+ * @param cache optionally reuse statistics of characters already read
+ */
+void FeatureBatch::extract(const BinaryImage & img,
+        const std::vector<Box> & parts, GlyphCache * cache)
+{
+	OCR_PROFILE_TIME(EXTRACT);
+	const unsigned n = parts.size();
+	this->parts = parts;
+	cached.assign(n, false);
+	characters.assign(n, '\0');
+	confidence.assign(n, 0);
+	keys.resize(cache ? n : 0);
+	std::vector<GlyphCache::Glyph> glyphs(cache ? n : 0);
+	holes.resize(n);
+	templates.resize(optional & RASTER ? n : 0);
+	zones.resize(optional & ZONES ? n : 0);
+	quantized.assign(optional & QUANTIZED ? n : 0, QuantizedSymbol());
+	width.resize(n);
+	height.resize(n);
+	borderLength.resize(n);
+	foreground.total.resize(n);
+	foreground.border.resize(n);
+	foreground.q1.resize(n);
+	foreground.q2.resize(n);
+	foreground.q3.resize(n);
+	foreground.q4.resize(n);
+	foreground.mid1.resize(n);
+	foreground.mid2.resize(n);
+	area.q1.resize(n);
+	area.q2.resize(n);
+	area.q3.resize(n);
+	area.q4.resize(n);
+	area.mid1.resize(n);
+	area.mid2.resize(n);
+
+	// Count pixels for each character
+	for (unsigned i = 0; i < n; ++i)
+	{
+		OCR_PROFILE_GLYPH(i);
+		OCR_PROFILE_TIME(GRAPHEME);
+		Box & part = this->parts[i];
+		img.pareDown(part);
+		width[i] = part.width();
+		height[i] = part.height();
+
+		// Skip characters that have been seen before
+		if (cache)
+		{
+			keys[i] = GlyphCache::Key(img, part);
+			if (cache->find(keys[i], optional, grid, glyphs[i]))
+			{
+				cached[i] = true;
+				continue;
+			}
+		}
+
+		if (optional & RASTER)
+			templates[i] = Template(img, part);
+		if (optional & ZONES)
+			zones[i] = Zones(img, part, grid.rows, grid.cols);
+		holes[i] = img.countHoles(part);
+		foreground.total[i] = img.count(part);
+
+		// Border, in the order Box::edge_iterator visits it
+		foreground.border[i] = img.countBorder(part, borderLength[i]);
+
+		// Quadrants and middle lines
+		unsigned midWidth = part.low.x + ((part.high.x - part.low.x) / 2);
+		unsigned midHeight = part.low.y + ((part.high.y - part.low.y) / 2);
+		Box q2(part.low.x, part.low.y, midWidth, midHeight);
+		Box q1(midWidth, part.low.y, part.high.x, midHeight);
+		Box q3(part.low.x, midHeight, midWidth, part.high.y);
+		Box q4(midWidth, midHeight, part.high.x, part.high.y);
+		Box mid1(midWidth, part.low.y, midWidth, part.high.y);
+		Box mid2(part.low.x, midHeight, part.high.x, midHeight);
+		foreground.q1[i] = img.count(q1);
+		foreground.q2[i] = img.count(q2);
+		foreground.q3[i] = img.count(q3);
+		foreground.q4[i] = img.count(q4);
+		foreground.mid1[i] = img.count(mid1);
+		foreground.mid2[i] = img.count(mid2);
+		area.q1[i] = q1.area();
+		area.q2[i] = q2.area();
+		area.q3[i] = q3.area();
+		area.q4[i] = q4.area();
+		area.mid1[i] = mid1.area();
+		area.mid2[i] = mid2.area();
+	}
+
+	// Compute each statistic for every character
+	divide(height, width, proportion);
+	std::vector<unsigned> totalArea(n);
+	for (unsigned i = 0; i < n; ++i)
+		totalArea[i] = width[i] * height[i];
+	divide(foreground.total, totalArea, density.total);
+	divide(foreground.border, borderLength, density.border);
+	divide(foreground.q1, area.q1, density.q1);
+	divide(foreground.q2, area.q2, density.q2);
+	divide(foreground.q3, area.q3, density.q3);
+	divide(foreground.q4, area.q4, density.q4);
+	divide(foreground.mid1, area.mid1, density.mid1);
+	divide(foreground.mid2, area.mid2, density.mid2);
+
+	// Round the same counts to integers, without going through doubles
+	if (optional & QUANTIZED)
+		for (unsigned i = 0; i < n; ++i)
+		{
+			if (cached[i])
+				continue;
+			QuantizedSymbol & q = quantized[i];
+			unsigned proportion = QuantizedSymbol::ratio(height[i], width[i]);
+			q.holes = holes[i];
+			q.proportion = proportion < 65535 ? proportion : 65535;
+			q.set(QuantizedSymbol::TOTAL, QuantizedSymbol::ratio(
+			        foreground.total[i], totalArea[i]));
+			q.set(QuantizedSymbol::BORDER, QuantizedSymbol::ratio(
+			        foreground.border[i], borderLength[i]));
+			q.set(QuantizedSymbol::Q1, QuantizedSymbol::ratio(
+			        foreground.q1[i], area.q1[i]));
+			q.set(QuantizedSymbol::Q2, QuantizedSymbol::ratio(
+			        foreground.q2[i], area.q2[i]));
+			q.set(QuantizedSymbol::Q3, QuantizedSymbol::ratio(
+			        foreground.q3[i], area.q3[i]));
+			q.set(QuantizedSymbol::Q4, QuantizedSymbol::ratio(
+			        foreground.q4[i], area.q4[i]));
+		}
+
+	// Fill in cached characters as they were first extracted
+	for (unsigned i = 0; i < n; ++i)
+		if (cached[i])
+		{
+			setSymbol(i, glyphs[i].symbol);
+			characters[i] = glyphs[i].character;
+			confidence[i] = glyphs[i].confidence;
+			if (optional & RASTER)
+				templates[i] = glyphs[i].raster;
+			if (optional & ZONES)
+				zones[i] = glyphs[i].zones;
+			if (optional & QUANTIZED)
+				quantized[i] = glyphs[i].quantized;
+		}
+}
+
+/**
+ * Extracts statistics on characters anywhere in a BMP image
+ * @param img   reference to BMP
+ * @param parts the part of the image for each character
+ */
+void FeatureBatch::extract(BMP & img, const std::vector<Box> & parts)
+{
+	Box region;
+	if (!parts.empty())
+		region = parts.front();
+	for (unsigned i = 1; i < parts.size(); ++i)
+		region.extendToInclude(parts[i]);
+	extract(BinaryImage(img, region), parts);
+}
+
+/**
+ * Appends one column to another
+ * @param[in,out] column column to add to
+ * @param[in]     other  column to add
+ */
+template<typename T>
+static void appendColumn(std::vector<T> & column, const std::vector<T> & other)
+{
+	column.insert(column.end(), other.begin(), other.end());
+}
+
+/**
+ * Adds the characters of another batch to the end of this one.
+ * Optional information is only kept if both batches have it.
+ * @param other another batch
+ */
+void FeatureBatch::append(const FeatureBatch & other)
+{
+	optional &= other.optional;
+	appendColumn(cached, other.cached);
+	appendColumn(characters, other.characters);
+	appendColumn(confidence, other.confidence);
+	appendColumn(keys, other.keys);
+	appendColumn(parts, other.parts);
+	appendColumn(holes, other.holes);
+	appendColumn(proportion, other.proportion);
+	appendColumn(density.total, other.density.total);
+	appendColumn(density.border, other.density.border);
+	appendColumn(density.q1, other.density.q1);
+	appendColumn(density.q2, other.density.q2);
+	appendColumn(density.q3, other.density.q3);
+	appendColumn(density.q4, other.density.q4);
+	appendColumn(density.mid1, other.density.mid1);
+	appendColumn(density.mid2, other.density.mid2);
+	if (optional & RASTER)
+		appendColumn(templates, other.templates);
+	else
+		templates.clear();
+	if (optional & ZONES)
+		appendColumn(zones, other.zones);
+	else
+		zones.clear();
+	if (optional & QUANTIZED)
+		appendColumn(quantized, other.quantized);
+	else
+		quantized.clear();
+}
+
+/**
+ * Collects the statistics for one character
+ * @param i index of the character
+ * @return symbol statistics
+ */
+Font::Symbol FeatureBatch::symbol(unsigned i) const
+{
+	Font::Symbol s;
+	s.holes = holes[i];
+	s.proportion = proportion[i];
+	s.density.total = density.total[i];
+	s.density.border = density.border[i];
+	s.density.q1 = density.q1[i];
+	s.density.q2 = density.q2[i];
+	s.density.q3 = density.q3[i];
+	s.density.q4 = density.q4[i];
+	s.density.mid1 = density.mid1[i];
+	s.density.mid2 = density.mid2[i];
+	return s;
+}
+
+/**
+ * Collects what was extracted of one character, to be cached
+ * @param i          index of the character
+ * @param character  best match for the character
+ * @param confidence confidence in the match
+ * @return what to remember of the character
+ */
+GlyphCache::Glyph FeatureBatch::glyph(unsigned i, char character,
+        double confidence) const
+{
+	GlyphCache::Glyph g;
+	g.symbol = symbol(i);
+	g.extracted = optional;
+	if (optional & RASTER)
+		g.raster = templates[i];
+	if (optional & ZONES)
+		g.zones = zones[i];
+	if (optional & QUANTIZED)
+		g.quantized = quantized[i];
+	g.character = character;
+	g.confidence = confidence;
+	return g;
+}
+
+/**
+ * Sets the statistics for one character
+ * @param i index of the character
+ * @param s symbol statistics
+ */
+void FeatureBatch::setSymbol(unsigned i, const Font::Symbol & s)
+{
+	holes[i] = s.holes;
+	proportion[i] = s.proportion;
+	density.total[i] = s.density.total;
+	density.border[i] = s.density.border;
+	density.q1[i] = s.density.q1;
+	density.q2[i] = s.density.q2;
+	density.q3[i] = s.density.q3;
+	density.q4[i] = s.density.q4;
+	density.mid1[i] = s.density.mid1;
+	density.mid2[i] = s.density.mid2;
+}
+
+} // namespace OCR
@@ -0,0 +1,197 @@
+/**
+ * @file FeatureBatch.h
+ * @date October 2026
+ * @author Omophagic Content Reader contributors
+ * @brief The interface and documentation of the FeatureBatch class.
+ * @see FeatureBatch.cpp for the implementation.
+ * @version $Id$
+ */
+/*
+ * Copyright 2026 Omophagic Content Reader contributors
+ *
+ * This file is part of Omophagic Content Reader.
+ *
+ * Omophagic Content Reader is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Omophagic Content Reader is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Omophagic Content Reader.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef OCR_FEATUREBATCH_H_
+#define OCR_FEATUREBATCH_H_
+#include <vector>
+#include "EasyBMP/EasyBMP.h"
+#include "OCR.h"
+#include "BinaryImage.h"
+#include "Font.h"
+#include "GlyphCache.h"
+#include "Template.h"
+#include "Zones.h"
+#include "QuantizedSymbol.h"
+
+namespace OCR
+{
+
+/**
+ * Statistics on many characters at once,
+ * stored as one column per statistic.
+ *
+ * The same statistics as Grapheme::Read, but all foreground pixels are
+ * counted in one pass over the image, and each statistic is then computed
+ * for every character in a single loop.
+ */
+class FeatureBatch
+{
+public:
+	/**
+	 * Information that is only extracted when asked for
+	 */
+	enum Optional
+	{
+		/// Templates of every character
+		RASTER = 1,
+		/// Densities in a grid over every character
+		ZONES = 2,
+		/// Statistics of every character as integers
+		QUANTIZED = 4
+	};
+
+	/**
+	 * Initializes an empty batch
+	 * @param optional which Optional information to extract, combined with |
+	 * @param grid     size of the grid for ZONES
+	 */
+	FeatureBatch(unsigned optional = 0, const Zones & grid = Zones(4, 4));
+
+	/**
+	 * Extracts statistics on characters in a binarized image
+	 * @param img   binarized image containing the characters
+	 * @param parts the part of the image for each character
+	 * @param cache optionally reuse statistics of characters already read
+	 */
+	void extract(const BinaryImage & img, const std::vector<Box> & parts,
+	        GlyphCache * cache = NULL);
+
+	/**
+	 * Extracts statistics on characters anywhere in a BMP image
+	 * @param img   reference to BMP
+	 * @param parts the part of the image for each character
+	 */
+	void extract(BMP & img, const std::vector<Box> & parts);
+
+	/**
+	 * Adds the characters of another batch to the end of this one.
+	 * Optional information is only kept if both batches have it.
+	 * @param other another batch
+	 */
+	void append(const FeatureBatch & other);
+
+	/**
+	 * Get the Optional information extracted
+	 * @return Optional values combined with |
+	 */
+	unsigned extracted() const
+	{
+		return optional;
+	}
+
+	/**
+	 * Get the size of the grid for ZONES
+	 * @return empty grid
+	 */
+	const Zones & zoneGrid() const
+	{
+		return grid;
+	}
+
+	/**
+	 * Get the number of characters
+	 * @return number of characters
+	 */
+	unsigned size() const
+	{
+		return holes.size();
+	}
+
+	/**
+	 * Collects the statistics for one character
+	 * @param i index of the character
+	 * @return symbol statistics
+	 */
+	Font::Symbol symbol(unsigned i) const;
+
+	/**
+	 * Collects what was extracted of one character, to be cached
+	 * @param i          index of the character
+	 * @param character  best match for the character
+	 * @param confidence confidence in the match
+	 * @return what to remember of the character
+	 */
+	GlyphCache::Glyph glyph(unsigned i, char character,
+	        double confidence) const;
+
+	/// Whether each character was found in the cache
+	std::vector<bool> cached;
+	/// Best match for each cached character
+	std::vector<char> characters;
+	/// Confidence in the match for each cached character
+	std::vector<double> confidence;
+	/// Pixels of each character, if a cache was used
+	std::vector<GlyphCache::Key> keys;
+	/// Part of the image surrounding the foreground pixels of each character
+	std::vector<Box> parts;
+	/// Number of holes
+	std::vector<unsigned short> holes;
+	/// Height / width
+	std::vector<double> proportion;
+	/// Foreground pixels / total pixels
+	struct
+	{
+		std::vector<double> total, border, q1, q2, q3, q4, mid1, mid2;
+	} density;
+	/// Shape of each character, if RASTER was asked for
+	std::vector<Template> templates;
+	/// Densities over each character, if ZONES was asked for
+	std::vector<Zones> zones;
+	/// Statistics on each character as integers, if QUANTIZED was asked for
+	std::vector<QuantizedSymbol> quantized;
+
+private:
+	/**
+	 * Sets the statistics for one character
+	 * @param i index of the character
+	 * @param s symbol statistics
+	 */
+	void setSymbol(unsigned i, const Font::Symbol & s);
+
+	/// Which Optional information to extract
+	unsigned optional;
+	/// Size of the grid for ZONES
+	Zones grid;
+
+	/// Width, height, and border length of each character, in pixels
+	std::vector<unsigned> width, height, borderLength;
+	/// Foreground pixel counts for each character, named as in density
+	struct
+	{
+		std::vector<unsigned> total, border, q1, q2, q3, q4, mid1, mid2;
+	} foreground;
+	/// Total pixel counts of the parts of each character
+	struct
+	{
+		std::vector<unsigned> q1, q2, q3, q4, mid1, mid2;
+	} area;
+};
+
+} // namespace OCR
+
+#endif /*OCR_FEATUREBATCH_H_*/
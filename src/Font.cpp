@@ -26,24 +26,421 @@
  * If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include <limits>
+#include <climits>
+#include <cmath>
+#include <algorithm>
+#include <cstring>
+#include <stdint.h>
+#include <sys/stat.h>
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#include <immintrin.h>
+/// Compiles a function for processors with AVX2, whatever the build targets
+#define OCR_AVX2 __attribute__((target("avx2")))
+#endif
 #include "Font.h"
+#include "FontRegistry.h"
+#include "GlyphCache.h"
+#include "Profile.h"
 
 namespace OCR
 {
 
+const unsigned Font::LANES;
+const unsigned Font::MATCHED;
+const double Font::WEIGHTS[Font::MATCHED] =
+{ 10000, 100, 100, 100, 200, 200, 200, 200 };
+const double Font::MIN_DEVIATION[Font::MATCHED] =
+{ 0.001, 0.02, 0.02, 0.02, 0.02, 0.02, 0.02, 0.02 };
+const unsigned Font::LEAF_SIZE;
+const unsigned Font::Candidates::MAX_MATCHES;
+
+/**
+ * The first part of a compiled font, which locates the rest.
+ * Each part is aligned to COMPILED_ALIGNMENT bytes.
+ */
+struct Font::CompiledHeader
+{
+	/// Parts of a compiled font, in file order
+	enum Part
+	{
+		COLUMNS,
+		CHARACTERS = COLUMNS + MATCHED,
+		NODES,
+		TEMPLATE_CHARACTERS,
+		TEMPLATES,
+		ZONE_CHARACTERS,
+		ZONES,
+		QUANTIZED_CHARACTERS,
+		QUANTIZED,
+		SPREAD_CHARACTERS,
+		SPREADS,
+		PARTS
+	};
+
+	/// Identifies a compiled font
+	char magic[8];
+	/// COMPILED_VERSION when written
+	uint32_t version;
+	/// COMPILED_BYTE_ORDER as written, which reads differently elsewhere
+	uint32_t byteOrder;
+	/// Sizes of the structures stored, which differ on other machines
+	uint32_t nodeSize, templateSize, zonesSize, quantizedSize, spreadSize;
+	/// Where each part begins in the file, and its number of elements
+	struct
+	{
+		uint64_t offset, count;
+	} parts[PARTS];
+};
+
+/// The magic number of a compiled font
+static const char COMPILED_MAGIC[8] =
+{ 'O', 'C', 'R', 'F', 'O', 'N', 'T', 0 };
+/// Written as a compiled font's byte order
+static const uint32_t COMPILED_BYTE_ORDER = 0x01020304;
+
 /**
- * Loads font information from a file
+ * A compiled font built into the program
+ */
+struct EmbeddedFont
+{
+	/// Font name
+	const char * name;
+	/// The font in the compiled format
+	const unsigned char * compiled;
+	/// Number of bytes in compiled
+	size_t size;
+};
+
+/**
+ * Get the fonts built into the program
+ * @return every font embedded so far
+ */
+static std::vector<EmbeddedFont> & embeddedFonts()
+{
+	// Made when first used, since fonts are embedded while starting
+	static std::vector<EmbeddedFont> fonts;
+	return fonts;
+}
+
+/**
+ * Builds a compiled font into the program, to be found by name
+ * before the font directory. Called while the program starts,
+ * by the code ocr-compile -c generates.
+ * @param name     font name
+ * @param compiled the font in the compiled format, aligned as in a file
+ * @param size     number of bytes in compiled
+ */
+void Font::embed(const char * name, const unsigned char * compiled,
+        size_t size)
+{
+	EmbeddedFont font =
+	{ name, compiled, size };
+	embeddedFonts().push_back(font);
+}
+
+/**
+ * Get the names of the fonts built into the program
+ * @return font names, in the order they were embedded
+ */
+std::vector<std::string> Font::embedded()
+{
+	const std::vector<EmbeddedFont> & builtIn = embeddedFonts();
+	std::vector<std::string> names;
+	for (unsigned i = 0; i < builtIn.size(); ++i)
+		names.push_back(builtIn[i].name);
+	return names;
+}
+
+/**
+ * Loads font information from the first directory of the search path
+ * that has it, or else a font of that name built into the program,
+ * as in Font(name, path)
+ * @param name font name
+ * @see FontRegistry::defaultPath for the search path
+ */
+Font::Font(std::string name) :
+	matcher(STATISTICS), cascadeMargin(DEFAULT_MARGIN),
+	        glyphCache(new GlyphCache)
+{
+	clearStats();
+	find(name, FontRegistry::defaultPath());
+}
+
+/**
+ * Loads font information from the first directory with either
+ * <name>.font or <name>.cfont: the compiled font if it is at least
+ * as new as the text font, otherwise the text font. Only if no
+ * directory has either is a font of that name built into the program
+ * used, so a font learned or compiled again is used at once.
  * @param name font name
+ * @param path directories to look in, in order
+ */
+Font::Font(std::string name, const std::vector<std::string> & path) :
+	matcher(STATISTICS), cascadeMargin(DEFAULT_MARGIN),
+	        glyphCache(new GlyphCache)
+{
+	clearStats();
+	find(name, path);
+}
+
+/**
+ * Reads a font in the text format from one file, without looking
+ * for a built-in or compiled font of the same name
+ * @param file file name
+ * @return the font, with no symbols if the file cannot be read
  */
-Font::Font(std::string name)
+Font Font::fromText(const std::string & file)
 {
-	name = "font/" + name + ".font";
-	std::ifstream infile(name.c_str());
+	Font font;
+	font.parse(file);
+	return font;
+}
+
+/**
+ * Initializes a font with no symbols
+ */
+Font::Font() :
+	matcher(STATISTICS), cascadeMargin(DEFAULT_MARGIN),
+	        glyphCache(new GlyphCache)
+{
+	clearStats();
+}
+
+/**
+ * Loads font information, as in Font(name, path)
+ * @param name font name
+ * @param path directories to look in, in order
+ */
+void Font::find(const std::string & name,
+        const std::vector<std::string> & path)
+{
+	for (unsigned d = 0; d < path.size(); ++d)
+	{
+		const std::string text = path[d] + "/" + name + ".font";
+		const std::string compiled = path[d] + "/" + name + ".cfont";
+		struct stat textInfo, compiledInfo;
+		const bool hasText = stat(text.c_str(), &textInfo) == 0;
+		const bool hasCompiled = stat(compiled.c_str(), &compiledInfo) == 0;
+		if (hasCompiled && (!hasText || compiledInfo.st_mtime
+		        >= textInfo.st_mtime) && load(compiled))
+			return;
+		if (hasText || hasCompiled)
+		{
+			parse(text);
+			return;
+		}
+	}
+
+	// Only without a file, a font built into the program
+	const std::vector<EmbeddedFont> & builtIn = embeddedFonts();
+	for (unsigned i = 0; i < builtIn.size(); ++i)
+		if (name == builtIn[i].name && load(reinterpret_cast<const char *> (
+		        builtIn[i].compiled), builtIn[i].size))
+			return;
+
+	// Without the font anywhere, it has no symbols
+	if (!path.empty())
+		parse(path.front() + "/" + name + ".font");
+}
+
+/**
+ * Get one of the statistics used by Symbol::match
+ * @param s     a symbol
+ * @param index which statistic, in the order match adds them
+ * @return the statistic
+ */
+static double statistic(const Font::Symbol & s, unsigned index)
+{
+	switch (index)
+	{
+	case 0:
+		return s.holes;
+	case 1:
+		return s.density.total;
+	case 2:
+		return s.proportion;
+	case 3:
+		return s.density.border;
+	case 4:
+		return s.density.q1;
+	case 5:
+		return s.density.q2;
+	case 6:
+		return s.density.q3;
+	default:
+		return s.density.q4;
+	}
+}
+
+/**
+ * Copies the characters and values of a map into arrays, in order
+ * @param[in]  values     values of each character
+ * @param[out] characters the characters
+ * @param[out] array      the value of each of the characters
+ */
+template<typename T>
+static void flatten(const std::map<char, T> & values,
+        MappedArray<char> & characters, MappedArray<T> & array)
+{
+	std::vector<char> keys;
+	std::vector<T> elements;
+	for (typename std::map<char, T>::const_iterator i = values.begin(); i
+	        != values.end(); ++i)
+	{
+		keys.push_back(i->first);
+		elements.push_back(i->second);
+	}
+	characters.assign(keys);
+	array.assign(elements);
+}
+
+/**
+ * Reads values of each statistic of a symbol in the order they are
+ * written, with holes not rounded
+ * @param[in]  ins   input stream
+ * @param[out] holes value for holes
+ * @param[out] s     values for the other statistics
+ * @return whether all were read
+ */
+static bool readStatistics(std::istream & ins, double & holes,
+        Font::Symbol & s)
+{
+	return !(ins >> holes >> s.proportion >> s.density.total
+	        >> s.density.border >> s.density.q1 >> s.density.q2
+	        >> s.density.q3 >> s.density.q4 >> s.density.mid1
+	        >> s.density.mid2).fail();
+}
+
+/**
+ * Reads a font in the text format
+ * @param file file name
+ */
+void Font::parse(const std::string & file)
+{
+	std::ifstream infile(file.c_str());
+	std::string line, tag;
 	Symbol incoming;
+	std::vector<std::pair<char, Symbol> > incomingSymbols;
+	std::map<char, Template> incomingTemplates;
+	std::map<char, Zones> incomingZones;
+	std::map<char, QuantizedSymbol> incomingQuantized;
+	std::vector<char> incomingSpreadCharacters;
+	std::vector<Spread> incomingSpreads;
+	Template shape;
+	Zones grid;
+	QuantizedSymbol rounded;
 	char character;
-	while (infile >> character >> incoming)
-		symbols[character] = incoming;
+	unsigned count;
+	while (std::getline(infile, line))
+	{
+		// Each line has a character and its statistics,
+		// optionally followed by tagged extra information
+		std::istringstream fields(line);
+		if (!(fields >> character >> incoming))
+			continue;
+		incomingSymbols.push_back(std::make_pair(character, incoming));
+		// Of several prototypes of a character, the first has the extra
+		// information, which quantized statistics never replace
+		incomingQuantized.insert(std::make_pair(character, incoming.quantize()));
+		while (fields >> tag)
+			if (tag == "t" && fields >> shape)
+				incomingTemplates[character] = shape;
+			else if (tag == "z" && fields >> grid)
+				incomingZones[character] = grid;
+			else if (tag == "q" && fields >> rounded)
+				incomingQuantized[character] = rounded;
+			else if (tag == "n" && fields >> count)
+				continue; // Only needed to learn more samples
+			else if (tag == "m" || tag == "s")
+			{
+				// Unrounded means and sums of squares, also only needed
+				// to learn more samples
+				Symbol mean;
+				double holes;
+				if (!readStatistics(fields, holes, mean))
+					break;
+			}
+			else if (tag == "v")
+			{
+				// Variances, in the order of the statistics of the line
+				Symbol variance;
+				double holes;
+				if (!readStatistics(fields, holes, variance))
+					break;
+				Spread spread;
+				for (unsigned s = 0; s < MATCHED; ++s)
+				{
+					spread.mean[s] = statistic(incoming, s);
+					spread.deviation[s] = std::sqrt(s ? statistic(variance, s)
+					        : holes);
+				}
+				incomingSpreadCharacters.push_back(character);
+				incomingSpreads.push_back(spread);
+			}
+	}
 	infile.close();
+	setSymbols(incomingSymbols);
+	flatten(incomingTemplates, templateCharacters, templates);
+	flatten(incomingZones, zoneCharacters, zones);
+	flatten(incomingQuantized, quantizedCharacters, quantized);
+	spreadCharacters.assign(incomingSpreadCharacters);
+	spreads.assign(incomingSpreads);
+}
+
+/**
+ * Initializes the object as a copy of another, with an empty cache
+ * @param other a Font object
+ */
+Font::Font(const Font & other) :
+	characters(other.characters), nodes(other.nodes),
+	        templateCharacters(other.templateCharacters),
+	        templates(other.templates), zoneCharacters(other.zoneCharacters),
+	        zones(other.zones), quantizedCharacters(other.quantizedCharacters),
+	        quantized(other.quantized),
+	        spreadCharacters(other.spreadCharacters), spreads(other.spreads),
+	        file(other.file),
+	        matcher(other.matcher), cascadeMargin(other.cascadeMargin),
+	        glyphCache(new GlyphCache)
+{
+	clearStats();
+	for (unsigned s = 0; s < MATCHED; ++s)
+		columns[s] = other.columns[s];
+}
+
+/**
+ * Copies the symbols of another object and empties the cache
+ * and statistics
+ * @param other a Font object
+ */
+Font & Font::operator =(const Font & other)
+{
+	for (unsigned s = 0; s < MATCHED; ++s)
+		columns[s] = other.columns[s];
+	characters = other.characters;
+	nodes = other.nodes;
+	templateCharacters = other.templateCharacters;
+	templates = other.templates;
+	zoneCharacters = other.zoneCharacters;
+	zones = other.zones;
+	quantizedCharacters = other.quantizedCharacters;
+	quantized = other.quantized;
+	spreadCharacters = other.spreadCharacters;
+	spreads = other.spreads;
+	file = other.file;
+	matcher = other.matcher;
+	cascadeMargin = other.cascadeMargin;
+	glyphCache->clear();
+	clearStats();
+	return *this;
+}
+
+/**
+ * Frees the cache
+ */
+Font::~Font()
+{
+	delete glyphCache;
 }
 
 /**
@@ -62,23 +459,890 @@ Font::Symbol::Symbol() :
 	density.mid2 = 0;
 }
 
+#ifdef OCR_AVX2
+/**
+ * Checks whether this processor runs the functions compiled with OCR_AVX2
+ * @return true if it has AVX2
+ */
+static bool hasAVX2()
+{
+	__builtin_cpu_init();
+	return __builtin_cpu_supports("avx2");
+}
+
+/// Whether to score symbols with the AVX2 functions below
+static const bool AVX2 = hasAVX2();
+
+/**
+ * Adds one weighted difference to the scores of several symbols,
+ * as score += fabs(statistic - value) * weight does for one
+ * @param score     scores so far
+ * @param statistic the statistic of each symbol, aligned to 32 bytes
+ * @param value     the statistic of the unknown symbol
+ * @param weight    weight of the statistic
+ * @return new scores, truncated to integers
+ */
+OCR_AVX2 static inline __m256d addScore(__m256d score,
+        const double * statistic, double value, double weight)
+{
+	const __m256d absMask = _mm256_castsi256_pd(_mm256_set1_epi64x(
+	        0x7FFFFFFFFFFFFFFFLL));
+	__m256d difference = _mm256_and_pd(_mm256_sub_pd(_mm256_load_pd(
+	        statistic), _mm256_set1_pd(value)), absMask);
+	return _mm256_round_pd(_mm256_add_pd(score, _mm256_mul_pd(difference,
+	        _mm256_set1_pd(weight))), _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC);
+}
+
+/**
+ * Finds the lowest score Symbol::match could give any symbol in a node,
+ * four statistics at a time
+ * @param low        lowest value of each statistic in the node
+ * @param high       highest value of each statistic in the node
+ * @param statistics statistics of an unknown symbol, in WEIGHTS order
+ * @param weights    Font::WEIGHTS
+ * @param count      number of statistics, a multiple of four
+ * @return lower bound on the score
+ */
+OCR_AVX2 static double boundAVX2(const double * low, const double * high,
+        const double * statistics, const double * weights, unsigned count)
+{
+	// The gaps are never negative, so rounding toward zero is the same
+	// as floor
+	__m256d lowest = _mm256_setzero_pd();
+	for (unsigned s = 0; s < count; s += 4)
+	{
+		const __m256d value = _mm256_loadu_pd(statistics + s);
+		__m256d gap = _mm256_max_pd(_mm256_max_pd(_mm256_sub_pd(
+		        _mm256_loadu_pd(low + s), value), _mm256_sub_pd(value,
+		        _mm256_loadu_pd(high + s))), _mm256_setzero_pd());
+		lowest = _mm256_add_pd(lowest, _mm256_round_pd(_mm256_mul_pd(gap,
+		        _mm256_loadu_pd(weights + s)), _MM_FROUND_TO_ZERO
+		        | _MM_FROUND_NO_EXC));
+	}
+	__m128d half = _mm_add_pd(_mm256_castpd256_pd128(lowest),
+	        _mm256_extractf128_pd(lowest, 1));
+	return _mm_cvtsd_f64(_mm_add_sd(half, _mm_unpackhi_pd(half, half)));
+}
+
+/**
+ * Compares every symbol in a leaf to an unknown symbol, four at a time,
+ * repeating each step of Symbol::match in double precision so that every
+ * score is exactly the same
+ * @param[in]     columns    statistics of every symbol in a font,
+ *                           in WEIGHTS order, each aligned to 32 bytes
+ * @param[in]     characters character of every symbol in the font
+ * @param[in]     begin      first symbol of the leaf, a multiple of four
+ * @param[in]     end        one past the last symbol of the leaf
+ * @param[in]     statistics statistics of the unknown symbol
+ * @param[in,out] candidates best matches so far
+ */
+OCR_AVX2 static void matchLeafAVX2(const MappedArray<double> * columns,
+        const MappedArray<char> & characters, unsigned begin, unsigned end,
+        const double * statistics, Font::Candidates & candidates)
+{
+	for (unsigned i = begin; i < end; i += 4)
+	{
+		__m256d score = _mm256_setzero_pd();
+		score = addScore(score, &columns[0][i], statistics[0], 10000);
+		score = addScore(score, &columns[1][i], statistics[1], 100);
+		score = addScore(score, &columns[2][i], statistics[2], 100);
+		score = addScore(score, &columns[3][i], statistics[3], 100);
+		score = addScore(score, &columns[4][i], statistics[4], 200);
+		score = addScore(score, &columns[5][i], statistics[5], 200);
+		score = addScore(score, &columns[6][i], statistics[6], 200);
+		score = addScore(score, &columns[7][i], statistics[7], 200);
+
+		double scores[4];
+		_mm256_storeu_pd(scores, score);
+		for (unsigned lane = 0; lane < 4 && i + lane < end; ++lane)
+			if (scores[lane] <= candidates.threshold())
+				candidates.offer(characters[i + lane], scores[lane]);
+	}
+}
+#endif
+
+/**
+ * Orders symbols by one statistic
+ */
+class ByStatistic
+{
+public:
+	/**
+	 * Initializes the comparison
+	 * @param index which statistic, in the order Symbol::match adds them
+	 */
+	ByStatistic(unsigned index) :
+		index(index)
+	{
+	}
+
+	/**
+	 * Compares two symbols
+	 * @param a a symbol and its character
+	 * @param b another symbol and its character
+	 * @return whether a comes first
+	 */
+	bool operator()(const std::pair<char, Font::Symbol> & a,
+	        const std::pair<char, Font::Symbol> & b) const
+	{
+		return statistic(a.second, index) < statistic(b.second, index);
+	}
+private:
+	/// Which statistic
+	unsigned index;
+};
+
+/**
+ * Stores symbols in columns, in the leaves of a k-d tree
+ * @param incoming each symbol and its character
+ */
+void Font::setSymbols(const std::vector<std::pair<char, Symbol> > & incoming)
+{
+	std::vector<std::pair<char, Symbol> > sorted(incoming);
+	Index index;
+	if (!sorted.empty())
+		build(sorted, 0, sorted.size(), index);
+	for (unsigned s = 0; s < MATCHED; ++s)
+		columns[s].assign(index.columns[s]);
+	characters.assign(index.characters);
+	nodes.assign(index.nodes);
+}
+
+/**
+ * Builds a node of the k-d tree and everything below it
+ * @param[in,out] incoming each symbol and its character; the part
+ *                         belonging to this node is reordered
+ * @param[in]     begin    first symbol of this node in incoming
+ * @param[in]     end      one past the last symbol of this node
+ * @param[in,out] index    the columns and tree built so far
+ * @return index of the node in index.nodes
+ */
+unsigned Font::build(std::vector<std::pair<char, Symbol> > & incoming,
+        unsigned begin, unsigned end, Index & index)
+{
+	// Find the box around the symbols
+	Node node;
+	for (unsigned i = begin; i < end; ++i)
+	{
+		for (unsigned s = 0; s < MATCHED; ++s)
+		{
+			double value = statistic(incoming[i].second, s);
+			if (i == begin || value < node.low[s])
+				node.low[s] = value;
+			if (i == begin || value > node.high[s])
+				node.high[s] = value;
+		}
+	}
+
+	// Split at the median of the statistic that varies the most by weight,
+	// which is the number of holes whenever that varies
+	unsigned widest = 0;
+	for (unsigned s = 1; s < MATCHED; ++s)
+		if ((node.high[s] - node.low[s]) * WEIGHTS[s] > (node.high[widest]
+		        - node.low[widest]) * WEIGHTS[widest])
+			widest = s;
+	const unsigned position = index.nodes.size();
+	if (end - begin <= LEAF_SIZE || node.high[widest] == node.low[widest])
+	{
+		// Store a leaf, padded with symbols that have infinitely many holes
+		node.begin = index.characters.size();
+		node.size = end - begin;
+		node.children[0] = node.children[1] = 0;
+		const unsigned padded = (node.size + LANES - 1) / LANES * LANES;
+		for (unsigned i = begin; i < begin + padded; ++i)
+		{
+			for (unsigned s = 0; s < MATCHED; ++s)
+				index.columns[s].push_back(i >= end ? s ? 0
+				        : std::numeric_limits<double>::infinity() : statistic(
+				        incoming[i].second, s));
+			index.characters.push_back(i < end ? incoming[i].first : '\0');
+		}
+		index.nodes.push_back(node);
+		return position;
+	}
+	node.begin = node.size = 0;
+	index.nodes.push_back(node);
+	std::stable_sort(incoming.begin() + begin, incoming.begin() + end,
+	        ByStatistic(widest));
+	// Keep the left half a whole number of LANES so that no lanes are wasted
+	const unsigned middle = begin + ((end - begin) / 2 + LANES - 1) / LANES
+	        * LANES;
+	const unsigned left = build(incoming, begin, middle, index);
+	const unsigned right = build(incoming, middle, end, index);
+	index.nodes[position].children[0] = left;
+	index.nodes[position].children[1] = right;
+	return position;
+}
+
+/**
+ * Finds the lowest score Symbol::match could give any symbol in a node
+ * @param node       a node
+ * @param statistics statistics of an unknown symbol, in WEIGHTS order
+ * @return lower bound on the score
+ */
+double Font::bound(const Node & node, const double * statistics) const
+{
+	// match truncates the score after adding each weighted difference,
+	// so it loses less than 1 for each, but never more than the fraction
+#ifdef OCR_AVX2
+	if (AVX2)
+		return boundAVX2(node.low, node.high, statistics, WEIGHTS, MATCHED);
+#endif
+	double lowest = 0;
+	for (unsigned s = 0; s < MATCHED; ++s)
+	{
+		// At most one of these is positive
+		double below = node.low[s] - statistics[s];
+		double above = statistics[s] - node.high[s];
+		double gap = std::max(std::max(below, above), 0.0);
+		lowest += floor(gap * WEIGHTS[s]);
+	}
+	return lowest;
+}
+
+/**
+ * Collects the statistics of one stored symbol, which are only those
+ * that Symbol::match compares
+ * @param i index of the symbol, less than symbolCount
+ * @return symbol statistics
+ */
+Font::Symbol Font::symbol(unsigned i) const
+{
+	Symbol s;
+	s.holes = columns[0][i];
+	s.density.total = columns[1][i];
+	s.proportion = columns[2][i];
+	s.density.border = columns[3][i];
+	s.density.q1 = columns[4][i];
+	s.density.q2 = columns[5][i];
+	s.density.q3 = columns[6][i];
+	s.density.q4 = columns[7][i];
+	return s;
+}
+
+/**
+ * Initializes an empty list
+ * @param k number of matches to keep
+ */
+Font::Candidates::Candidates(unsigned k) :
+	k(k < MAX_MATCHES ? k : MAX_MATCHES), count(0)
+{
+}
+
+/**
+ * Get how much better the best match is than the next best
+ * @return difference in score over the score of the next best,
+ *         from 0 for a tie to 1 when no other character is close
+ */
+double Font::Candidates::confidence() const
+{
+	if (!count)
+		return 0;
+	if (count == 1)
+		return 1;
+	if (!matches[1].score)
+		return 0;
+	return (matches[1].score - matches[0].score) / (double) matches[1].score;
+}
+
+/**
+ * Compares every symbol in a leaf to an unknown symbol
+ * @param[in]     leaf       symbols to compare
+ * @param[in]     u          statistics on an unknown symbol
+ * @param[in]     statistics the same, in WEIGHTS order
+ * @param[in,out] candidates best matches so far
+ */
+void Font::matchLeaf(const Node & leaf, const Symbol & u,
+        const double * statistics, Candidates & candidates) const
+{
+	const unsigned end = leaf.begin + leaf.size;
+#ifdef OCR_AVX2
+	// Symbol::match has no vector equivalent for undefined densities
+	if (AVX2 && u.density.border == u.density.border)
+	{
+		matchLeafAVX2(columns, characters, leaf.begin, end, statistics,
+		        candidates);
+		return;
+	}
+#else
+	(void) statistics;
+#endif
+	for (unsigned i = leaf.begin; i < end; ++i)
+		candidates.offer(characters[i], symbol(i).match(u));
+}
+
 /**
- * Finds the best match for a symbol
+ * Searches a node and everything below it that could hold a better match
+ * @param[in]     node       a node
+ * @param[in]     u          statistics on an unknown symbol
+ * @param[in]     statistics the same, in WEIGHTS order
+ * @param[in]     bounded    whether bound applies to the unknown symbol
+ * @param[in,out] candidates best matches so far
+ * @param[in,out] evaluated  number of symbols compared so far
+ */
+void Font::search(const Node & node, const Symbol & u,
+        const double * statistics, bool bounded, Candidates & candidates,
+        unsigned long long & evaluated) const
+{
+	if (node.size)
+	{
+		matchLeaf(node, u, statistics, candidates);
+		evaluated += node.size;
+		return;
+	}
+
+	// Search the more promising half first; a half that could only tie
+	// is still searched for an earlier character
+	const Node * first = &nodes[node.children[0]];
+	const Node * second = &nodes[node.children[1]];
+	double firstBound = bounded ? bound(*first, statistics) : 0;
+	double secondBound = bounded ? bound(*second, statistics) : 0;
+	if (secondBound < firstBound)
+	{
+		std::swap(first, second);
+		std::swap(firstBound, secondBound);
+	}
+	if (firstBound <= candidates.threshold())
+		search(*first, u, statistics, bounded, candidates, evaluated);
+	if (secondBound <= candidates.threshold())
+		search(*second, u, statistics, bounded, candidates, evaluated);
+}
+
+/**
+ * Finds the best matches for a symbol
  * @param unknownSymbol statistics on an unknown symbol
- * @return best matching symbol
+ * @param k             number of matches to find
+ * @return the k best matching symbols and their scores
  */
-char Font::bestMatch(const Symbol & unknownSymbol) const
+Font::Candidates Font::match(const Symbol & unknownSymbol, unsigned k) const
 {
-	char bestMatch;
-	unsigned bestMatchScore = -1, currentScore;
-	for (std::map<char, Symbol>::const_iterator i = symbols.begin(); i
-	        != symbols.end(); ++i)
-		if ((currentScore = i->second.match(unknownSymbol)) < bestMatchScore)
+	OCR_PROFILE_TIME(MATCH);
+	Candidates candidates(k);
+	unsigned long long evaluated = 0;
+	double statistics[MATCHED];
+	for (unsigned s = 0; s < MATCHED; ++s)
+		statistics[s] = statistic(unknownSymbol, s);
+	// Symbol::match gives no lower bound for undefined densities
+	if (!nodes.empty())
+		search(nodes[0], unknownSymbol, statistics,
+		        unknownSymbol.density.border == unknownSymbol.density.border,
+		        candidates, evaluated);
+	searches.fetch_add(1, std::memory_order_relaxed);
+	evaluations.fetch_add(evaluated, std::memory_order_relaxed);
+	return candidates;
+}
+
+/**
+ * Finds the best matches for a shape
+ * @param unknownShape template of an unknown symbol
+ * @param k            number of matches to find
+ * @return the k best matching symbols and their scores
+ */
+Font::Candidates Font::match(const Template & unknownShape, unsigned k) const
+{
+	OCR_PROFILE_TIME(MATCH);
+	Candidates candidates(k);
+	for (unsigned i = 0; i < templates.size(); ++i)
+		candidates.offer(templateCharacters[i], templates[i].distance(unknownShape));
+	searches.fetch_add(1, std::memory_order_relaxed);
+	evaluations.fetch_add(templates.size(), std::memory_order_relaxed);
+	return candidates;
+}
+
+/**
+ * Finds the best matches for a grid of densities
+ * @param unknownZones densities over an unknown symbol
+ * @param k            number of matches to find
+ * @return the k best matching symbols and their scores
+ */
+Font::Candidates Font::match(const Zones & unknownZones, unsigned k) const
+{
+	OCR_PROFILE_TIME(MATCH);
+	Candidates candidates(k);
+	for (unsigned i = 0; i < zones.size(); ++i)
+		candidates.offer(zoneCharacters[i], zones[i].distance(unknownZones));
+	searches.fetch_add(1, std::memory_order_relaxed);
+	evaluations.fetch_add(zones.size(), std::memory_order_relaxed);
+	return candidates;
+}
+
+/**
+ * Finds the best matches for quantized statistics
+ * @param unknownSymbol quantized statistics on an unknown symbol
+ * @param k             number of matches to find
+ * @return the k best matching symbols and their scores
+ */
+Font::Candidates Font::match(const QuantizedSymbol & unknownSymbol,
+        unsigned k) const
+{
+	OCR_PROFILE_TIME(MATCH);
+	Candidates candidates(k);
+	for (unsigned i = 0; i < quantized.size(); ++i)
+		candidates.offer(quantizedCharacters[i], quantized[i].distance(
+		        unknownSymbol));
+	searches.fetch_add(1, std::memory_order_relaxed);
+	evaluations.fetch_add(quantized.size(), std::memory_order_relaxed);
+	return candidates;
+}
+
+/**
+ * Finds the best matches for a symbol, scaling the difference in each
+ * statistic by the deviation of the samples each symbol was learned from
+ * @param unknownSymbol statistics on an unknown symbol
+ * @param k             number of matches to find
+ * @return the k best matching symbols and their scores
+ */
+Font::Candidates Font::matchNormalized(const Symbol & unknownSymbol,
+        unsigned k) const
+{
+	OCR_PROFILE_TIME(MATCH);
+	Candidates candidates(k);
+	double statistics[MATCHED];
+	for (unsigned s = 0; s < MATCHED; ++s)
+		statistics[s] = statistic(unknownSymbol, s);
+	for (unsigned i = 0; i < spreads.size(); ++i)
+	{
+		// 100 for each deviation a statistic is from the mean; the smallest
+		// deviation of holes keeps them weighing the most, as in Symbol::match
+		const Spread & spread = spreads[i];
+		double score = 0;
+		for (unsigned s = 0; s < MATCHED; ++s)
+			score += floor(100 * std::fabs(statistics[s]
+			        - spread.mean[s]) / std::max(spread.deviation[s],
+			        MIN_DEVIATION[s]));
+		// Undefined densities, as of a border of no pixels, match worst
+		candidates.offer(spreadCharacters[i], score == score && score
+		        < UINT_MAX ? score : UINT_MAX);
+	}
+	searches.fetch_add(1, std::memory_order_relaxed);
+	evaluations.fetch_add(spreads.size(), std::memory_order_relaxed);
+	return candidates;
+}
+
+/**
+ * Keeps the symbols whose scores are within a margin of the best
+ * @param[in]     scores    match score of each symbol
+ * @param[in,out] remaining indices of the symbols still considered
+ * @param[in]     margin    greatest difference from the best score kept
+ * @param[in]     chars     the character of each symbol
+ * @return whether more than one character remains
+ */
+static bool narrow(const std::vector<unsigned> & scores,
+        std::vector<unsigned> & remaining, unsigned margin,
+        const MappedArray<char> & chars)
+{
+	unsigned best = std::numeric_limits<unsigned>::max();
+	for (unsigned r = 0; r < remaining.size(); ++r)
+		best = std::min(best, scores[remaining[r]]);
+	unsigned kept = 0;
+	bool several = false;
+	for (unsigned r = 0; r < remaining.size(); ++r)
+		if (scores[remaining[r]] - best <= margin)
+		{
+			several |= kept && chars[remaining[r]] != chars[remaining[0]];
+			remaining[kept++] = remaining[r];
+		}
+	remaining.resize(kept);
+	return several;
+}
+
+/**
+ * Finds the best matches for a character in stages, computing
+ * each statistic only when the characters within the margin of the
+ * best so far still differ
+ * @param[in]  img      binarized image containing the character
+ * @param[in]  part     part of the image containing the character,
+ *                      pared down
+ * @param[in]  k        number of matches to find
+ * @param[out] computed optionally store the statistics computed;
+ *                      the others are 0
+ * @return the k best matching symbols and their scores in the last
+ *         stage reached
+ */
+Font::Candidates Font::match(const BinaryImage & img, const Box & part,
+        unsigned k, Symbol * computed) const
+{
+	OCR_PROFILE_TIME(MATCH);
+	// Every statistic but holes is counted from the summed-area table
+	Symbol u;
+	const unsigned width = part.width(), height = part.height();
+	unsigned borderLength;
+	const unsigned border = img.countBorder(part, borderLength);
+	const unsigned midWidth = part.low.x + ((part.high.x - part.low.x) / 2);
+	const unsigned midHeight = part.low.y + ((part.high.y - part.low.y) / 2);
+	const Box q1(midWidth, part.low.y, part.high.x, midHeight);
+	const Box q2(part.low.x, part.low.y, midWidth, midHeight);
+	const Box q3(part.low.x, midHeight, midWidth, part.high.y);
+	const Box q4(midWidth, midHeight, part.high.x, part.high.y);
+	u.proportion = height / (double) width;
+	u.density.total = img.count(part) / (double) (width * height);
+	u.density.border = border / (double) borderLength;
+	u.density.q1 = img.count(q1) / (double) q1.area();
+	u.density.q2 = img.count(q2) / (double) q2.area();
+	u.density.q3 = img.count(q3) / (double) q3.area();
+	u.density.q4 = img.count(q4) / (double) q4.area();
+
+	// Score every symbol but the padding on all but holes, which match
+	// adds as a whole number, so the stages add up to its score
+	std::vector<unsigned> scores(characters.size());
+	std::vector<unsigned> remaining;
+	for (unsigned i = 0; i < characters.size(); ++i)
+		if (columns[0][i] != std::numeric_limits<double>::infinity())
+		{
+			Symbol s = symbol(i);
+			u.holes = s.holes;
+			scores[i] = s.match(u);
+			remaining.push_back(i);
+		}
+	u.holes = 0;
+	const unsigned evaluated = remaining.size();
+	reached[DENSITY_STAGE].fetch_add(1, std::memory_order_relaxed);
+	bool undecided = narrow(scores, remaining, cascadeMargin, characters);
+
+	if (undecided)
+	{
+		reached[HOLE_STAGE].fetch_add(1, std::memory_order_relaxed);
+		u.holes = img.countHoles(part);
+		for (unsigned r = 0; r < remaining.size(); ++r)
+			scores[remaining[r]] += abs(symbol(remaining[r]).holes - u.holes)
+			        * 10000;
+		undecided = narrow(scores, remaining, cascadeMargin, characters);
+	}
+
+	Candidates candidates(k);
+	if (undecided && !templates.empty())
+	{
+		// Of the characters left, the closest shape
+		reached[TEMPLATE_STAGE].fetch_add(1, std::memory_order_relaxed);
+		const Template shape(img, part);
+		for (unsigned r = 0; r < remaining.size(); ++r)
+		{
+			const char c = characters[remaining[r]];
+			const char * t = std::lower_bound(templateCharacters.begin(),
+			        templateCharacters.begin() + templateCharacters.size(), c);
+			if (t != templateCharacters.begin() + templateCharacters.size()
+			        && *t == c)
+				candidates.offer(c, templates[t - templateCharacters.begin()]
+				        .distance(shape));
+		}
+	}
+	if (!candidates.size())
+	{
+		// Symbols left behind by an earlier stage only have part of their
+		// score, but are known to be worse than any left
+		unsigned best = std::numeric_limits<unsigned>::max();
+		for (unsigned r = 0; r < remaining.size(); ++r)
 		{
-			bestMatchScore = currentScore;
-			bestMatch = i->first;
+			candidates.offer(characters[remaining[r]], scores[remaining[r]]);
+			best = std::min(best, scores[remaining[r]]);
 		}
-	return bestMatch;
+		for (unsigned i = 0; i < characters.size(); ++i)
+			if (columns[0][i] != std::numeric_limits<double>::infinity())
+				candidates.offer(characters[i], std::max(scores[i], best + 1));
+	}
+
+	searches.fetch_add(1, std::memory_order_relaxed);
+	evaluations.fetch_add(evaluated, std::memory_order_relaxed);
+	if (computed)
+		*computed = u;
+	return candidates;
+}
+
+/**
+ * Finds one part of a compiled font, if it lies within the font
+ * @param[in]  data   the compiled font
+ * @param[in]  size   number of bytes in data
+ * @param[in]  offset where the part begins
+ * @param[in]  count  number of elements in the part
+ * @param[in]  align  alignment every part must have
+ * @param[out] array  the elements of the part
+ * @return whether the part lies within the font
+ */
+template<typename T>
+static bool mapPart(const char * data, size_t size, uint64_t offset,
+        uint64_t count, unsigned align, MappedArray<T> & array)
+{
+	if (offset % align || offset > size || count > (size - offset)
+	        / sizeof(T))
+		return false;
+	array.map(reinterpret_cast<const T *> (data + offset), count);
+	return true;
+}
+
+/**
+ * Maps a font in the compiled format into memory
+ * @param file file name
+ * @return whether the file was a valid compiled font of this version
+ */
+bool Font::load(const std::string & file)
+{
+	std::shared_ptr<MappedFile> mapped(new MappedFile(file));
+	if (!load(mapped->data(), mapped->size()))
+		return false;
+	this->file = mapped;
+	return true;
+}
+
+/**
+ * Uses a font in the compiled format that is already in memory
+ * @param data first byte, aligned to COMPILED_ALIGNMENT
+ * @param size number of bytes
+ * @return whether the data was a valid compiled font of this version
+ */
+bool Font::load(const char * data, size_t size)
+{
+	if (size < sizeof(CompiledHeader) || reinterpret_cast<uintptr_t> (data)
+	        % COMPILED_ALIGNMENT)
+		return false;
+	const CompiledHeader & header =
+	        *reinterpret_cast<const CompiledHeader *> (data);
+	if (!std::equal(COMPILED_MAGIC, COMPILED_MAGIC + sizeof(COMPILED_MAGIC),
+	        header.magic) || header.version != COMPILED_VERSION
+	        || header.byteOrder != COMPILED_BYTE_ORDER || header.nodeSize
+	        != sizeof(Node) || header.templateSize != sizeof(Template)
+	        || header.zonesSize != sizeof(Zones) || header.quantizedSize
+	        != sizeof(QuantizedSymbol) || header.spreadSize != sizeof(Spread))
+		return false;
+
+	// Every column has the same length as the characters
+	const uint64_t symbols = header.parts[CompiledHeader::CHARACTERS].count;
+	bool valid = true;
+	for (unsigned s = 0; s < MATCHED; ++s)
+		valid = valid && header.parts[CompiledHeader::COLUMNS + s].count
+		        == symbols;
+	if (!valid)
+		return false;
+
+	// Map into temporaries, so that nothing changes unless all is valid
+	MappedArray<double> newColumns[MATCHED];
+	MappedArray<char> newCharacters, newTemplateCharacters,
+	        newZoneCharacters, newQuantizedCharacters, newSpreadCharacters;
+	MappedArray<Node> newNodes;
+	MappedArray<Template> newTemplates;
+	MappedArray<Zones> newZones;
+	MappedArray<QuantizedSymbol> newQuantized;
+	MappedArray<Spread> newSpreads;
+#define OCR_MAP_PART(part, array) (mapPart(data, size, \
+        header.parts[CompiledHeader::part].offset, \
+        header.parts[CompiledHeader::part].count, COMPILED_ALIGNMENT, array))
+	for (unsigned s = 0; s < MATCHED; ++s)
+		valid = valid && OCR_MAP_PART(COLUMNS + s, newColumns[s]);
+	valid = valid && OCR_MAP_PART(CHARACTERS, newCharacters)
+	        && OCR_MAP_PART(NODES, newNodes)
+	        && OCR_MAP_PART(TEMPLATE_CHARACTERS, newTemplateCharacters)
+	        && OCR_MAP_PART(TEMPLATES, newTemplates)
+	        && OCR_MAP_PART(ZONE_CHARACTERS, newZoneCharacters)
+	        && OCR_MAP_PART(ZONES, newZones)
+	        && OCR_MAP_PART(QUANTIZED_CHARACTERS, newQuantizedCharacters)
+	        && OCR_MAP_PART(QUANTIZED, newQuantized)
+	        && OCR_MAP_PART(SPREAD_CHARACTERS, newSpreadCharacters)
+	        && OCR_MAP_PART(SPREADS, newSpreads);
+#undef OCR_MAP_PART
+	if (!valid || newTemplates.size() != newTemplateCharacters.size()
+	        || newZones.size() != newZoneCharacters.size()
+	        || newQuantized.size() != newQuantizedCharacters.size()
+	        || newSpreads.size() != newSpreadCharacters.size())
+		return false;
+
+	// Children must be other nodes, and leaves must be within the columns
+	for (unsigned i = 0; i < newNodes.size(); ++i)
+	{
+		const Node & node = newNodes[i];
+		if (node.size ? node.begin > symbols || node.size > symbols
+		        - node.begin : node.children[0] >= newNodes.size()
+		        || node.children[1] >= newNodes.size() || node.children[0]
+		        <= i || node.children[1] <= i)
+			return false;
+	}
+
+	for (unsigned s = 0; s < MATCHED; ++s)
+		columns[s] = newColumns[s];
+	characters = newCharacters;
+	nodes = newNodes;
+	templateCharacters = newTemplateCharacters;
+	templates = newTemplates;
+	zoneCharacters = newZoneCharacters;
+	zones = newZones;
+	quantizedCharacters = newQuantizedCharacters;
+	quantized = newQuantized;
+	spreadCharacters = newSpreadCharacters;
+	spreads = newSpreads;
+	this->file.reset();
+	return true;
+}
+
+/**
+ * Writes one part of a compiled font, after padding to its offset
+ * @param outs   output stream, at or before the offset
+ * @param offset where the part begins
+ * @param array  the elements of the part
+ */
+template<typename T>
+static void writePart(std::ostream & outs, uint64_t offset,
+        const MappedArray<T> & array)
+{
+	while ((uint64_t) outs.tellp() < offset)
+		outs.put('\0');
+	if (!array.empty())
+		outs.write(reinterpret_cast<const char *> (array.begin()),
+		        array.size() * sizeof(T));
+}
+
+/**
+ * Writes the font, including its index, in the compiled format,
+ * which is loaded by mapping it into memory without parsing
+ * @param file file name
+ * @return whether the file was written
+ */
+bool Font::compile(const std::string & file) const
+{
+	std::ofstream outfile(file.c_str(), std::ios::binary | std::ios::trunc);
+	if (!compile(outfile))
+		return false;
+	outfile.close();
+	return !outfile.fail();
+}
+
+/**
+ * Writes the font, including its index, in the compiled format
+ * @param outs output stream, positioned at its start
+ * @return whether the font was written
+ */
+bool Font::compile(std::ostream & outs) const
+{
+	CompiledHeader header;
+	std::memset(&header, 0, sizeof(header));
+	std::copy(COMPILED_MAGIC, COMPILED_MAGIC + sizeof(COMPILED_MAGIC),
+	        header.magic);
+	header.version = COMPILED_VERSION;
+	header.byteOrder = COMPILED_BYTE_ORDER;
+	header.nodeSize = sizeof(Node);
+	header.templateSize = sizeof(Template);
+	header.zonesSize = sizeof(Zones);
+	header.quantizedSize = sizeof(QuantizedSymbol);
+	header.spreadSize = sizeof(Spread);
+
+	// Lay out the parts in order, each aligned
+	uint64_t bytes[CompiledHeader::PARTS];
+	for (unsigned s = 0; s < MATCHED; ++s)
+	{
+		header.parts[CompiledHeader::COLUMNS + s].count = columns[s].size();
+		bytes[CompiledHeader::COLUMNS + s] = columns[s].size()
+		        * sizeof(double);
+	}
+#define OCR_PART_SIZE(part, array) \
+	header.parts[CompiledHeader::part].count = array.size(); \
+	bytes[CompiledHeader::part] = array.size() * sizeof(array[0])
+	OCR_PART_SIZE(CHARACTERS, characters);
+	OCR_PART_SIZE(NODES, nodes);
+	OCR_PART_SIZE(TEMPLATE_CHARACTERS, templateCharacters);
+	OCR_PART_SIZE(TEMPLATES, templates);
+	OCR_PART_SIZE(ZONE_CHARACTERS, zoneCharacters);
+	OCR_PART_SIZE(ZONES, zones);
+	OCR_PART_SIZE(QUANTIZED_CHARACTERS, quantizedCharacters);
+	OCR_PART_SIZE(QUANTIZED, quantized);
+	OCR_PART_SIZE(SPREAD_CHARACTERS, spreadCharacters);
+	OCR_PART_SIZE(SPREADS, spreads);
+#undef OCR_PART_SIZE
+	uint64_t offset = sizeof(header);
+	for (unsigned p = 0; p < CompiledHeader::PARTS; ++p)
+	{
+		offset = (offset + COMPILED_ALIGNMENT - 1) / COMPILED_ALIGNMENT
+		        * COMPILED_ALIGNMENT;
+		header.parts[p].offset = offset;
+		offset += bytes[p];
+	}
+
+	outs.write(reinterpret_cast<const char *> (&header), sizeof(header));
+	for (unsigned s = 0; s < MATCHED; ++s)
+		writePart(outs, header.parts[CompiledHeader::COLUMNS + s].offset,
+		        columns[s]);
+	writePart(outs, header.parts[CompiledHeader::CHARACTERS].offset,
+	        characters);
+	writePart(outs, header.parts[CompiledHeader::NODES].offset, nodes);
+	writePart(outs,
+	        header.parts[CompiledHeader::TEMPLATE_CHARACTERS].offset,
+	        templateCharacters);
+	writePart(outs, header.parts[CompiledHeader::TEMPLATES].offset,
+	        templates);
+	writePart(outs, header.parts[CompiledHeader::ZONE_CHARACTERS].offset,
+	        zoneCharacters);
+	writePart(outs, header.parts[CompiledHeader::ZONES].offset, zones);
+	writePart(outs,
+	        header.parts[CompiledHeader::QUANTIZED_CHARACTERS].offset,
+	        quantizedCharacters);
+	writePart(outs, header.parts[CompiledHeader::QUANTIZED].offset,
+	        quantized);
+	writePart(outs, header.parts[CompiledHeader::SPREAD_CHARACTERS].offset,
+	        spreadCharacters);
+	writePart(outs, header.parts[CompiledHeader::SPREADS].offset, spreads);
+	return !outs.fail();
+}
+
+/**
+ * Determines whether this font has the information an engine needs
+ * @param e matching engine
+ * @return whether the engine can be used
+ */
+bool Font::supports(Engine e) const
+{
+	switch (e)
+	{
+	case TEMPLATE:
+		return !templates.empty();
+	case ZONING:
+		return !zones.empty();
+	case NORMALIZED:
+		return !spreads.empty();
+	default:
+		return true;
+	}
+}
+
+/**
+ * Sets the way characters are matched, and empties the cache
+ * @param e matching engine
+ */
+void Font::setEngine(Engine e)
+{
+	matcher = e;
+	glyphCache->clear();
+}
+
+/**
+ * Sets how far apart the best scores of a stage of the CASCADE engine
+ * may be for the next stage to be reached, and empties the cache
+ * @param m margin, in match score
+ */
+void Font::setMargin(unsigned m)
+{
+	cascadeMargin = m;
+	glyphCache->clear();
+}
+
+/**
+ * Get statistics on matching effort
+ * @return searches and evaluations since loading or clearStats
+ */
+Font::Stats Font::stats() const
+{
+	Stats result;
+	result.searches = searches;
+	result.evaluations = evaluations;
+	for (unsigned s = 0; s < STAGES; ++s)
+		result.reached[s] = reached[s];
+	return result;
+}
+
+/**
+ * Resets the statistics on matching effort
+ */
+void Font::clearStats()
+{
+	searches = 0;
+	evaluations = 0;
+	for (unsigned s = 0; s < STAGES; ++s)
+		reached[s] = 0;
 }
 
 /**
@@ -102,6 +1366,27 @@ unsigned Font::Symbol::match(const Font::Symbol & other) const
 	return score;
 }
 
+/**
+ * Rounds the statistics used by match to integers
+ * @return quantized statistics
+ */
+QuantizedSymbol Font::Symbol::quantize() const
+{
+	const double scale = QuantizedSymbol::SCALE;
+	QuantizedSymbol q;
+	q.holes = holes;
+	q.proportion = proportion * scale < 65535 ? proportion * scale + 0.5 : 65535;
+	q.set(QuantizedSymbol::TOTAL, density.total * scale + 0.5);
+	// A border of no pixels has no density
+	q.set(QuantizedSymbol::BORDER, density.border == density.border
+	        ? density.border * scale + 0.5 : 0);
+	q.set(QuantizedSymbol::Q1, density.q1 * scale + 0.5);
+	q.set(QuantizedSymbol::Q2, density.q2 * scale + 0.5);
+	q.set(QuantizedSymbol::Q3, density.q3 * scale + 0.5);
+	q.set(QuantizedSymbol::Q4, density.q4 * scale + 0.5);
+	return q;
+}
+
 /**
  * Adds another symbol's statistics
  * @param other other symbol
@@ -123,13 +1408,13 @@ Font::Symbol Font::Symbol::operator+=(const Symbol & other)
 }
 
 /**
- * Divides all statistics by an integer
+ * Divides all statistics by an integer, rounding the number of holes
  * @param divisor number to divide by
  * @return this
  */
 Font::Symbol Font::Symbol::operator/=(int divisor)
 {
-	holes /= divisor;
+	holes = (holes + divisor / 2) / divisor;
 	proportion /= divisor;
 	density.total /= divisor;
 	density.border /= divisor;
@@ -142,6 +1427,117 @@ Font::Symbol Font::Symbol::operator/=(int divisor)
 	return *this;
 }
 
+/**
+ * Finds the closest of several symbols
+ * @param[in]  centers  symbols to choose from, not empty
+ * @param[in]  s        a symbol
+ * @param[out] distance match score of the closest, if not NULL
+ * @return index of the closest; of equally close, the first
+ */
+static unsigned closest(const std::vector<Font::Symbol> & centers,
+        const Font::Symbol & s, unsigned * distance = NULL)
+{
+	unsigned best = 0, bestScore = centers[0].match(s);
+	for (unsigned c = 1; c < centers.size(); ++c)
+	{
+		const unsigned score = centers[c].match(s);
+		if (score < bestScore)
+		{
+			best = c;
+			bestScore = score;
+		}
+	}
+	if (distance)
+		*distance = bestScore;
+	return best;
+}
+
+/**
+ * Groups samples of a character into similar prototypes, by k-means
+ * on the statistics, with distances measured by match. Starting from
+ * the first sample, each next starting prototype is the sample
+ * farthest from the ones chosen, so the result is the same every time.
+ * @param[in]  samples symbols of one character
+ * @param[in]  k       most prototypes to make
+ * @param[out] group   optionally store the index of the prototype
+ *                     each sample belongs to
+ * @return the mean of each group of samples, fewer than k if there
+ *         are not k different samples
+ */
+std::vector<Font::Symbol> Font::Symbol::cluster(
+        const std::vector<Symbol> & samples, unsigned k,
+        std::vector<unsigned> * group)
+{
+	// Most rounds of assigning samples and moving prototypes
+	const unsigned MAX_ROUNDS = 100;
+	std::vector<Symbol> centers;
+	if (samples.empty() || !k)
+		return centers;
+
+	// Spread the starting prototypes out
+	centers.push_back(samples[0]);
+	while (centers.size() < k)
+	{
+		unsigned farthest = 0, farthestDistance = 0, distance;
+		for (unsigned i = 0; i < samples.size(); ++i)
+		{
+			closest(centers, samples[i], &distance);
+			if (distance > farthestDistance)
+			{
+				farthest = i;
+				farthestDistance = distance;
+			}
+		}
+		if (!farthestDistance)
+			break;
+		centers.push_back(samples[farthest]);
+	}
+
+	// Move each prototype to the mean of its samples until none move
+	std::vector<unsigned> nearest(samples.size(), centers.size());
+	for (unsigned round = 0; round < MAX_ROUNDS; ++round)
+	{
+		bool moved = false;
+		for (unsigned i = 0; i < samples.size(); ++i)
+		{
+			const unsigned c = closest(centers, samples[i]);
+			moved |= c != nearest[i];
+			nearest[i] = c;
+		}
+		if (!moved)
+			break;
+
+		std::vector<Symbol> sums(centers.size());
+		std::vector<int> counts(centers.size(), 0);
+		for (unsigned i = 0; i < samples.size(); ++i)
+		{
+			sums[nearest[i]] += samples[i];
+			++counts[nearest[i]];
+		}
+		// A prototype left without samples stays where it is
+		for (unsigned c = 0; c < centers.size(); ++c)
+			if (counts[c])
+				centers[c] = sums[c] /= counts[c];
+	}
+
+	// Drop prototypes that no sample is closest to
+	std::vector<Symbol> used;
+	std::vector<unsigned> renumbered(centers.size());
+	for (unsigned c = 0; c < centers.size(); ++c)
+		if (std::find(nearest.begin(), nearest.end(), c) != nearest.end())
+		{
+			renumbered[c] = used.size();
+			used.push_back(centers[c]);
+		}
+	if (group)
+	{
+		group->resize(samples.size());
+		for (unsigned i = 0; i < samples.size(); ++i)
+			(*group)[i] = renumbered[nearest[i]];
+	}
+	return used;
+}
+
 /**
  * Reads symbol information from an input stream
  * @param ins input stream
@@ -30,13 +30,24 @@
 #define OCR_FONT_H_
 #include <string>
 #include <map>
+#include <vector>
+#include <atomic>
+#include <memory>
 #include <fstream>
+#include <sstream>
 #include <iostream>
 #include <cmath>
 #include <cstdlib>
+#include "BinaryImage.h"
+#include "Template.h"
+#include "Zones.h"
+#include "QuantizedSymbol.h"
+#include "MappedArray.h"
+#include "MappedFile.h"
 
 namespace OCR
 {
+class GlyphCache;
 
 /**
  * Represents a font
@@ -44,6 +55,45 @@ namespace OCR
 class Font
 {
 public:
+	/**
+	 * Ways of finding the best match for a character
+	 */
+	enum Engine
+	{
+		/// Compare statistics on holes and densities
+		STATISTICS,
+		/// Compare shapes scaled to a fixed size
+		TEMPLATE,
+		/// Compare densities in a grid of any size
+		ZONING,
+		/// Compare the same statistics as STATISTICS, stored as integers
+		QUANTIZED,
+		/// Compare the same statistics as STATISTICS in stages, cheapest
+		/// first, computing the rest only while no character is clearly best
+		CASCADE,
+		/// Compare the same statistics as STATISTICS, each difference
+		/// scaled by how much the character's samples varied in it
+		NORMALIZED
+	};
+
+	/**
+	 * The stages of the CASCADE engine, in the order they are reached
+	 */
+	enum Stage
+	{
+		/// Proportion and densities, counted in constant time
+		DENSITY_STAGE,
+		/// Number of holes, found by flood fill
+		HOLE_STAGE,
+		/// Shape scaled to a template, if the font has templates
+		TEMPLATE_STAGE,
+		/// Number of stages
+		STAGES
+	};
+
+	/// How far the best characters' scores may be apart, by default,
+	/// and still be told apart by a later stage of the CASCADE engine
+	static const unsigned DEFAULT_MARGIN = 20;
 
 	/**
 	 * Information about a symbol
@@ -73,6 +123,12 @@ public:
 		 */
 		unsigned match(const Symbol & other) const;
 
+		/**
+		 * Rounds the statistics used by match to integers
+		 * @return quantized statistics
+		 */
+		QuantizedSymbol quantize() const;
+
 		/**
 		 * Adds another symbol's statistics
 		 * @param other other symbol
@@ -81,12 +137,27 @@ public:
 		Symbol operator+=(const Symbol & other);
 
 		/**
-		 * Divides all statistics by an integer
+		 * Divides all statistics by an integer, rounding the number of holes
 		 * @param divisor number to divide by
 		 * @return this
 		 */
 		Symbol operator/=(int divisor);
 
+		/**
+		 * Groups samples of a character into similar prototypes, by k-means
+		 * on the statistics, with distances measured by match. Starting from
+		 * the first sample, each next starting prototype is the sample
+		 * farthest from the ones chosen, so the result is the same every time.
+		 * @param[in]  samples symbols of one character
+		 * @param[in]  k       most prototypes to make
+		 * @param[out] group   optionally store the index of the prototype
+		 *                     each sample belongs to
+		 * @return the mean of each group of samples, fewer than k if there
+		 *         are not k different samples
+		 */
+		static std::vector<Symbol> cluster(const std::vector<Symbol> & samples,
+		        unsigned k, std::vector<unsigned> * group = NULL);
+
 		/**
 		 * Reads symbol information from an input stream
 		 * @param ins input stream
@@ -106,21 +177,608 @@ public:
 	};
 
 	/**
-	 * Loads font information from a file
-	 * @param name
-	 * @return
+	 * The best matches for an unknown symbol, best first
+	 */
+	class Candidates
+	{
+	public:
+		/// Most matches that can be kept
+		static const unsigned MAX_MATCHES = 8;
+
+		/**
+		 * A possible match
+		 */
+		struct Candidate
+		{
+			/// The matching character
+			char character;
+			/// Its match score, lower is better
+			unsigned score;
+		};
+
+		/**
+		 * Initializes an empty list
+		 * @param k number of matches to keep, at most MAX_MATCHES
+		 */
+		Candidates(unsigned k = 1);
+
+		/**
+		 * Considers a possible match, keeping only the k best characters.
+		 * Of equal scores, the earlier character is better.
+		 * @param character the matching character
+		 * @param score     its match score
+		 */
+		void offer(char character, unsigned score)
+		{
+			if (!k || (count == k && !better(score, character, k - 1)))
+				return;
+			// Keep only the best score of each character
+			unsigned i = 0;
+			while (i < count && matches[i].character != character)
+				++i;
+			if (i < count)
+			{
+				if (!better(score, character, i))
+					return;
+			}
+			else if (count < k)
+				i = count++;
+			else
+				i = count - 1;
+			// Move worse matches down to make room
+			for (; i > 0 && better(score, character, i - 1); --i)
+				matches[i] = matches[i - 1];
+			matches[i].character = character;
+			matches[i].score = score;
+		}
+
+		/**
+		 * Get the highest score a match can have and still be kept
+		 * @return score of the k-th best match, or the largest score
+		 *         if there are fewer
+		 */
+		unsigned threshold() const
+		{
+			return count < k ? -1 : matches[count - 1].score;
+		}
+
+		/**
+		 * Get the best match
+		 * @return best matching character, or '\0' if there is none
+		 */
+		char best() const
+		{
+			return count ? matches[0].character : '\0';
+		}
+
+		/**
+		 * Get how much better the best match is than the next best
+		 * @return difference in score over the score of the next best,
+		 *         from 0 for a tie to 1 when no other character is close
+		 */
+		double confidence() const;
+
+		/**
+		 * Get the number of matches kept
+		 * @return up to k
+		 */
+		unsigned size() const
+		{
+			return count;
+		}
+
+		/**
+		 * Get a match
+		 * @param i rank of the match, from 0 for the best
+		 * @return the match
+		 */
+		const Candidate & operator[](unsigned i) const
+		{
+			return matches[i];
+		}
+	private:
+		/**
+		 * Compares a possible match to one already kept
+		 * @param score     match score
+		 * @param character the matching character
+		 * @param i         rank of the match kept
+		 * @return whether the possible match is better
+		 */
+		bool better(unsigned score, char character, unsigned i) const
+		{
+			return score < matches[i].score || (score == matches[i].score
+			        && character < matches[i].character);
+		}
+
+		/// Number of matches to keep, and number kept so far
+		unsigned k, count;
+		/// The best matches so far, best first
+		Candidate matches[MAX_MATCHES];
+	};
+
+	/**
+	 * Matching effort
+	 */
+	struct Stats
+	{
+		/// Number of unknown symbols matched
+		unsigned long long searches;
+		/// Number of symbols of the font compared to them in full
+		unsigned long long evaluations;
+		/// Number of characters the CASCADE engine reached each Stage for
+		unsigned long long reached[STAGES];
+
+		/**
+		 * Get the average number of symbols compared per search
+		 * @return evaluations / searches, or 0 if there were none
+		 */
+		double evaluationsPerSearch() const
+		{
+			return searches ? evaluations / (double) searches : 0;
+		}
+	};
+
+	/**
+	 * Loads font information from the first directory of the search path
+	 * that has it, or else a font of that name built into the program,
+	 * as in Font(name, path)
+	 * @param name font name
+	 * @see FontRegistry::defaultPath for the search path
 	 */
 	Font(std::string name);
 
+	/**
+	 * Loads font information from the first directory with either
+	 * <name>.font or <name>.cfont: the compiled font if it is at least
+	 * as new as the text font, otherwise the text font. Only if no
+	 * directory has either is a font of that name built into the program
+	 * used, so a font learned or compiled again is used at once.
+	 * @param name font name
+	 * @param path directories to look in, in order
+	 */
+	Font(std::string name, const std::vector<std::string> & path);
+
+	/**
+	 * Reads a font in the text format from one file, without looking
+	 * for a built-in or compiled font of the same name
+	 * @param file file name
+	 * @return the font, with no symbols if the file cannot be read
+	 */
+	static Font fromText(const std::string & file);
+
+	/**
+	 * Initializes the object as a copy of another, with an empty cache
+	 * @param other a Font object
+	 */
+	Font(const Font & other);
+
+	/**
+	 * Copies the symbols of another object and empties the cache
+	 * and statistics
+	 * @param other a Font object
+	 */
+	Font & operator =(const Font & other);
+
+	/**
+	 * Frees the cache
+	 */
+	~Font();
+
 	/**
 	 * Finds the best match for a symbol
 	 * @param unknownSymbol statistics on an unknown symbol
 	 * @return best matching symbol
 	 */
-	char bestMatch(const Symbol & unknownSymbol) const;
+	char bestMatch(const Symbol & unknownSymbol) const
+	{
+		return match(unknownSymbol, 1).best();
+	}
+
+	/**
+	 * Finds the best match for a shape
+	 * @param unknownShape template of an unknown symbol
+	 * @return best matching symbol
+	 */
+	char bestMatch(const Template & unknownShape) const
+	{
+		return match(unknownShape, 1).best();
+	}
+
+	/**
+	 * Finds the best match for a grid of densities
+	 * @param unknownZones densities over an unknown symbol
+	 * @return best matching symbol
+	 */
+	char bestMatch(const Zones & unknownZones) const
+	{
+		return match(unknownZones, 1).best();
+	}
+
+	/**
+	 * Finds the best match for quantized statistics
+	 * @param unknownSymbol quantized statistics on an unknown symbol
+	 * @return best matching symbol
+	 */
+	char bestMatch(const QuantizedSymbol & unknownSymbol) const
+	{
+		return match(unknownSymbol, 1).best();
+	}
+
+	/**
+	 * Finds the best matches for a symbol
+	 * @param unknownSymbol statistics on an unknown symbol
+	 * @param k             number of matches to find
+	 * @return the k best matching symbols and their scores
+	 */
+	Candidates match(const Symbol & unknownSymbol, unsigned k) const;
+
+	/**
+	 * Finds the best matches for a shape
+	 * @param unknownShape template of an unknown symbol
+	 * @param k            number of matches to find
+	 * @return the k best matching symbols and their scores
+	 */
+	Candidates match(const Template & unknownShape, unsigned k) const;
+
+	/**
+	 * Finds the best matches for a grid of densities
+	 * @param unknownZones densities over an unknown symbol
+	 * @param k            number of matches to find
+	 * @return the k best matching symbols and their scores
+	 */
+	Candidates match(const Zones & unknownZones, unsigned k) const;
+
+	/**
+	 * Finds the best matches for quantized statistics
+	 * @param unknownSymbol quantized statistics on an unknown symbol
+	 * @param k             number of matches to find
+	 * @return the k best matching symbols and their scores
+	 */
+	Candidates match(const QuantizedSymbol & unknownSymbol, unsigned k) const;
+
+	/**
+	 * Finds the best matches for a symbol, scaling the difference in each
+	 * statistic by the deviation of the samples each symbol was learned from
+	 * @param unknownSymbol statistics on an unknown symbol
+	 * @param k             number of matches to find
+	 * @return the k best matching symbols and their scores
+	 */
+	Candidates matchNormalized(const Symbol & unknownSymbol, unsigned k) const;
+
+	/**
+	 * Finds the best matches for a character in stages, computing
+	 * each statistic only when the characters within the margin of the
+	 * best so far still differ
+	 * @param[in]  img      binarized image containing the character
+	 * @param[in]  part     part of the image containing the character,
+	 *                      pared down
+	 * @param[in]  k        number of matches to find
+	 * @param[out] computed optionally store the statistics computed;
+	 *                      the others are 0
+	 * @return the k best matching symbols and their scores in the last
+	 *         stage reached
+	 */
+	Candidates match(const BinaryImage & img, const Box & part, unsigned k,
+	        Symbol * computed = NULL) const;
+
+	/**
+	 * Get the way characters are matched
+	 * @return matching engine
+	 */
+	Engine engine() const
+	{
+		return matcher;
+	}
+
+	/**
+	 * Sets the way characters are matched, and empties the cache
+	 * @param e matching engine
+	 */
+	void setEngine(Engine e);
+
+	/**
+	 * Get how far apart the best scores of a stage of the CASCADE engine
+	 * may be for the next stage to be reached
+	 * @return margin, in match score
+	 */
+	unsigned margin() const
+	{
+		return cascadeMargin;
+	}
+
+	/**
+	 * Sets how far apart the best scores of a stage of the CASCADE engine
+	 * may be for the next stage to be reached, and empties the cache
+	 * @param m margin, in match score
+	 */
+	void setMargin(unsigned m);
+
+	/**
+	 * Determines whether any symbols were loaded, which they are not
+	 * when no font of that name was found
+	 * @return whether the font has no symbols
+	 */
+	bool empty() const
+	{
+		return characters.empty();
+	}
+
+	/**
+	 * Get the number of symbols stored, including those that only pad
+	 * the leaves of the index
+	 * @return number of symbols
+	 */
+	unsigned symbolCount() const
+	{
+		return characters.size();
+	}
+
+	/**
+	 * Get the character of a stored symbol
+	 * @param i index of the symbol, less than symbolCount
+	 * @return the character, or '\0' for a symbol that only pads a leaf
+	 */
+	char character(unsigned i) const
+	{
+		return characters[i];
+	}
+
+	/**
+	 * Collects the statistics of one stored symbol, which are only those
+	 * that Symbol::match compares
+	 * @param i index of the symbol, less than symbolCount
+	 * @return symbol statistics
+	 */
+	Symbol symbol(unsigned i) const;
+
+	/**
+	 * Determines whether this font has the information an engine needs
+	 * @param e matching engine
+	 * @return whether the engine can be used
+	 */
+	bool supports(Engine e) const;
+
+	/**
+	 * Get the size of the grid used by the ZONING engine
+	 * @return empty grid of the size stored in the font
+	 */
+	Zones zoneGrid() const
+	{
+		return zones.empty() ? Zones() : Zones(zones[0].rows, zones[0].cols);
+	}
+
+	/**
+	 * Get statistics on matching effort
+	 * @return searches and evaluations since loading or clearStats
+	 */
+	Stats stats() const;
+
+	/**
+	 * Resets the statistics on matching effort
+	 */
+	void clearStats();
+
+	/**
+	 * Writes the font, including its index, in the compiled format,
+	 * which is loaded by mapping it into memory without parsing
+	 * @param file file name
+	 * @return whether the file was written
+	 */
+	bool compile(const std::string & file) const;
+
+	/**
+	 * Writes the font, including its index, in the compiled format
+	 * @param outs output stream, positioned at its start
+	 * @return whether the font was written
+	 */
+	bool compile(std::ostream & outs) const;
+
+	/**
+	 * Builds a compiled font into the program, to be found by name
+	 * before the font directory. Called while the program starts,
+	 * by the code ocr-compile -c generates.
+	 * @param name     font name
+	 * @param compiled the font in the compiled format, aligned as in a file
+	 * @param size     number of bytes in compiled
+	 */
+	static void embed(const char * name, const unsigned char * compiled,
+	        size_t size);
+
+	/**
+	 * Get the names of the fonts built into the program
+	 * @return font names, in the order they were embedded
+	 */
+	static std::vector<std::string> embedded();
+
+	/**
+	 * Get the characters already read with this font
+	 * @return cache of characters and their best matches
+	 */
+	GlyphCache & cache() const
+	{
+		return *glyphCache;
+	}
 private:
-	/// The symbols of this font
-	std::map<char, Symbol> symbols;
+	/// Version of the compiled format, changed whenever its layout changes
+	static const unsigned COMPILED_VERSION = 2;
+	/// Alignment of each part of a compiled font, in bytes
+	static const unsigned COMPILED_ALIGNMENT = 64;
+	/// Number of statistics used by Symbol::match
+	static const unsigned MATCHED = 8;
+	/// Weight of each statistic in Symbol::match, in the order it adds them:
+	/// holes, total, proportion, border, q1, q2, q3, q4
+	static const double WEIGHTS[MATCHED];
+	/// Smallest deviation the NORMALIZED engine divides by, so that
+	/// statistics that never varied in the samples still count
+	static const double MIN_DEVIATION[MATCHED];
+
+	/**
+	 * How the samples a symbol was learned from were spread out
+	 */
+	struct Spread
+	{
+		/// Mean of each statistic, in WEIGHTS order
+		double mean[MATCHED];
+		/// Standard deviation of each statistic, in WEIGHTS order
+		double deviation[MATCHED];
+	};
+
+	/**
+	 * A node of a k-d tree over the symbols: a group of symbols
+	 * and the smallest box around their statistics
+	 */
+	struct Node
+	{
+		/// Smallest and largest value of each statistic, in WEIGHTS order
+		double low[MATCHED], high[MATCHED];
+		/// Index in columns of the first symbol of a leaf
+		unsigned begin;
+		/// Number of symbols in a leaf, not counting padding, or 0
+		unsigned size;
+		/// Indices in nodes of the two halves, if not a leaf
+		unsigned children[2];
+	};
+
+	/**
+	 * The symbols in columns and the k-d tree over them, while being built
+	 */
+	struct Index
+	{
+		/// One column per statistic, as in Font::columns
+		std::vector<double> columns[MATCHED];
+		/// The character of each symbol in columns
+		std::vector<char> characters;
+		/// The k-d tree over the symbols; the first node is the root
+		std::vector<Node> nodes;
+	};
+
+	/**
+	 * The first part of a compiled font, which locates the rest
+	 */
+	struct CompiledHeader;
+
+	/**
+	 * Initializes a font with no symbols
+	 */
+	Font();
+
+	/**
+	 * Loads font information, as in Font(name, path)
+	 * @param name font name
+	 * @param path directories to look in, in order
+	 */
+	void find(const std::string & name, const std::vector<std::string> & path);
+
+	/**
+	 * Reads a font in the text format
+	 * @param file file name
+	 */
+	void parse(const std::string & file);
+
+	/**
+	 * Maps a font in the compiled format into memory
+	 * @param file file name
+	 * @return whether the file was a valid compiled font of this version
+	 */
+	bool load(const std::string & file);
+
+	/**
+	 * Uses a font in the compiled format that is already in memory
+	 * @param data first byte, aligned to COMPILED_ALIGNMENT
+	 * @param size number of bytes
+	 * @return whether the data was a valid compiled font of this version
+	 */
+	bool load(const char * data, size_t size);
+
+	/**
+	 * Stores symbols in columns, in the leaves of a k-d tree
+	 * @param incoming each symbol and its character
+	 */
+	void setSymbols(const std::vector<std::pair<char, Symbol> > & incoming);
+
+	/**
+	 * Builds a node of the k-d tree and everything below it
+	 * @param[in,out] incoming each symbol and its character; the part
+	 *                         belonging to this node is reordered
+	 * @param[in]     begin    first symbol of this node in incoming
+	 * @param[in]     end      one past the last symbol of this node
+	 * @param[in,out] index    the columns and tree built so far
+	 * @return index of the node in index.nodes
+	 */
+	static unsigned build(std::vector<std::pair<char, Symbol> > & incoming,
+	        unsigned begin, unsigned end, Index & index);
+
+	/**
+	 * Finds the lowest score Symbol::match could give any symbol in a node
+	 * @param node       a node
+	 * @param statistics statistics of an unknown symbol, in WEIGHTS order
+	 * @return lower bound on the score
+	 */
+	double bound(const Node & node, const double * statistics) const;
+
+	/**
+	 * Searches a node and everything below it that could hold a better match
+	 * @param[in]     node       a node
+	 * @param[in]     u          statistics on an unknown symbol
+	 * @param[in]     statistics the same, in WEIGHTS order
+	 * @param[in]     bounded    whether bound applies to the unknown symbol
+	 * @param[in,out] candidates best matches so far
+	 * @param[in,out] evaluated  number of symbols compared so far
+	 */
+	void search(const Node & node, const Symbol & u,
+	        const double * statistics, bool bounded, Candidates & candidates,
+	        unsigned long long & evaluated) const;
+
+	/**
+	 * Compares every symbol in a leaf to an unknown symbol
+	 * @param[in]     leaf       symbols to compare
+	 * @param[in]     u          statistics on an unknown symbol
+	 * @param[in]     statistics the same, in WEIGHTS order
+	 * @param[in,out] candidates best matches so far
+	 */
+	void matchLeaf(const Node & leaf, const Symbol & u,
+	        const double * statistics, Candidates & candidates) const;
+
+	/// Number of symbols compared at once
+	static const unsigned LANES = 4;
+	/// Maximum number of symbols in a leaf, unless they are all the same
+	static const unsigned LEAF_SIZE = 8;
+	/// The symbols of this font, one column per statistic in WEIGHTS order,
+	/// with the symbols of each leaf padded to a multiple of LANES with
+	/// symbols that never match
+	MappedArray<double> columns[MATCHED];
+	/// The character of each symbol in columns
+	MappedArray<char> characters;
+	/// The k-d tree over the symbols; the first node is the root
+	MappedArray<Node> nodes;
+	/// The characters with shapes, in order
+	MappedArray<char> templateCharacters;
+	/// The shape of each of templateCharacters
+	MappedArray<Template> templates;
+	/// The characters with densities in a grid, in order
+	MappedArray<char> zoneCharacters;
+	/// The densities in a grid over each of zoneCharacters
+	MappedArray<Zones> zones;
+	/// The characters with quantized statistics, in order
+	MappedArray<char> quantizedCharacters;
+	/// The quantized statistics of each of quantizedCharacters
+	MappedArray<QuantizedSymbol> quantized;
+	/// The character of each symbol with the deviation of its samples,
+	/// in the order of the font
+	MappedArray<char> spreadCharacters;
+	/// The mean and deviation of the samples of each of spreadCharacters
+	MappedArray<Spread> spreads;
+	/// The compiled font the arrays use, if any
+	std::shared_ptr<MappedFile> file;
+	/// The way characters are matched
+	Engine matcher;
+	/// Margin of the CASCADE engine
+	unsigned cascadeMargin;
+	/// Characters already read with this font
+	GlyphCache * glyphCache;
+	/// Matching effort so far, named as in Stats
+	mutable std::atomic<unsigned long long> searches, evaluations,
+	        reached[STAGES];
 };
 
 } // namespace OCR
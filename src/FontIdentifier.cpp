@@ -0,0 +1,120 @@
+/**
+ * @file FontIdentifier.cpp
+ * @date October 2026
+ * @author Omophagic Content Reader contributors
+ * @brief The implementation of the FontIdentifier class.
+ * @see FontIdentifier.h for the interface and documentation.
+ * @version $Id$
+ */
+/*
+ * Copyright 2026 Omophagic Content Reader contributors
+ *
+ * This file is part of Omophagic Content Reader.
+ *
+ * Omophagic Content Reader is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Omophagic Content Reader is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Omophagic Content Reader.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <thread>
+#include "FontIdentifier.h"
+#include "FeatureBatch.h"
+#include "Page.h"
+namespace OCR
+{
+
+const unsigned FontIdentifier::SAMPLE_SIZE;
+
+/**
+ * Finds the fonts built into the program and in the search path,
+ * text or compiled
+ * @param registry where to find and load fonts
+ */
+FontIdentifier::FontIdentifier(FontRegistry & registry) :
+	registry(registry), names(registry.available())
+{
+}
+
+/**
+ * Loads a font and measures how well it fits some characters
+ * @param[in]  registry where to load the font
+ * @param[in]  name     font name
+ * @param[in]  engine   only compare the font if it has data for this engine
+ * @param[in]  symbols  statistics on the characters
+ * @param[out] fit      mean score of the best match for each character,
+ *                      or -1 if the font was not compared
+ */
+static void scoreFont(FontRegistry * registry, const std::string * name,
+        Font::Engine engine, const std::vector<Font::Symbol> * symbols,
+        double * fit)
+{
+	*fit = -1;
+	std::shared_ptr<const Font> font = registry->get(*name);
+	if (!font->supports(engine) || symbols->empty())
+		return;
+	double total = 0;
+	for (unsigned i = 0; i < symbols->size(); ++i)
+	{
+		Font::Candidates matches = font->match((*symbols)[i], 1);
+		if (!matches.size())
+			return;
+		total += matches[0].score;
+	}
+	*fit = total / symbols->size();
+}
+
+/**
+ * Chooses the font that best fits a page
+ * @param img     BMP image of the page
+ * @param engine  only choose fonts that have data for this engine
+ * @param samples number of characters to compare
+ * @return name of the best fitting font, or an empty string if no font
+ *         could be compared
+ */
+std::string FontIdentifier::identify(BMP & img, Font::Engine engine,
+        unsigned samples)
+{
+	// Load every font while the page is sampled
+	std::thread loading(&FontRegistry::preload, &registry, names,
+	        Font::STATISTICS);
+
+	// Every font is compared using the same statistics, whatever the engine,
+	// since those are in every font and their scores mean the same in each
+	FeatureBatch features;
+	Page::sample(img, samples, features);
+	std::vector<Font::Symbol> symbols;
+	for (unsigned i = 0; i < features.size(); ++i)
+		symbols.push_back(features.symbol(i));
+	loading.join();
+
+	fit.assign(names.size(), -1);
+	std::vector<std::thread> threads;
+	for (unsigned i = 0; i < names.size(); ++i)
+		threads.push_back(std::thread(scoreFont, &registry, &names[i], engine,
+		        &symbols, &fit[i]));
+	for (unsigned i = 0; i < threads.size(); ++i)
+		threads[i].join();
+
+	// Of equally good fonts, the first in alphabetical order
+	std::string best;
+	double bestFit = 0;
+	for (unsigned i = 0; i < names.size(); ++i)
+		if (fit[i] >= 0 && (best.empty() || fit[i] < bestFit))
+		{
+			best = names[i];
+			bestFit = fit[i];
+		}
+	return best;
+}
+
+} // namespace OCR
@@ -0,0 +1,102 @@
+/**
+ * @file FontIdentifier.h
+ * @date October 2026
+ * @author Omophagic Content Reader contributors
+ * @brief The interface and documentation of the FontIdentifier class.
+ * @see FontIdentifier.cpp for the implementation.
+ * @version $Id$
+ */
+/*
+ * Copyright 2026 Omophagic Content Reader contributors
+ *
+ * This file is part of Omophagic Content Reader.
+ *
+ * Omophagic Content Reader is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Omophagic Content Reader is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Omophagic Content Reader.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef OCR_FONTIDENTIFIER_H_
+#define OCR_FONTIDENTIFIER_H_
+#include <string>
+#include <vector>
+#include "EasyBMP/EasyBMP.h"
+#include "Font.h"
+#include "FontRegistry.h"
+
+namespace OCR
+{
+
+/**
+ * Chooses the font of a page from all the fonts a FontRegistry can find.
+ *
+ * A few characters are sampled from the page, and every font is loaded
+ * and scored on its own thread, all sharing the statistics of the same
+ * sample. The font whose symbols are the closest on average fits best.
+ * The fonts stay loaded in the registry for reading the page.
+ */
+class FontIdentifier
+{
+public:
+	/// Number of characters sampled from a page, unless told otherwise
+	static const unsigned SAMPLE_SIZE = 32;
+
+	/**
+	 * Finds the fonts built into the program and in the search path,
+	 * text or compiled
+	 * @param registry where to find and load fonts
+	 */
+	FontIdentifier(FontRegistry & registry = FontRegistry::global());
+
+	/**
+	 * Get the fonts that can be chosen
+	 * @return font names, in alphabetical order
+	 */
+	const std::vector<std::string> & fonts() const
+	{
+		return names;
+	}
+
+	/**
+	 * Chooses the font that best fits a page
+	 * @param img     BMP image of the page
+	 * @param engine  only choose fonts that have data for this engine
+	 * @param samples number of characters to compare
+	 * @return name of the best fitting font, or an empty string if no font
+	 *         could be compared
+	 */
+	std::string identify(BMP & img, Font::Engine engine = Font::STATISTICS,
+	        unsigned samples = SAMPLE_SIZE);
+
+	/**
+	 * Get how well each font fit the page in the last identify
+	 * @return mean score of the best match for each character sampled,
+	 *         lower is better, or -1 for fonts that were not compared
+	 */
+	const std::vector<double> & scores() const
+	{
+		return fit;
+	}
+
+private:
+	/// Where to find and load fonts
+	FontRegistry & registry;
+	/// The fonts that can be chosen
+	std::vector<std::string> names;
+	/// How well each font fit the page in the last identify
+	std::vector<double> fit;
+};
+
+} // namespace OCR
+
+#endif /*OCR_FONTIDENTIFIER_H_*/
@@ -0,0 +1,198 @@
+/**
+ * @file FontRegistry.cpp
+ * @date October 2026
+ * @author Omophagic Content Reader contributors
+ * @brief The implementation of the FontRegistry class.
+ * @see FontRegistry.h for the interface and documentation.
+ * @version $Id$
+ */
+/*
+ * Copyright 2026 Omophagic Content Reader contributors
+ *
+ * This file is part of Omophagic Content Reader.
+ *
+ * Omophagic Content Reader is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Omophagic Content Reader is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Omophagic Content Reader.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <algorithm>
+#include <thread>
+#include <cstdlib>
+#include <dirent.h>
+#include <sys/stat.h>
+#include "FontRegistry.h"
+namespace OCR
+{
+
+const char * const FontRegistry::PATH_VARIABLE = "OCR_FONT_PATH";
+
+/**
+ * Initializes a registry with no fonts loaded yet
+ * @param path directories to look for fonts in, in order
+ */
+FontRegistry::FontRegistry(const std::vector<std::string> & path) :
+	directories(path)
+{
+}
+
+/**
+ * Get the registry shared by the whole program
+ * @return the registry, using the default search path
+ */
+FontRegistry & FontRegistry::global()
+{
+	static FontRegistry registry;
+	return registry;
+}
+
+/**
+ * Get the search path configured for the program: the directories in
+ * the environment variable PATH_VARIABLE, or else the font directory
+ * @return directories to look for fonts in, in order
+ */
+std::vector<std::string> FontRegistry::defaultPath()
+{
+	std::vector<std::string> path;
+	const char * variable = std::getenv(PATH_VARIABLE);
+	std::string remaining = variable ? variable : "";
+	while (!remaining.empty())
+	{
+		const std::string::size_type colon = remaining.find(':');
+		const std::string directory = remaining.substr(0, colon);
+		if (!directory.empty())
+			path.push_back(directory);
+		remaining = colon == std::string::npos ? "" : remaining.substr(colon
+		        + 1);
+	}
+	if (path.empty())
+		path.push_back("font");
+	return path;
+}
+
+/**
+ * Finds the font data file of a font, in the first directory of a
+ * search path that has it
+ * @param name font name
+ * @param path directories to look in, in order
+ * @return file name, or an empty string if no directory has it
+ */
+std::string FontRegistry::textFile(const std::string & name,
+        const std::vector<std::string> & path)
+{
+	for (unsigned d = 0; d < path.size(); ++d)
+	{
+		const std::string file = path[d] + "/" + name + ".font";
+		struct stat info;
+		if (stat(file.c_str(), &info) == 0)
+			return file;
+	}
+	return "";
+}
+
+/**
+ * Get a font, loading it if no one has yet
+ * @param name   font name
+ * @param engine matching method the font uses
+ * @return the font, shared with every other caller
+ */
+std::shared_ptr<const Font> FontRegistry::get(const std::string & name,
+        Font::Engine engine)
+{
+	std::shared_ptr<Entry> entry;
+	{
+		std::lock_guard<std::mutex> guard(lock);
+		std::shared_ptr<Entry> & found = fonts[std::make_pair(name, engine)];
+		if (!found)
+			found.reset(new Entry);
+		entry = found;
+	}
+
+	std::call_once(entry->loaded, &FontRegistry::load, this, name, engine,
+	        entry.get());
+	return entry->font;
+}
+
+/**
+ * Loads a font for the first caller to ask for it
+ * @param[in]  name   font name
+ * @param[in]  engine matching method the font uses
+ * @param[out] entry  where the font is kept
+ */
+void FontRegistry::load(const std::string & name, Font::Engine engine,
+        Entry * entry)
+{
+	// Other engines share the symbols of the font as first loaded
+	if (engine == Font::STATISTICS)
+	{
+		entry->font.reset(new Font(name, directories));
+		return;
+	}
+	Font * font = new Font(*get(name));
+	font->setEngine(engine);
+	entry->font.reset(font);
+}
+
+/**
+ * Loads several fonts at once, each on its own thread,
+ * so that later calls to get do not wait for them
+ * @param names  font names
+ * @param engine matching method the fonts use
+ */
+void FontRegistry::preload(const std::vector<std::string> & names,
+        Font::Engine engine)
+{
+	std::vector<std::thread> threads;
+	for (unsigned i = 0; i < names.size(); ++i)
+		threads.push_back(std::thread(&FontRegistry::get, this, names[i],
+		        engine));
+	for (unsigned i = 0; i < threads.size(); ++i)
+		threads[i].join();
+}
+
+/**
+ * Finds the fonts built into the program and in the search path,
+ * text or compiled
+ * @return font names, in alphabetical order
+ */
+std::vector<std::string> FontRegistry::available() const
+{
+	// Text fonts, and compiled fonts that may have no text font
+	std::vector<std::string> names = Font::embedded();
+	const std::string suffixes[] =
+	{ ".font", ".cfont" };
+	for (unsigned d = 0; d < directories.size(); ++d)
+	{
+		DIR * directory = opendir(directories[d].c_str());
+		if (!directory)
+			continue;
+		while (dirent * entry = readdir(directory))
+		{
+			std::string file = entry->d_name;
+			for (unsigned i = 0; i < 2; ++i)
+			{
+				const std::string & suffix = suffixes[i];
+				if (file.size() > suffix.size() && file.compare(file.size()
+				        - suffix.size(), suffix.size(), suffix) == 0)
+					names.push_back(file.substr(0, file.size()
+					        - suffix.size()));
+			}
+		}
+		closedir(directory);
+	}
+	std::sort(names.begin(), names.end());
+	names.erase(std::unique(names.begin(), names.end()), names.end());
+	return names;
+}
+
+} // namespace OCR
@@ -0,0 +1,151 @@
+/**
+ * @file FontRegistry.h
+ * @date October 2026
+ * @author Omophagic Content Reader contributors
+ * @brief The interface and documentation of the FontRegistry class.
+ * @see FontRegistry.cpp for the implementation.
+ * @version $Id$
+ */
+/*
+ * Copyright 2026 Omophagic Content Reader contributors
+ *
+ * This file is part of Omophagic Content Reader.
+ *
+ * Omophagic Content Reader is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Omophagic Content Reader is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Omophagic Content Reader.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef OCR_FONTREGISTRY_H_
+#define OCR_FONTREGISTRY_H_
+#include <string>
+#include <vector>
+#include <map>
+#include <memory>
+#include <mutex>
+#include "Font.h"
+
+namespace OCR
+{
+
+/**
+ * Loads each font once and shares it between every page and thread.
+ *
+ * Fonts are looked up by name in each directory of a search path in
+ * turn, then among the fonts built into the program. A font is loaded
+ * the first time it is asked for, and the same immutable Font is handed
+ * to every later caller; a font loaded while another thread asks for it
+ * is waited for, not loaded twice. All operations are safe to call from
+ * several threads.
+ */
+class FontRegistry
+{
+public:
+	/// Environment variable naming the font directories, separated by ':'
+	static const char * const PATH_VARIABLE;
+
+	/**
+	 * Initializes a registry with no fonts loaded yet
+	 * @param path directories to look for fonts in, in order
+	 */
+	FontRegistry(const std::vector<std::string> & path = defaultPath());
+
+	/**
+	 * Get the registry shared by the whole program
+	 * @return the registry, using the default search path
+	 */
+	static FontRegistry & global();
+
+	/**
+	 * Get the search path configured for the program: the directories in
+	 * the environment variable PATH_VARIABLE, or else the font directory
+	 * @return directories to look for fonts in, in order
+	 */
+	static std::vector<std::string> defaultPath();
+
+	/**
+	 * Finds the font data file of a font, in the first directory of a
+	 * search path that has it
+	 * @param name font name
+	 * @param path directories to look in, in order
+	 * @return file name, or an empty string if no directory has it
+	 */
+	static std::string textFile(const std::string & name,
+	        const std::vector<std::string> & path = defaultPath());
+
+	/**
+	 * Get the search path
+	 * @return directories to look for fonts in, in order
+	 */
+	const std::vector<std::string> & path() const
+	{
+		return directories;
+	}
+
+	/**
+	 * Get a font, loading it if no one has yet
+	 * @param name   font name
+	 * @param engine matching method the font uses
+	 * @return the font, shared with every other caller
+	 */
+	std::shared_ptr<const Font> get(const std::string & name,
+	        Font::Engine engine = Font::STATISTICS);
+
+	/**
+	 * Loads several fonts at once, each on its own thread,
+	 * so that later calls to get do not wait for them
+	 * @param names  font names
+	 * @param engine matching method the fonts use
+	 */
+	void preload(const std::vector<std::string> & names,
+	        Font::Engine engine = Font::STATISTICS);
+
+	/**
+	 * Finds the fonts built into the program and in the search path,
+	 * text or compiled
+	 * @return font names, in alphabetical order
+	 */
+	std::vector<std::string> available() const;
+
+private:
+	/**
+	 * A font, loaded once
+	 */
+	struct Entry
+	{
+		/// Whether the font has been loaded
+		std::once_flag loaded;
+		/// The font, once loaded
+		std::shared_ptr<const Font> font;
+	};
+
+	/**
+	 * Loads a font for the first caller to ask for it
+	 * @param[in]  name   font name
+	 * @param[in]  engine matching method the font uses
+	 * @param[out] entry  where the font is kept
+	 */
+	void load(const std::string & name, Font::Engine engine, Entry * entry);
+
+	/// Directories to look for fonts in, in order
+	std::vector<std::string> directories;
+	/// Every font asked for, by name and engine
+	std::map<std::pair<std::string, Font::Engine>, std::shared_ptr<Entry> >
+	        fonts;
+	/// Guards fonts, but not the loading of each font
+	mutable std::mutex lock;
+};
+
+} // namespace OCR
+
+#endif /*OCR_FONTREGISTRY_H_*/
@@ -0,0 +1,175 @@
+/**
+ * @file GlyphCache.cpp
+ * @date October 2026
+ * @author Omophagic Content Reader contributors
+ * @brief The implementation of the GlyphCache class.
+ * @see GlyphCache.h for the interface and documentation.
+ * @version $Id$
+ */
+/*
+ * Copyright 2026 Omophagic Content Reader contributors
+ *
+ * This file is part of Omophagic Content Reader.
+ *
+ * Omophagic Content Reader is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Omophagic Content Reader is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Omophagic Content Reader.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "GlyphCache.h"
+#include "FeatureBatch.h"
+namespace OCR
+{
+
+/**
+ * Mixes a word into a hash
+ * @param hash hash so far
+ * @param word word to add
+ * @return new hash
+ */
+static inline unsigned long long mix(unsigned long long hash,
+        unsigned long long word)
+{
+	hash ^= word;
+	hash *= 0x9E3779B97F4A7C15ULL;
+	return hash ^ (hash >> 29);
+}
+
+/**
+ * Packs the pixels of part of an image
+ * @param img  binarized image
+ * @param part part of the image containing the character
+ */
+GlyphCache::Key::Key(const BinaryImage & img, const Box & part) :
+	width(part.width()), height(part.height()),
+	        bits((width * height + 63) / 64, 0)
+{
+	unsigned bit = 0;
+	for (unsigned x = part.low.x; x <= part.high.x; ++x)
+		for (unsigned y = part.low.y; y <= part.high.y; ++y, ++bit)
+			if (img(x, y))
+				bits[bit / 64] |= 1ULL << (bit % 64);
+
+	hash = mix(width, height);
+	for (unsigned i = 0; i < bits.size(); ++i)
+		hash = mix(hash, bits[i]);
+}
+
+/**
+ * Initializes an empty key
+ */
+GlyphCache::Key::Key() :
+	width(0), height(0), hash(0)
+{
+}
+
+/**
+ * Initializes an empty cache
+ * @param capacity maximum number of entries, rounded up to a power of 2
+ */
+GlyphCache::GlyphCache(unsigned capacity) :
+	size(1)
+{
+	while (size < capacity)
+		size *= 2;
+	counters.hits = counters.misses = counters.evictions = 0;
+}
+
+/**
+ * Looks up a character. A character stored without some of the
+ * information asked for is not found, so that it is extracted again.
+ * @param[in]  key       pixels of the character
+ * @param[in]  extracted FeatureBatch::Optional information needed,
+ *                       combined with |
+ * @param[in]  grid      size of the grid for FeatureBatch::ZONES
+ * @param[out] glyph     what is remembered of the character, if found
+ * @return whether found
+ */
+bool GlyphCache::find(const Key & key, unsigned extracted, const Zones & grid,
+        Glyph & glyph)
+{
+	std::lock_guard<std::mutex> guard(lock);
+	const Entry * entry = entries.empty() ? NULL : &entries[key.hash
+	        & (entries.size() - 1)];
+	if (!entry || !entry->used || !(entry->key == key)
+	        || (entry->glyph.extracted & extracted) != extracted
+	        || ((extracted & FeatureBatch::ZONES)
+	                && (entry->glyph.zones.rows != grid.rows
+	                        || entry->glyph.zones.cols != grid.cols)))
+	{
+		++counters.misses;
+		return false;
+	}
+	++counters.hits;
+	glyph = entry->glyph;
+	return true;
+}
+
+/**
+ * Stores a character
+ * @param key   pixels of the character
+ * @param glyph what to remember of the character
+ */
+void GlyphCache::insert(const Key & key, const Glyph & glyph)
+{
+	std::lock_guard<std::mutex> guard(lock);
+	// Entries are only made when first needed, value-initialized as unused
+	if (entries.empty())
+		entries.resize(size);
+	Entry & entry = entries[key.hash & (entries.size() - 1)];
+	if (entry.used && !(entry.key == key))
+		++counters.evictions;
+	entry.used = true;
+	entry.key = key;
+	entry.glyph = glyph;
+}
+
+/**
+ * Removes all entries and resets the statistics
+ */
+void GlyphCache::clear()
+{
+	std::lock_guard<std::mutex> guard(lock);
+	for (unsigned i = 0; i < entries.size(); ++i)
+	{
+		entries[i].used = false;
+		entries[i].key = Key();
+	}
+	counters.hits = counters.misses = counters.evictions = 0;
+}
+
+/**
+ * Get statistics on cache effectiveness
+ * @return hits, misses and evictions so far
+ */
+GlyphCache::Stats GlyphCache::stats() const
+{
+	std::lock_guard<std::mutex> guard(lock);
+	return counters;
+}
+
+/**
+ * Writes cache statistics to an output stream
+ * @param outs  output stream
+ * @param stats cache statistics
+ * @return output stream
+ */
+std::ostream & operator<<(std::ostream & outs, const GlyphCache::Stats & stats)
+{
+	outs << "hits " << stats.hits << ", misses " << stats.misses
+	        << ", evictions " << stats.evictions << ", hit rate "
+	        << stats.hitRate() * 100 << '%';
+	return outs;
+}
+
+} // namespace OCR
@@ -0,0 +1,210 @@
+/**
+ * @file GlyphCache.h
+ * @date October 2026
+ * @author Omophagic Content Reader contributors
+ * @brief The interface and documentation of the GlyphCache class.
+ * @see GlyphCache.cpp for the implementation.
+ * @version $Id$
+ */
+/*
+ * Copyright 2026 Omophagic Content Reader contributors
+ *
+ * This file is part of Omophagic Content Reader.
+ *
+ * Omophagic Content Reader is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Omophagic Content Reader is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Omophagic Content Reader.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef OCR_GLYPHCACHE_H_
+#define OCR_GLYPHCACHE_H_
+#include <vector>
+#include <iostream>
+#include <mutex>
+#include "BinaryImage.h"
+#include "Font.h"
+#include "Template.h"
+#include "Zones.h"
+#include "QuantizedSymbol.h"
+
+namespace OCR
+{
+
+/**
+ * Remembers the statistics and best match of characters already read,
+ * so that identical characters are not examined again. Whatever was
+ * extracted of a character is stored as it was first computed, so that
+ * a character reads the same whether found in the cache or not.
+ *
+ * Characters are identified by their exact pixels. The cache holds a
+ * fixed number of entries; each character can only be stored in the one
+ * entry chosen by its hash, replacing whatever was there before.
+ * All operations are safe to call from several threads.
+ */
+class GlyphCache
+{
+public:
+	/**
+	 * The exact pixels of a character
+	 */
+	class Key
+	{
+	public:
+		/**
+		 * Packs the pixels of part of an image
+		 * @param img  binarized image
+		 * @param part part of the image containing the character
+		 */
+		Key(const BinaryImage & img, const Box & part);
+
+		/**
+		 * Initializes an empty key
+		 */
+		Key();
+
+		/**
+		 * Compares this to another Key
+		 * @param rhs another Key
+		 * @return whether the pixels are the same
+		 */
+		bool operator==(const Key & rhs) const
+		{
+			return hash == rhs.hash && width == rhs.width && height
+			        == rhs.height && bits == rhs.bits;
+		}
+
+		/// Dimensions of the character
+		unsigned width, height;
+		/// Whether each pixel is foreground, 64 pixels per word
+		std::vector<unsigned long long> bits;
+		/// Hash of the dimensions and pixels
+		unsigned long long hash;
+	};
+
+	/**
+	 * Everything remembered about a character
+	 */
+	struct Glyph
+	{
+		/// Statistics of the character
+		Font::Symbol symbol;
+		/// Which of raster, zones and quantized were extracted,
+		/// as FeatureBatch::Optional values combined with |
+		unsigned extracted;
+		/// Template of the character
+		Template raster;
+		/// Densities in a grid over the character
+		Zones zones;
+		/// Statistics of the character as integers
+		QuantizedSymbol quantized;
+		/// Best match for the character
+		char character;
+		/// Confidence in the match
+		double confidence;
+	};
+
+	/**
+	 * Cache effectiveness
+	 */
+	struct Stats
+	{
+		/// Number of lookups that found an entry
+		unsigned long long hits;
+		/// Number of lookups that did not find an entry
+		unsigned long long misses;
+		/// Number of entries replaced by a different character
+		unsigned long long evictions;
+
+		/**
+		 * Get the proportion of lookups that found an entry
+		 * @return hits / lookups, or 0 if there were none
+		 */
+		double hitRate() const
+		{
+			return hits + misses ? hits / (double) (hits + misses) : 0;
+		}
+	};
+
+	/**
+	 * Initializes an empty cache
+	 * @param capacity maximum number of entries, rounded up to a power of 2
+	 */
+	GlyphCache(unsigned capacity = 4096);
+
+	/**
+	 * Looks up a character. A character stored without some of the
+	 * information asked for is not found, so that it is extracted again.
+	 * @param[in]  key       pixels of the character
+	 * @param[in]  extracted FeatureBatch::Optional information needed,
+	 *                       combined with |
+	 * @param[in]  grid      size of the grid for FeatureBatch::ZONES
+	 * @param[out] glyph     what is remembered of the character, if found
+	 * @return whether found
+	 */
+	bool find(const Key & key, unsigned extracted, const Zones & grid,
+	        Glyph & glyph);
+
+	/**
+	 * Stores a character
+	 * @param key   pixels of the character
+	 * @param glyph what to remember of the character
+	 */
+	void insert(const Key & key, const Glyph & glyph);
+
+	/**
+	 * Removes all entries and resets the statistics
+	 */
+	void clear();
+
+	/**
+	 * Get statistics on cache effectiveness
+	 * @return hits, misses and evictions so far
+	 */
+	Stats stats() const;
+
+private:
+	/**
+	 * A cached character
+	 */
+	struct Entry
+	{
+		/// Whether anything is stored here
+		bool used;
+		/// Pixels of the character
+		Key key;
+		/// What is remembered of the character
+		Glyph glyph;
+	};
+
+	/// Number of entries, a power of 2
+	unsigned size;
+	/// All entries, or none until the first is stored;
+	/// a character is stored at its hash modulo the size
+	std::vector<Entry> entries;
+	/// Effectiveness so far
+	Stats counters;
+	/// Guards entries and counters
+	mutable std::mutex lock;
+};
+
+/**
+ * Writes cache statistics to an output stream
+ * @param outs  output stream
+ * @param stats cache statistics
+ * @return output stream
+ */
+std::ostream & operator<<(std::ostream & outs, const GlyphCache::Stats & stats);
+
+} // namespace OCR
+
+#endif /*OCR_GLYPHCACHE_H_*/
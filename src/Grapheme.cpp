@@ -27,6 +27,7 @@
  */
 
 #include "Grapheme.h"
+#include "Profile.h"
 namespace OCR
 {
 
@@ -207,6 +208,7 @@ void Grapheme::pareDown()
  */
 unsigned char Grapheme::countHoles() const
 {
+	OCR_PROFILE_TIME(HOLES);
 	unsigned char holeCount = 0;
 	// Initialize visited array
 	bool ** visited = new bool *[part.width()];
@@ -260,6 +262,7 @@ double Grapheme::areaDensity(Box area) const
 		for (current.y = area.low.y; current.y <= area.high.y; ++current.y, ++pixelCount)
 			if (isForeground(image(current.x, current.y)))
 				++foregroundCount;
+	OCR_PROFILE_COUNT(PIXELS, pixelCount);
 	return foregroundCount / (double) pixelCount;
 }
 
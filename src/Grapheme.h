@@ -89,8 +89,6 @@ public:
 	/// The symbol statistics
 	Font::Symbol theSymbol;
 
-private:
-
 	/**
 	 * Sets the left, right, bottom, and top coordinates
 	 * such that they surround the foreground pixels contained
@@ -110,6 +108,7 @@ private:
 	 */
 	double areaDensity(Box area) const;
 
+private:
 	/// The image
 	BMP & image;
 	/// The part of the image to use
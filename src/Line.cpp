@@ -27,6 +27,7 @@
  */
 
 #include "Line.h"
+#include "Profile.h"
 namespace OCR
 {
 
@@ -39,7 +40,7 @@ const double Line::SPACE = 0.28;
  * @param f font to use
  */
 Line::Line(BMP & img, const Font & f) :
-	image(img), top(0), font(f)
+	image(img), top(0), font(f), glyphs(0)
 {
 	bottom = image.TellHeight() - 1;
 }
@@ -52,7 +53,7 @@ Line::Line(BMP & img, const Font & f) :
  * @param f font to use
  */
 Line::Line(BMP & img, int y1, int y2, const Font & f) :
-	image(img), top(y1), bottom(y2), font(f)
+	image(img), top(y1), bottom(y2), font(f), glyphs(0)
 {
 }
 
@@ -61,7 +62,9 @@ Line::Line(BMP & img, int y1, int y2, const Font & f) :
  * @param other a Line object
  */
 Line::Line(const Line & other) :
-	image(other.image), top(other.top), bottom(other.bottom), font(other.font)
+	image(other.image), top(other.top), bottom(other.bottom),
+	        font(other.font), glyphs(other.glyphs),
+	        confidence(other.confidence)
 {
 }
 
@@ -74,52 +77,192 @@ Line & Line::operator =(const Line & other)
 	image = other.image;
 	top = other.top;
 	bottom = other.bottom;
+	glyphs = other.glyphs;
+	confidence = other.confidence;
 	return *this;
 }
 
 /**
- * Recognizes the text.
- * @param symData optionally store symbol data in a vector
- * @return text of the line.
+ * Get the confidence in the text from the last Read
+ * @return mean confidence of the characters, or 1 if there were none
  */
-std::string Line::Read(std::vector<Font::Symbol> * symData)
+double Line::lineConfidence() const
 {
-	std::string result = "";
-	// Divide into symbols
-	int left = 0, right = 0; // of the current grapheme
+	if (confidence.empty())
+		return 1;
+	double sum = 0;
+	for (unsigned i = 0; i < confidence.size(); ++i)
+		sum += confidence[i];
+	return sum / confidence.size();
+}
+
+/**
+ * Divides a line into symbols at the columns with no foreground pixels
+ * @param[in]  line          binarized image containing the line
+ * @param[in]  area          the part of the image holding the line
+ * @param[out] spaced        optionally store whether a space precedes
+ *                           each symbol
+ * @param[out] trailingSpace optionally store whether a space follows
+ *                           the last symbol
+ * @return the part of the image for each symbol
+ */
+std::vector<Box> Line::split(const BinaryImage & line, const Box & area,
+        std::vector<bool> * spaced, bool * trailingSpace)
+{
+	OCR_PROFILE_TIME(SPLIT);
+	std::vector<Box> parts;
+	const int top = area.low.y, bottom = area.high.y;
+	bool spaceBefore = false; // whether a space precedes an unfinished symbol
+	int left = 0, right = area.low.x; // of the current grapheme
 	bool inSymbol = false; // Whether in a symbol
 
-	// Split horizontally into letters, read each and concatenate
-	for (int col = 0; col < image.TellWidth(); ++col)
+	// Split horizontally into letters
+	for (int col = area.low.x; col <= (int) area.high.x; ++col)
 	{
 		// Search for a foreground pixel in this column
-		bool fgFound = false;
-		for (unsigned row = top; row <= bottom && !fgFound; ++row)
-			if (isForeground(image(col, row)))
-				fgFound = true;
+		bool fgFound = line.count(Box(col, top, col, bottom)) > 0;
 
 		if (fgFound && !inSymbol)
 		// Starting a new symbol
 		{
 			left = col;
-			if (left - right > SPACE * (bottom - top))
-				// Large space, add a space character to the result
-				result += ' ';
+			// Large space, add a space character before this symbol
+			spaceBefore = left - right > SPACE * (bottom - top);
 			inSymbol = true;
 		}
 		else if (!fgFound && inSymbol)
 		// End of a symbol
 		{
 			right = col + 1;
-			Grapheme sym(image, left, top, right, bottom, font);
-			result += sym.Read();
-			// If storing symbol data, add this
-			if (symData)
-				symData->push_back(sym.theSymbol);
+			parts.push_back(Box(left, top, right, bottom));
+			if (spaced)
+				spaced->push_back(spaceBefore);
+			spaceBefore = false;
 			inSymbol = false;
 		}
 	}
+	if (trailingSpace)
+		*trailingSpace = spaceBefore;
+	return parts;
+}
+
+/**
+ * Recognizes the text.
+ * @param symData   optionally store symbol data in a vector
+ * @param features optionally add all information extracted on each
+ *                 symbol, including the Optional information it asks for
+ * @return text of the line.
+ */
+std::string Line::Read(std::vector<Font::Symbol> * symData,
+        FeatureBatch * features)
+{
+	OCR_PROFILE_TIME(LINE);
+	std::string result = "";
+	// Binarize the line once
+	const Box area(0, top, image.TellWidth() - 1, bottom);
+	BinaryImage line(image, area);
+
+	// Divide into symbols
+	std::vector<bool> spaced; // whether a space precedes each symbol
+	bool trailingSpace; // whether a space precedes an unfinished symbol
+	std::vector<Box> parts = split(line, area, &spaced, &trailingSpace);
+	OCR_PROFILE_COUNT(GLYPHS, parts.size());
+	glyphs = parts.size();
+	confidence.clear();
+	if (font.engine() == Font::CASCADE && !symData && !features)
+		return readCascade(line, parts, spaced, trailingSpace);
+
+	// Find statistics on all letters, then read each and concatenate
+	GlyphCache & cache = font.cache();
+	unsigned optional = features ? features->extracted() : 0;
+	if (font.engine() == Font::TEMPLATE)
+		optional |= FeatureBatch::RASTER;
+	if (font.engine() == Font::ZONING)
+		optional |= FeatureBatch::ZONES;
+	if (font.engine() == Font::QUANTIZED)
+		optional |= FeatureBatch::QUANTIZED;
+	FeatureBatch batch(optional, font.engine() == Font::ZONING
+	        ? font.zoneGrid() : features ? features->zoneGrid() : Zones(4, 4));
+	batch.extract(line, parts, &cache);
+	for (unsigned i = 0; i < batch.size(); ++i)
+	{
+		OCR_PROFILE_GLYPH(i);
+		if (spaced[i])
+			result += ' ';
+		Font::Symbol sym = batch.symbol(i);
+		if (batch.cached[i])
+		{
+			result += batch.characters[i];
+			confidence.push_back(batch.confidence[i]);
+		}
+		else
+		{
+			// The two best matches, to see how close the match was
+			Font::Candidates matches;
+			switch (font.engine())
+			{
+			case Font::TEMPLATE:
+				matches = font.match(batch.templates[i], 2);
+				break;
+			case Font::ZONING:
+				matches = font.match(batch.zones[i], 2);
+				break;
+			case Font::QUANTIZED:
+				matches = font.match(batch.quantized[i], 2);
+				break;
+			case Font::CASCADE:
+				matches = font.match(line, batch.parts[i], 2);
+				break;
+			case Font::NORMALIZED:
+				matches = font.matchNormalized(sym, 2);
+				break;
+			default:
+				matches = font.match(sym, 2);
+			}
+			cache.insert(batch.keys[i], batch.glyph(i, matches.best(),
+			        matches.confidence()));
+			result += matches.best();
+			confidence.push_back(matches.confidence());
+		}
+		// If storing symbol data, add this
+		if (symData)
+			symData->push_back(sym);
+	}
+	if (trailingSpace)
+		result += ' ';
+	if (features)
+		features->append(batch);
+
+	return result;
+}
 
+/**
+ * Recognizes each symbol with the CASCADE engine, extracting only
+ * the information it needs
+ * @param line          binarized image containing the line
+ * @param parts         the part of the image for each symbol
+ * @param spaced        whether a space precedes each symbol
+ * @param trailingSpace whether a space follows the last symbol
+ * @return text of the line.
+ */
+std::string Line::readCascade(const BinaryImage & line,
+        std::vector<Box> & parts, const std::vector<bool> & spaced,
+        bool trailingSpace)
+{
+	// Without the cache, whose keys cost as much as the holes it would save
+	std::string result = "";
+	for (unsigned i = 0; i < parts.size(); ++i)
+	{
+		OCR_PROFILE_GLYPH(i);
+		if (spaced[i])
+			result += ' ';
+		line.pareDown(parts[i]);
+		Font::Candidates matches = font.match(line, parts[i], 2);
+		result += matches.best();
+		confidence.push_back(matches.confidence());
+	}
+	if (trailingSpace)
+		result += ' ';
 	return result;
 }
 
@@ -29,10 +29,12 @@
 #ifndef OCR_LINE_H_
 #define OCR_LINE_H_
 #include <string>
+#include <vector>
 #include "EasyBMP/EasyBMP.h"
 #include "OCR.h"
 #include "Font.h"
-#include "Grapheme.h"
+#include "BinaryImage.h"
+#include "FeatureBatch.h"
 
 namespace OCR
 {
@@ -72,12 +74,65 @@ public:
 
 	/**
 	 * Recognizes the text.
-	 * @param symData optionally store symbol data in a vector
+	 * @param symData   optionally store symbol data in a vector
+	 * @param features optionally add all information extracted on each
+	 *                 symbol, including the Optional information it asks for
 	 * @return text of the line.
 	 */
-	std::string Read(std::vector<Font::Symbol> * symData = NULL);
+	std::string Read(std::vector<Font::Symbol> * symData = NULL,
+	        FeatureBatch * features = NULL);
+
+	/**
+	 * Divides a line into symbols at the columns with no foreground pixels
+	 * @param[in]  line          binarized image containing the line
+	 * @param[in]  area          the part of the image holding the line
+	 * @param[out] spaced        optionally store whether a space precedes
+	 *                           each symbol
+	 * @param[out] trailingSpace optionally store whether a space follows
+	 *                           the last symbol
+	 * @return the part of the image for each symbol
+	 */
+	static std::vector<Box> split(const BinaryImage & line, const Box & area,
+	        std::vector<bool> * spaced = NULL, bool * trailingSpace = NULL);
+
+	/**
+	 * Get the confidence in each character from the last Read
+	 * @return how much better each match was than the next best,
+	 *         from 0 to 1, not counting spaces
+	 */
+	const std::vector<double> & glyphConfidence() const
+	{
+		return confidence;
+	}
+
+	/**
+	 * Get the number of characters found by the last Read
+	 * @return number of characters, not counting spaces
+	 */
+	unsigned glyphCount() const
+	{
+		return glyphs;
+	}
+
+	/**
+	 * Get the confidence in the text from the last Read
+	 * @return mean confidence of the characters, or 1 if there were none
+	 */
+	double lineConfidence() const;
 
 private:
+	/**
+	 * Recognizes each symbol with the CASCADE engine, extracting only
+	 * the information it needs
+	 * @param line          binarized image containing the line
+	 * @param parts         the part of the image for each symbol
+	 * @param spaced        whether a space precedes each symbol
+	 * @param trailingSpace whether a space follows the last symbol
+	 * @return text of the line.
+	 */
+	std::string readCascade(const BinaryImage & line, std::vector<Box> & parts,
+	        const std::vector<bool> & spaced, bool trailingSpace);
+
 	/// The minimum relative width of a space character
 	static const double SPACE;
 	/// The image
@@ -86,6 +141,10 @@ private:
 	unsigned top, bottom;
 	/// The font to use
 	const Font & font;
+	/// Number of characters found by the last Read
+	unsigned glyphs;
+	/// Confidence in each character read
+	std::vector<double> confidence;
 };
 } // namespace OCR
 
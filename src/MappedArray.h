@@ -0,0 +1,230 @@
+/**
+ * @file MappedArray.h
+ * @date October 2026
+ * @author Omophagic Content Reader contributors
+ * @brief The interface, documentation and implementation of the
+ *        MappedArray class.
+ * @version $Id$
+ */
+/*
+ * Copyright 2026 Omophagic Content Reader contributors
+ *
+ * This file is part of Omophagic Content Reader.
+ *
+ * Omophagic Content Reader is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Omophagic Content Reader is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Omophagic Content Reader.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef OCR_MAPPEDARRAY_H_
+#define OCR_MAPPEDARRAY_H_
+#include <vector>
+#include <cstddef>
+#include <new>
+
+namespace OCR
+{
+
+/**
+ * Allocates elements on cache line boundaries, as the parts of a compiled
+ * font are stored, so that vector loads of them never split a line
+ */
+template<typename T>
+class AlignedAllocator
+{
+public:
+	/// Type of the elements allocated
+	typedef T value_type;
+	/// Alignment of every allocation, in bytes
+	static const std::size_t ALIGNMENT = 64;
+
+	/**
+	 * Initializes the allocator
+	 */
+	AlignedAllocator()
+	{
+	}
+
+	/**
+	 * Initializes the allocator from one for another type
+	 */
+	template<typename U>
+	AlignedAllocator(const AlignedAllocator<U> &)
+	{
+	}
+
+	/**
+	 * Allocates room for elements
+	 * @param n number of elements
+	 * @return first element
+	 */
+	T * allocate(std::size_t n)
+	{
+		return static_cast<T *> (::operator new(n * sizeof(T),
+		        std::align_val_t(ALIGNMENT)));
+	}
+
+	/**
+	 * Frees room for elements from allocate
+	 * @param elements first element
+	 */
+	void deallocate(T * elements, std::size_t)
+	{
+		::operator delete(elements, std::align_val_t(ALIGNMENT));
+	}
+
+	/**
+	 * Compares this to another allocator
+	 * @return true, since any can free what another allocated
+	 */
+	template<typename U>
+	bool operator==(const AlignedAllocator<U> &) const
+	{
+		return true;
+	}
+
+	/**
+	 * Compares this to another allocator
+	 * @return false, since any can free what another allocated
+	 */
+	template<typename U>
+	bool operator!=(const AlignedAllocator<U> &) const
+	{
+		return false;
+	}
+};
+
+/**
+ * A read-only array that either holds its own elements or uses elements
+ * stored elsewhere, such as in a MappedFile, without copying them.
+ * Elements stored elsewhere must outlive the array and its copies.
+ * Elements it holds start on a cache line, as those of a compiled font do.
+ */
+template<typename T>
+class MappedArray
+{
+public:
+	/**
+	 * Initializes an empty array
+	 */
+	MappedArray() :
+		data(NULL), count(0)
+	{
+	}
+
+	/**
+	 * Initializes the object as a copy of another
+	 * @param other a MappedArray object
+	 */
+	MappedArray(const MappedArray & other) :
+		data(NULL), count(0)
+	{
+		*this = other;
+	}
+
+	/**
+	 * Copies the elements of another object, or shares them if they are
+	 * stored elsewhere
+	 * @param other a MappedArray object
+	 */
+	MappedArray & operator =(const MappedArray & other)
+	{
+		if (this == &other)
+			return *this;
+		if (other.owned.empty())
+		{
+			owned.clear();
+			data = other.data;
+			count = other.count;
+		}
+		else
+		{
+			owned = other.owned;
+			data = &owned[0];
+			count = owned.size();
+		}
+		return *this;
+	}
+
+	/**
+	 * Copies elements into the array
+	 * @param values elements
+	 */
+	void assign(const std::vector<T> & values)
+	{
+		owned.assign(values.begin(), values.end());
+		data = owned.empty() ? NULL : &owned[0];
+		count = owned.size();
+	}
+
+	/**
+	 * Uses elements stored elsewhere
+	 * @param values first element
+	 * @param n      number of elements
+	 */
+	void map(const T * values, unsigned n)
+	{
+		owned.clear();
+		data = n ? values : NULL;
+		count = n;
+	}
+
+	/**
+	 * Get an element
+	 * @param i index of the element
+	 * @return the element
+	 */
+	const T & operator[](unsigned i) const
+	{
+		return data[i];
+	}
+
+	/**
+	 * Get all the elements
+	 * @return first element, or NULL if there are none
+	 */
+	const T * begin() const
+	{
+		return data;
+	}
+
+	/**
+	 * Get the number of elements
+	 * @return number of elements
+	 */
+	unsigned size() const
+	{
+		return count;
+	}
+
+	/**
+	 * Determines whether there are any elements
+	 * @return whether there are none
+	 */
+	bool empty() const
+	{
+		return !count;
+	}
+
+private:
+	/// Elements held by this array, if not stored elsewhere
+	std::vector<T, AlignedAllocator<T> > owned;
+	/// First element
+	const T * data;
+	/// Number of elements
+	unsigned count;
+};
+
+} // namespace OCR
+
+#endif /*OCR_MAPPEDARRAY_H_*/
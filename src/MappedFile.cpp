@@ -0,0 +1,71 @@
+/**
+ * @file MappedFile.cpp
+ * @date October 2026
+ * @author Omophagic Content Reader contributors
+ * @brief The implementation of the MappedFile class.
+ * @see MappedFile.h for the interface and documentation.
+ * @version $Id$
+ */
+/*
+ * Copyright 2026 Omophagic Content Reader contributors
+ *
+ * This file is part of Omophagic Content Reader.
+ *
+ * Omophagic Content Reader is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Omophagic Content Reader is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Omophagic Content Reader.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include "MappedFile.h"
+namespace OCR
+{
+
+/**
+ * Maps a file into memory
+ * @param name file name
+ */
+MappedFile::MappedFile(const std::string & name) :
+	contents(NULL), length(0)
+{
+	int fd = open(name.c_str(), O_RDONLY);
+	if (fd < 0)
+		return;
+	struct stat info;
+	if (fstat(fd, &info) == 0 && info.st_size > 0)
+	{
+		void * mapped = mmap(NULL, info.st_size, PROT_READ, MAP_PRIVATE, fd,
+		        0);
+		if (mapped != MAP_FAILED)
+		{
+			contents = static_cast<const char *> (mapped);
+			length = info.st_size;
+		}
+	}
+	// The mapping stays valid after the file is closed
+	close(fd);
+}
+
+/**
+ * Unmaps the file
+ */
+MappedFile::~MappedFile()
+{
+	if (contents)
+		munmap(const_cast<char *> (contents), length);
+}
+
+} // namespace OCR
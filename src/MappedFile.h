@@ -0,0 +1,95 @@
+/**
+ * @file MappedFile.h
+ * @date October 2026
+ * @author Omophagic Content Reader contributors
+ * @brief The interface and documentation of the MappedFile class.
+ * @see MappedFile.cpp for the implementation.
+ * @version $Id$
+ */
+/*
+ * Copyright 2026 Omophagic Content Reader contributors
+ *
+ * This file is part of Omophagic Content Reader.
+ *
+ * Omophagic Content Reader is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Omophagic Content Reader is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Omophagic Content Reader.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef OCR_MAPPEDFILE_H_
+#define OCR_MAPPEDFILE_H_
+#include <string>
+#include <cstddef>
+
+namespace OCR
+{
+
+/**
+ * The contents of a file, mapped read-only into memory
+ * so that they can be used without reading or copying them
+ */
+class MappedFile
+{
+public:
+	/**
+	 * Maps a file into memory
+	 * @param name file name
+	 */
+	MappedFile(const std::string & name);
+
+	/**
+	 * Unmaps the file
+	 */
+	~MappedFile();
+
+	/**
+	 * Get the contents of the file
+	 * @return first byte, aligned to a page, or NULL if the file could
+	 *         not be mapped
+	 */
+	const char * data() const
+	{
+		return contents;
+	}
+
+	/**
+	 * Get the size of the file
+	 * @return number of bytes, or 0 if the file could not be mapped
+	 */
+	size_t size() const
+	{
+		return length;
+	}
+
+private:
+	/**
+	 * Not copyable, since the mapping belongs to one object
+	 * @param other a MappedFile object
+	 */
+	MappedFile(const MappedFile & other);
+
+	/**
+	 * Not copyable, since the mapping belongs to one object
+	 * @param other a MappedFile object
+	 */
+	MappedFile & operator =(const MappedFile & other);
+
+	/// Contents of the file
+	const char * contents;
+	/// Size of the file
+	size_t length;
+};
+
+} // namespace OCR
+
+#endif /*OCR_MAPPEDFILE_H_*/
@@ -0,0 +1,167 @@
+/**
+ * @file Moments.cpp
+ * @date October 2026
+ * @author Omophagic Content Reader contributors
+ * @brief The implementation of the Moments class.
+ * @see Moments.h for the interface and documentation.
+ * @version $Id$
+ */
+/*
+ * Copyright 2026 Omophagic Content Reader contributors
+ *
+ * This file is part of Omophagic Content Reader.
+ *
+ * Omophagic Content Reader is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Omophagic Content Reader is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Omophagic Content Reader.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <limits>
+#include "Moments.h"
+namespace OCR
+{
+
+const unsigned Moments::STATISTICS;
+
+/**
+ * Lists the statistics of a symbol
+ * @param[in]  s          a symbol
+ * @param[out] statistics each statistic, in the order Font::Symbol is written
+ */
+static void unpack(const Font::Symbol & s, double * statistics)
+{
+	statistics[0] = s.holes;
+	statistics[1] = s.proportion;
+	statistics[2] = s.density.total;
+	statistics[3] = s.density.border;
+	statistics[4] = s.density.q1;
+	statistics[5] = s.density.q2;
+	statistics[6] = s.density.q3;
+	statistics[7] = s.density.q4;
+	statistics[8] = s.density.mid1;
+	statistics[9] = s.density.mid2;
+}
+
+/**
+ * Initializes the moments of no samples
+ */
+Moments::Moments() :
+	n(0)
+{
+	for (unsigned i = 0; i < STATISTICS; ++i)
+		means[i] = m2[i] = 0;
+}
+
+/**
+ * Initializes the moments of samples summarized earlier,
+ * to which more can be added
+ * @param n        number of samples
+ * @param mean     mean of each statistic
+ * @param variance sample variance of each statistic, in the order
+ *                 Font::Symbol is written
+ */
+Moments::Moments(unsigned n, const Font::Symbol & mean,
+        const double * variance) :
+	n(n)
+{
+	unpack(mean, means);
+	for (unsigned i = 0; i < STATISTICS; ++i)
+		m2[i] = n > 1 ? variance[i] * (n - 1) : 0;
+}
+
+/**
+ * Initializes the moments of samples summarized earlier exactly,
+ * as written by operator<<, to which more can be added
+ * @param n       number of samples
+ * @param mean    mean of each statistic, holes not rounded, in the
+ *                order Font::Symbol is written
+ * @param squares sum of squared differences from the mean of each
+ *                statistic, in the same order
+ */
+Moments::Moments(unsigned n, const double * mean, const double * squares) :
+	n(n)
+{
+	for (unsigned i = 0; i < STATISTICS; ++i)
+	{
+		means[i] = mean[i];
+		m2[i] = squares[i];
+	}
+}
+
+/**
+ * Adds a sample
+ * @param s statistics of a sample
+ */
+void Moments::add(const Font::Symbol & s)
+{
+	double statistics[STATISTICS];
+	unpack(s, statistics);
+	++n;
+	for (unsigned i = 0; i < STATISTICS; ++i)
+	{
+		const double delta = statistics[i] - means[i];
+		means[i] += delta / n;
+		m2[i] += delta * (statistics[i] - means[i]);
+	}
+}
+
+/**
+ * Get the mean of the samples
+ * @return the mean of each statistic, with holes rounded to the
+ *         nearest whole number
+ */
+Font::Symbol Moments::mean() const
+{
+	Font::Symbol s;
+	s.holes = means[0] + 0.5;
+	s.proportion = means[1];
+	s.density.total = means[2];
+	s.density.border = means[3];
+	s.density.q1 = means[4];
+	s.density.q2 = means[5];
+	s.density.q3 = means[6];
+	s.density.q4 = means[7];
+	s.density.mid1 = means[8];
+	s.density.mid2 = means[9];
+	return s;
+}
+
+/**
+ * Writes the mean of each statistic, holes not rounded, after the tag
+ * "m", the variance of each after the tag "v", then the sum of squared
+ * differences from the mean of each after the tag "s", in the order
+ * Font::Symbol is written, with every digit needed to read them back
+ * unchanged
+ * @param outs output stream
+ * @param m    moments
+ * @return output stream
+ */
+std::ostream & operator<<(std::ostream & outs, const Moments & m)
+{
+	const std::streamsize precision = outs.precision(
+	        std::numeric_limits<double>::max_digits10);
+	outs << 'm';
+	for (unsigned i = 0; i < Moments::STATISTICS; ++i)
+		outs << ' ' << m.means[i];
+	outs << " v";
+	for (unsigned i = 0; i < Moments::STATISTICS; ++i)
+		outs << ' ' << m.variance(i);
+	// The variance alone loses the last digits of the sums, which more
+	// samples are added to
+	outs << " s";
+	for (unsigned i = 0; i < Moments::STATISTICS; ++i)
+		outs << ' ' << m.m2[i];
+	outs.precision(precision);
+	return outs;
+}
+
+} // namespace OCR
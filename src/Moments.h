@@ -0,0 +1,128 @@
+/**
+ * @file Moments.h
+ * @date October 2026
+ * @author Omophagic Content Reader contributors
+ * @brief The interface and documentation of the Moments class.
+ * @see Moments.cpp for the implementation.
+ * @version $Id$
+ */
+/*
+ * Copyright 2026 Omophagic Content Reader contributors
+ *
+ * This file is part of Omophagic Content Reader.
+ *
+ * Omophagic Content Reader is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Omophagic Content Reader is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Omophagic Content Reader.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef OCR_MOMENTS_H_
+#define OCR_MOMENTS_H_
+#include <iostream>
+#include "Font.h"
+
+namespace OCR
+{
+
+/**
+ * The running mean and variance of each statistic of Font::Symbol over
+ * samples of a character, updated one sample at a time by Welford's
+ * method, which stays accurate however many samples there are.
+ */
+class Moments
+{
+public:
+	/// Number of statistics kept, in the order Font::Symbol is written
+	static const unsigned STATISTICS = 10;
+
+	/**
+	 * Initializes the moments of no samples
+	 */
+	Moments();
+
+	/**
+	 * Initializes the moments of samples summarized earlier,
+	 * to which more can be added
+	 * @param n        number of samples
+	 * @param mean     mean of each statistic
+	 * @param variance sample variance of each statistic, in the order
+	 *                 Font::Symbol is written
+	 */
+	Moments(unsigned n, const Font::Symbol & mean, const double * variance);
+
+	/**
+	 * Initializes the moments of samples summarized earlier exactly,
+	 * as written by operator<<, to which more can be added
+	 * @param n       number of samples
+	 * @param mean    mean of each statistic, holes not rounded, in the
+	 *                order Font::Symbol is written
+	 * @param squares sum of squared differences from the mean of each
+	 *                statistic, in the same order
+	 */
+	Moments(unsigned n, const double * mean, const double * squares);
+
+	/**
+	 * Adds a sample
+	 * @param s statistics of a sample
+	 */
+	void add(const Font::Symbol & s);
+
+	/**
+	 * Get the number of samples added
+	 * @return number of samples
+	 */
+	unsigned count() const
+	{
+		return n;
+	}
+
+	/**
+	 * Get the mean of the samples
+	 * @return the mean of each statistic, with holes rounded to the
+	 *         nearest whole number
+	 */
+	Font::Symbol mean() const;
+
+	/**
+	 * Get the variance of one statistic over the samples
+	 * @param i index of the statistic, in the order Font::Symbol is written
+	 * @return sample variance, or 0 if there are fewer than two samples
+	 */
+	double variance(unsigned i) const
+	{
+		return n > 1 ? m2[i] / (n - 1) : 0;
+	}
+
+	/**
+	 * Writes the mean of each statistic, holes not rounded, after the tag
+	 * "m", the variance of each after the tag "v", then the sum of squared
+	 * differences from the mean of each after the tag "s", in the order
+	 * Font::Symbol is written, with every digit needed to read them back
+	 * unchanged
+	 * @param outs output stream
+	 * @param m    moments
+	 * @return output stream
+	 */
+	friend std::ostream & operator<<(std::ostream & outs, const Moments & m);
+
+private:
+	/// Number of samples
+	unsigned n;
+	/// Mean of each statistic
+	double means[STATISTICS];
+	/// Sum of squared differences from the mean of each statistic
+	double m2[STATISTICS];
+};
+
+} // namespace OCR
+
+#endif /*OCR_MOMENTS_H_*/
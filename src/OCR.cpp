@@ -27,6 +27,7 @@
  */
 
 #include "OCR.h"
+#include "Profile.h"
 
 namespace OCR
 {
@@ -49,10 +50,14 @@ Box floodFill(BMP & image, const Point start, bool bg, bool ** visited,
 	// Initialize queue and box
 	std::queue<Point> pointsToVisit;
 	Box extentOfContiguousPixelsFound(start.x, start.y, start.x, start.y);
+	unsigned long long pushes = 0;
 
 	// Add the starting pixel to the queue, if it has not been visited
 	if (!visited[start.x - limit.low.x][start.y - limit.low.y])
+	{
 		pointsToVisit.push(start);
+		++pushes;
+	}
 
 	while (!pointsToVisit.empty())
 	{
@@ -79,10 +84,12 @@ Box floodFill(BMP & image, const Point start, bool bg, bool ** visited,
 					pointsToVisit.push(neighbor);
 					visited[neighbor.x - limit.low.x][neighbor.y - limit.low.y]
 							= true;
+					++pushes;
 				}
 			}
 		}
 	}
+	OCR_PROFILE_COUNT(PUSHES, pushes);
 	return extentOfContiguousPixelsFound;
 }
 
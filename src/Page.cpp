@@ -26,10 +26,14 @@
  * If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include <algorithm>
 #include "Page.h"
+#include "Profile.h"
 namespace OCR
 {
 
+const unsigned Page::SAMPLES_PER_LINE;
+
 /**
  * Initializes the class
  * @param img BMP image to use
@@ -59,43 +63,150 @@ Page & Page::operator =(const Page & other)
 	return *this;
 }
 
+/**
+ * Get the confidence in each line from the last Read
+ * @return mean confidence of the characters of each line, from 0 to 1
+ */
+std::vector<double> Page::lineConfidence() const
+{
+	std::vector<double> result;
+	for (std::deque<Line>::const_iterator i = lines.begin(); i
+	        != lines.end(); ++i)
+		result.push_back(i->lineConfidence());
+	return result;
+}
+
+/**
+ * Determines whether a row of an image has any foreground pixels
+ * @param image BMP image
+ * @param row   row of the image
+ * @return whether any pixel in the row is foreground
+ */
+static bool rowHasForeground(BMP & image, int row)
+{
+	for (int col = 0; col < image.TellWidth(); ++col)
+		if (isForeground(image(col, row)))
+		{
+			OCR_PROFILE_COUNT(PIXELS, col + 1);
+			return true;
+		}
+	OCR_PROFILE_COUNT(PIXELS, image.TellWidth());
+	return false;
+}
+
+/**
+ * Determines whether a column of part of an image has any foreground pixels
+ * @param image BMP image
+ * @param col   column of the image
+ * @param area  the part of the image
+ * @return whether any pixel of the column within the part is foreground
+ */
+static bool columnHasForeground(BMP & image, int col, const Box & area)
+{
+	for (int row = area.low.y; row <= (int) area.high.y; ++row)
+		if (isForeground(image(col, row)))
+			return true;
+	return false;
+}
+
+/**
+ * Finds the next line of text in an image
+ * @param[in]  image BMP image
+ * @param[in]  start first row to search
+ * @param[out] area  the part of the image holding the line, if found
+ * @return whether a line was found
+ */
+static bool findLine(BMP & image, int start, Box & area)
+{
+	int row = start;
+	while (row < image.TellHeight() && !rowHasForeground(image, row))
+		++row;
+	const int top = row;
+	while (row < image.TellHeight() && rowHasForeground(image, row))
+		++row;
+	// A line touching the bottom of the image is never finished
+	if (row >= image.TellHeight())
+		return false;
+	area = Box(0, top, image.TellWidth() - 1, row - 1);
+	return true;
+}
+
+/**
+ * Finds the lines of text in an image
+ * @param image BMP image
+ * @return the part of the image holding each line, top to bottom
+ */
+std::vector<Box> Page::findLines(BMP & image)
+{
+	OCR_PROFILE_TIME(ROWS);
+	std::vector<Box> rows;
+	Box area;
+	for (int row = 0; findLine(image, row, area); row = area.high.y + 1)
+		rows.push_back(area);
+	return rows;
+}
+
+/**
+ * Extracts information on a few characters spread over an image,
+ * without reading them
+ * @param img      BMP image
+ * @param count    number of characters to sample, if there are that many
+ * @param features where to add the characters, with the Optional
+ *                 information it asks for
+ */
+void Page::sample(BMP & img, unsigned count, FeatureBatch & features)
+{
+	// Take a few characters from the start of each of the first few lines,
+	// so that only the rows down to those lines are examined and only
+	// the start of each line is binarized
+	Box area;
+	for (int row = 0; count && findLine(img, row, area); row = area.high.y
+	        + 1)
+	{
+		int left = 0;
+		while (left < img.TellWidth() && !columnHasForeground(img, left, area))
+			++left;
+		if (left >= img.TellWidth())
+			continue;
+
+		// Allow two line heights for each character
+		const unsigned wanted = std::min(count, SAMPLES_PER_LINE);
+		const Box window(left, area.low.y, std::min(left + 2 * (int) wanted
+		        * area.height(), (int) area.high.x), area.high.y);
+		BinaryImage line(img, window);
+		std::vector<Box> chosen = Line::split(line, window);
+		if (chosen.size() > wanted)
+			chosen.resize(wanted);
+		FeatureBatch batch(features.extracted(), features.zoneGrid());
+		batch.extract(line, chosen);
+		features.append(batch);
+		count -= chosen.size();
+	}
+}
+
 /**
  * Processes the image.
+ * @param symData   optionally store symbol data in a vector
+ * @param features optionally add all information extracted on each
+ *                 symbol, including the Optional information it asks for
  * @return text of the image.
  */
-std::string Page::Read()
+std::string Page::Read(std::vector<Font::Symbol> * symData,
+        FeatureBatch * features)
 {
+	OCR_PROFILE_TIME(PAGE);
 	result = "";
 	lines.clear();
-	// Divide into lines
-	int top = 0, bottom = 0; // of the current line of text
-	bool inRow = false; // Whether in a row
-
-	for (int row = 0; row < image.TellHeight(); ++row)
+	std::vector<Box> rows = findLines(image);
+	OCR_PROFILE_COUNT(LINES, rows.size());
+	for (unsigned i = 0; i < rows.size(); ++i)
+		lines.push_back(Line(image, rows[i].low.y, rows[i].high.y, font));
+	// Read each line and concatenate results
+	for (unsigned i = 0; i < lines.size(); ++i)
 	{
-		// Search for a foreground pixel in this row
-		bool fgFound = false;
-		for (int col = 0; col < image.TellWidth() && !fgFound; ++col)
-			if (isForeground(image(col, row)))
-				fgFound = true;
-
-		if (fgFound && !inRow)
-		// Starting a new row
-		{
-			top = row;
-			inRow = true;
-		}
-		else if (!fgFound && inRow)
-		// End of a row
-		{
-			bottom = row - 1;
-			lines.push_back(Line(image, top, bottom, font));
-			inRow = false;
-		}
+		OCR_PROFILE_LINE(i);
+		result += lines[i].Read(symData, features) + '\n';
 	}
-	// Read each line and concatenate results
-	for (std::deque<Line>::iterator i = lines.begin(); i != lines.end(); ++i)
-		result += i->Read() + '\n';
 	return result;
 }
 
@@ -30,6 +30,7 @@
 #define OCR_PAGE_H_
 #include <deque>
 #include <string>
+#include <vector>
 #include "EasyBMP/EasyBMP.h"
 #include "Line.h"
 
@@ -59,11 +60,50 @@ public:
 
 	/**
 	 * Processes the image.
+	 * @param symData   optionally store symbol data in a vector
+	 * @param features optionally add all information extracted on each
+	 *                 symbol, including the Optional information it asks for
 	 * @return text of the image.
 	 */
-	std::string Read();
+	std::string Read(std::vector<Font::Symbol> * symData = NULL,
+	        FeatureBatch * features = NULL);
+
+	/**
+	 * Extracts information on a few characters spread over an image,
+	 * without reading them
+	 * @param img      BMP image
+	 * @param count    number of characters to sample, if there are that many
+	 * @param features where to add the characters, with the Optional
+	 *                 information it asks for
+	 */
+	static void sample(BMP & img, unsigned count, FeatureBatch & features);
+
+	/**
+	 * Finds the lines of text in an image
+	 * @param image BMP image
+	 * @return the part of the image holding each line, top to bottom
+	 */
+	static std::vector<Box> findLines(BMP & image);
+
+	/**
+	 * Get the confidence in each line from the last Read
+	 * @return mean confidence of the characters of each line, from 0 to 1
+	 */
+	std::vector<double> lineConfidence() const;
+
+	/**
+	 * Get the lines from the last Read,
+	 * including the confidence in each of their characters
+	 * @return lines of text, top to bottom
+	 */
+	const std::deque<Line> & textLines() const
+	{
+		return lines;
+	}
 
 private:
+	/// Most characters to sample from each line
+	static const unsigned SAMPLES_PER_LINE = 16;
 	/// the image
 	BMP & image;
 	/// the lines of text
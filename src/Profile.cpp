@@ -0,0 +1,615 @@
+/**
+ * @file Profile.cpp
+ * @date October 2026
+ * @author Omophagic Content Reader contributors
+ * @brief The implementation of the Profile class.
+ * @see Profile.h for the interface and documentation.
+ * @version $Id$
+ */
+/*
+ * Copyright 2026 Omophagic Content Reader contributors
+ *
+ * This file is part of Omophagic Content Reader.
+ *
+ * Omophagic Content Reader is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Omophagic Content Reader is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Omophagic Content Reader.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <cstdlib>
+#include <cstring>
+#include <cerrno>
+#include <new>
+#include <iomanip>
+#ifdef __linux__
+#include <unistd.h>
+#include <sys/syscall.h>
+#include <linux/perf_event.h>
+#endif
+#include "Profile.h"
+namespace OCR
+{
+
+/// Number of threads that have recorded an event
+static std::atomic<unsigned> threads(0);
+/// Number of the calling thread in the trace, or 0 until it records one
+static thread_local unsigned threadNumber = 0;
+
+#ifdef __linux__
+/**
+ * The hardware counters of one thread, counting from when first read
+ * until the thread exits
+ */
+class HardwareCounters
+{
+public:
+	/**
+	 * Initializes without opening any counters
+	 */
+	HardwareCounters() :
+		opened(false), error(0)
+	{
+	}
+
+	/**
+	 * Closes the counters
+	 */
+	~HardwareCounters()
+	{
+		for (unsigned i = 0; i < files.size(); ++i)
+			close(files[i]);
+	}
+
+	/**
+	 * Opens as many counters as the system allows, as one group so that
+	 * they are all counting at the same time, unless already tried
+	 * @return the error from the first counter that could not be opened,
+	 *         or 0 if all could be
+	 */
+	int open()
+	{
+		if (opened)
+			return error;
+		opened = true;
+		static const unsigned long long CONFIGS[Profile::HARDWARE_EVENTS] =
+		{ PERF_COUNT_HW_CPU_CYCLES, PERF_COUNT_HW_INSTRUCTIONS,
+		        PERF_COUNT_HW_CACHE_MISSES, PERF_COUNT_HW_BRANCH_MISSES };
+		for (unsigned e = 0; e < Profile::HARDWARE_EVENTS; ++e)
+		{
+			perf_event_attr attr;
+			std::memset(&attr, 0, sizeof(attr));
+			attr.size = sizeof(attr);
+			attr.type = PERF_TYPE_HARDWARE;
+			attr.config = CONFIGS[e];
+			attr.exclude_kernel = 1;
+			attr.exclude_hv = 1;
+			attr.read_format = PERF_FORMAT_GROUP
+			        | PERF_FORMAT_TOTAL_TIME_ENABLED
+			        | PERF_FORMAT_TOTAL_TIME_RUNNING;
+			// This thread, on any processor; the first opened leads
+			int file = syscall(SYS_perf_event_open, &attr, 0, -1,
+			        files.empty() ? -1 : files.front(), 0);
+			if (file < 0)
+			{
+				if (!error)
+					error = errno;
+				continue;
+			}
+			files.push_back(file);
+			events.push_back((Profile::Hardware) e);
+		}
+		return error;
+	}
+
+	/**
+	 * Reads the counters that could be opened
+	 * @param[out] values each Hardware event so far, scaled up for any
+	 *                    time the group was not counting, 0 if not opened
+	 * @return which Hardware events were read, as bits
+	 */
+	unsigned read(unsigned long long values[Profile::HARDWARE_EVENTS])
+	{
+		for (unsigned e = 0; e < Profile::HARDWARE_EVENTS; ++e)
+			values[e] = 0;
+		// Number of values, time enabled, time running, then each value
+		unsigned long long buffer[3 + Profile::HARDWARE_EVENTS];
+		if (files.empty() || ::read(files.front(), buffer, sizeof(buffer))
+		        < (ssize_t) (3 + events.size()) * 8)
+			return 0;
+		const double scale = buffer[2] && buffer[2] < buffer[1] ? buffer[1]
+		        / (double) buffer[2] : 1;
+		unsigned counted = 0;
+		for (unsigned i = 0; i < events.size() && i < buffer[0]; ++i)
+		{
+			values[events[i]] = buffer[3 + i] * scale;
+			counted |= 1 << events[i];
+		}
+		return counted;
+	}
+
+private:
+	/// Whether opening was tried
+	bool opened;
+	/// The error from the first counter that could not be opened, or 0
+	int error;
+	/// Each counter opened, the group leader first
+	std::vector<int> files;
+	/// The Hardware event each counts
+	std::vector<Profile::Hardware> events;
+};
+
+/// Hardware counters of the calling thread
+static thread_local HardwareCounters hardwareCounters;
+#endif
+
+const char * const Profile::STAGE_NAMES[STAGES] =
+{ "decode", "page", "rows", "line", "binarize", "split", "extract", "holes",
+        "match", "grapheme" };
+const char * const Profile::COUNTER_NAMES[COUNTERS] =
+{ "pixels visited", "flood-fill pushes", "lines", "glyphs", "allocations",
+        "bytes allocated" };
+const char * const Profile::HARDWARE_NAMES[HARDWARE_EVENTS] =
+{ "cycles", "instructions", "cache misses", "branch misses" };
+
+std::atomic<unsigned> Profile::mode(0);
+thread_local int Profile::lineIndex = -1;
+thread_local int Profile::glyphIndex = -1;
+std::atomic<unsigned long long> Profile::entered[STAGES];
+std::atomic<unsigned long long> Profile::nanoseconds[STAGES];
+std::atomic<unsigned long long> Profile::counts[COUNTERS];
+std::atomic<unsigned long long> Profile::hardware[STAGES][HARDWARE_EVENTS];
+std::atomic<unsigned> Profile::hardwareCounted(0);
+std::atomic<int> Profile::hardwareError(0);
+std::vector<Profile::Event> Profile::events;
+std::chrono::steady_clock::time_point Profile::traceStart;
+std::mutex Profile::traceLock;
+
+/**
+ * Adds time spent in a Stage
+ * @param stage the Stage
+ * @param start when the Stage was entered
+ * @param end   when the Stage was left
+ */
+void Profile::add(Stage stage, std::chrono::steady_clock::time_point start,
+        std::chrono::steady_clock::time_point end)
+{
+	entered[stage].fetch_add(1, std::memory_order_relaxed);
+	nanoseconds[stage].fetch_add(std::chrono::duration_cast<
+	        std::chrono::nanoseconds>(end - start).count(),
+	        std::memory_order_relaxed);
+	if (!tracing())
+		return;
+
+	if (!threadNumber)
+		threadNumber = ++threads;
+	Event event;
+	event.stage = stage;
+	event.thread = threadNumber;
+	event.line = lineIndex;
+	event.glyph = glyphIndex;
+	std::lock_guard<std::mutex> guard(traceLock);
+	event.begin = std::chrono::duration<double, std::micro>(start
+	        - traceStart).count();
+	event.end = std::chrono::duration<double, std::micro>(end
+	        - traceStart).count();
+	events.push_back(event);
+}
+
+/**
+ * Starts or stops recording a trace, which also records totals.
+ * Starting empties any trace recorded before.
+ * @param on whether to trace
+ */
+void Profile::trace(bool on)
+{
+	if (on)
+	{
+		std::lock_guard<std::mutex> guard(traceLock);
+		events.clear();
+		traceStart = std::chrono::steady_clock::now();
+	}
+	setMode(TRACE, on);
+}
+
+/**
+ * Reads the Hardware events counted on the calling thread so far,
+ * starting to count them the first time
+ * @param[out] values each Hardware event, 0 for those not counted
+ * @return whether counting, and any could be counted
+ */
+bool Profile::readHardware(unsigned long long values[HARDWARE_EVENTS])
+{
+	if (!(mode.load(std::memory_order_relaxed) & HARDWARE))
+		return false;
+#ifdef __linux__
+	int expected = 0;
+	if (int error = hardwareCounters.open())
+		hardwareError.compare_exchange_strong(expected, error);
+	unsigned counted = hardwareCounters.read(values);
+	hardwareCounted.fetch_or(counted, std::memory_order_relaxed);
+	return counted != 0;
+#else
+	int expected = 0;
+	hardwareError.compare_exchange_strong(expected, ENOSYS);
+	return false;
+#endif
+}
+
+/**
+ * Adds Hardware events counted on the calling thread to a Stage
+ * @param stage the Stage
+ * @param start the events counted when the Stage was entered,
+ *              as from readHardware
+ */
+void Profile::addHardware(Stage stage,
+        const unsigned long long start[HARDWARE_EVENTS])
+{
+	unsigned long long now[HARDWARE_EVENTS];
+	if (!readHardware(now))
+		return;
+	for (unsigned e = 0; e < HARDWARE_EVENTS; ++e)
+		if (now[e] > start[e])
+			hardware[stage][e].fetch_add(now[e] - start[e],
+			        std::memory_order_relaxed);
+}
+
+/**
+ * Get the totals so far
+ * @return time in each Stage and every Counter
+ */
+Profile::Totals Profile::totals()
+{
+	Totals result;
+	for (unsigned s = 0; s < STAGES; ++s)
+	{
+		result.calls[s] = entered[s].load(std::memory_order_relaxed);
+		result.seconds[s] = nanoseconds[s].load(std::memory_order_relaxed)
+		        / 1e9;
+	}
+	for (unsigned c = 0; c < COUNTERS; ++c)
+		result.counters.push_back(std::make_pair(COUNTER_NAMES[c],
+		        counts[c].load(std::memory_order_relaxed)));
+	result.hardwareAsked = mode.load(std::memory_order_relaxed) & HARDWARE;
+	result.hardwareCounted = hardwareCounted.load(std::memory_order_relaxed);
+	const int error = hardwareError.load(std::memory_order_relaxed);
+	if (error == ENOENT || error == EOPNOTSUPP || error == ENODEV)
+		result.hardwareError = "not supported by this processor or virtual"
+		        " machine";
+	else if (error == EACCES || error == EPERM)
+		result.hardwareError = "not permitted, see "
+		        "/proc/sys/kernel/perf_event_paranoid";
+	else if (error == ENOSYS)
+		result.hardwareError = "not supported on this system";
+	else if (error)
+		result.hardwareError = std::strerror(error);
+	for (unsigned s = 0; s < STAGES; ++s)
+		for (unsigned e = 0; e < HARDWARE_EVENTS; ++e)
+			result.hardware[s][e] = hardware[s][e].load(
+			        std::memory_order_relaxed);
+	return result;
+}
+
+/**
+ * Sets every total back to zero
+ */
+void Profile::clear()
+{
+	for (unsigned s = 0; s < STAGES; ++s)
+	{
+		entered[s] = 0;
+		nanoseconds[s] = 0;
+	}
+	for (unsigned c = 0; c < COUNTERS; ++c)
+		counts[c] = 0;
+	for (unsigned s = 0; s < STAGES; ++s)
+		for (unsigned e = 0; e < HARDWARE_EVENTS; ++e)
+			hardware[s][e] = 0;
+}
+
+/**
+ * Writes totals as JSON
+ * @param outs   output stream
+ * @param totals totals to write
+ */
+void Profile::writeJSON(std::ostream & outs, const Totals & totals)
+{
+	outs << "{\n  \"stages\": {";
+	for (unsigned s = 0; s < STAGES; ++s)
+		outs << (s ? "," : "") << "\n    \"" << STAGE_NAMES[s]
+		        << "\": { \"calls\": " << totals.calls[s] << ", \"ms\": "
+		        << totals.seconds[s] * 1000 << " }";
+	outs << "\n  },\n  \"counters\": {";
+	for (unsigned c = 0; c < totals.counters.size(); ++c)
+		outs << (c ? "," : "") << "\n    \"" << totals.counters[c].first
+		        << "\": " << totals.counters[c].second;
+	outs << "\n  }";
+
+	// Only the events counted, of only the stages entered
+	if (totals.hardwareAsked)
+	{
+		outs << ",\n  \"hardware\": {\n    \"error\": ";
+		if (totals.hardwareError.empty())
+			outs << "null";
+		else
+			outs << '"' << totals.hardwareError << '"';
+		outs << ",\n    \"stages\": {";
+		bool first = true;
+		for (unsigned s = 0; s < STAGES; ++s)
+		{
+			if (!totals.calls[s] || !totals.hardwareCounted)
+				continue;
+			outs << (first ? "" : ",") << "\n      \"" << STAGE_NAMES[s]
+			        << "\": {";
+			first = false;
+			bool firstEvent = true;
+			for (unsigned e = 0; e < HARDWARE_EVENTS; ++e)
+				if (totals.hardwareCounted & (1 << e))
+				{
+					outs << (firstEvent ? " " : ", ") << '"'
+					        << HARDWARE_NAMES[e] << "\": "
+					        << totals.hardware[s][e];
+					firstEvent = false;
+				}
+			outs << " }";
+		}
+		outs << (first ? "}" : "\n    }") << "\n  }";
+	}
+	outs << "\n}\n";
+}
+
+/**
+ * Writes the trace recorded so far in the Chrome trace event format,
+ * which chrome://tracing and Perfetto display as a timeline
+ * @param outs output stream
+ */
+void Profile::writeTrace(std::ostream & outs)
+{
+	std::lock_guard<std::mutex> guard(traceLock);
+	std::ios::fmtflags flags = outs.flags();
+	std::streamsize precision = outs.precision();
+	outs << std::fixed << std::setprecision(3) << "{\"traceEvents\":[";
+	unsigned most = 0;
+	for (unsigned i = 0; i < events.size(); ++i)
+	{
+		const Event & e = events[i];
+		outs << (i ? "," : "") << "\n{\"name\":\"" << STAGE_NAMES[e.stage]
+		        << "\",\"cat\":\"ocr\",\"ph\":\"X\",\"pid\":1,\"tid\":"
+		        << e.thread << ",\"ts\":" << e.begin << ",\"dur\":" << e.end
+		        - e.begin << ",\"args\":{";
+		if (e.line >= 0)
+			outs << "\"line\":" << e.line << (e.glyph >= 0 ? "," : "");
+		if (e.glyph >= 0)
+			outs << "\"glyph\":" << e.glyph;
+		outs << "}}";
+		if (e.thread > most)
+			most = e.thread;
+	}
+	// Name each thread, so that viewers list them in order
+	for (unsigned t = 1; t <= most; ++t)
+		outs << (events.empty() ? "" : ",") << "\n{\"name\":\"thread_name\","
+		        << "\"ph\":\"M\",\"pid\":1,\"tid\":" << t
+		        << ",\"args\":{\"name\":\"thread " << t << "\"}}";
+	outs << "\n],\"displayTimeUnit\":\"ms\"}\n";
+	outs.flags(flags);
+	outs.precision(precision);
+}
+
+/**
+ * Writes totals as a table, one row per Stage then per counter
+ * @param outs   output stream
+ * @param totals totals to write
+ * @return output stream
+ */
+std::ostream & operator<<(std::ostream & outs, const Profile::Totals & totals)
+{
+	std::ios::fmtflags flags = outs.flags();
+	std::streamsize precision = outs.precision();
+	outs << std::left << std::setw(20) << "stage" << std::right
+	        << std::setw(10) << "calls" << std::setw(12) << "total ms"
+	        << std::setw(12) << "mean us" << '\n' << std::fixed;
+	for (unsigned s = 0; s < Profile::STAGES; ++s)
+		outs << std::left << std::setw(20) << Profile::STAGE_NAMES[s]
+		        << std::right << std::setw(10) << totals.calls[s]
+		        << std::setprecision(3) << std::setw(12) << totals.seconds[s]
+		        * 1000 << std::setprecision(2) << std::setw(12)
+		        << (totals.calls[s] ? totals.seconds[s] * 1e6
+		                / totals.calls[s] : 0) << '\n';
+	outs << '\n' << std::left << std::setw(20) << "counter" << std::right
+	        << std::setw(22) << "total" << '\n';
+	for (unsigned c = 0; c < totals.counters.size(); ++c)
+		outs << std::left << std::setw(20) << totals.counters[c].first
+		        << std::right << std::setw(22) << totals.counters[c].second
+		        << '\n';
+
+	// Hardware events of each stage entered, and instructions per cycle
+	if (totals.hardwareAsked && !totals.hardwareCounted)
+		outs << "\nhardware counters unavailable: " << totals.hardwareError
+		        << '\n';
+	else if (totals.hardwareAsked)
+	{
+		outs << '\n' << std::left << std::setw(20) << "stage" << std::right;
+		for (unsigned e = 0; e < Profile::HARDWARE_EVENTS; ++e)
+			outs << std::setw(15) << Profile::HARDWARE_NAMES[e];
+		outs << std::setw(8) << "IPC" << '\n';
+		for (unsigned s = 0; s < Profile::STAGES; ++s)
+		{
+			if (!totals.calls[s])
+				continue;
+			const unsigned long long * events = totals.hardware[s];
+			outs << std::left << std::setw(20) << Profile::STAGE_NAMES[s]
+			        << std::right;
+			for (unsigned e = 0; e < Profile::HARDWARE_EVENTS; ++e)
+				if (totals.hardwareCounted & (1 << e))
+					outs << std::setw(15) << events[e];
+				else
+					outs << std::setw(15) << '-';
+			if (events[Profile::CYCLES] && totals.hardwareCounted & (1
+			        << Profile::INSTRUCTIONS))
+				outs << std::setprecision(2) << std::setw(8)
+				        << events[Profile::INSTRUCTIONS]
+				                / (double) events[Profile::CYCLES];
+			else
+				outs << std::setw(8) << '-';
+			outs << '\n';
+		}
+		if (!totals.hardwareError.empty())
+			outs << "some hardware counters unavailable: "
+			        << totals.hardwareError << '\n';
+	}
+	outs.flags(flags);
+	outs.precision(precision);
+	return outs;
+}
+
+} // namespace OCR
+
+#ifndef OCR_NO_PROFILE
+/**
+ * Allocates memory, counting the allocation if recording
+ * @param size number of bytes
+ * @return the memory
+ */
+void * operator new(std::size_t size)
+{
+	OCR_PROFILE_COUNT(ALLOCATIONS, 1);
+	OCR_PROFILE_COUNT(ALLOCATED, size);
+	for (;;)
+	{
+		if (void * memory = std::malloc(size ? size : 1))
+			return memory;
+		std::new_handler handler = std::get_new_handler();
+		if (!handler)
+			throw std::bad_alloc();
+		handler();
+	}
+}
+
+/**
+ * Allocates memory for an array, counting the allocation if recording
+ * @param size number of bytes
+ * @return the memory
+ */
+void * operator new[](std::size_t size)
+{
+	return operator new(size);
+}
+
+/**
+ * Frees memory from operator new
+ * @param memory the memory
+ */
+void operator delete(void * memory) noexcept
+{
+	std::free(memory);
+}
+
+/**
+ * Frees memory from operator new, of a known size
+ * @param memory the memory
+ */
+void operator delete(void * memory, std::size_t) noexcept
+{
+	std::free(memory);
+}
+
+/**
+ * Frees memory from operator new[]
+ * @param memory the memory
+ */
+void operator delete[](void * memory) noexcept
+{
+	std::free(memory);
+}
+
+/**
+ * Frees memory from operator new[], of a known size
+ * @param memory the memory
+ */
+void operator delete[](void * memory, std::size_t) noexcept
+{
+	std::free(memory);
+}
+
+/**
+ * Allocates aligned memory, counting the allocation if recording
+ * @param size      number of bytes
+ * @param alignment alignment of the memory, a power of two
+ * @return the memory
+ */
+void * operator new(std::size_t size, std::align_val_t alignment)
+{
+	OCR_PROFILE_COUNT(ALLOCATIONS, 1);
+	OCR_PROFILE_COUNT(ALLOCATED, size);
+	const std::size_t align = static_cast<std::size_t> (alignment);
+	// aligned_alloc takes only whole multiples of the alignment
+	const std::size_t rounded = (size ? size + align - 1 : align) / align
+	        * align;
+	for (;;)
+	{
+		if (void * memory = std::aligned_alloc(align, rounded))
+			return memory;
+		std::new_handler handler = std::get_new_handler();
+		if (!handler)
+			throw std::bad_alloc();
+		handler();
+	}
+}
+
+/**
+ * Allocates aligned memory for an array, counting the allocation if
+ * recording
+ * @param size      number of bytes
+ * @param alignment alignment of the memory, a power of two
+ * @return the memory
+ */
+void * operator new[](std::size_t size, std::align_val_t alignment)
+{
+	return operator new(size, alignment);
+}
+
+/**
+ * Frees memory from aligned operator new
+ * @param memory the memory
+ */
+void operator delete(void * memory, std::align_val_t) noexcept
+{
+	std::free(memory);
+}
+
+/**
+ * Frees memory from aligned operator new, of a known size
+ * @param memory the memory
+ */
+void operator delete(void * memory, std::size_t, std::align_val_t) noexcept
+{
+	std::free(memory);
+}
+
+/**
+ * Frees memory from aligned operator new[]
+ * @param memory the memory
+ */
+void operator delete[](void * memory, std::align_val_t) noexcept
+{
+	std::free(memory);
+}
+
+/**
+ * Frees memory from aligned operator new[], of a known size
+ * @param memory the memory
+ */
+void operator delete[](void * memory, std::size_t, std::align_val_t) noexcept
+{
+	std::free(memory);
+}
+#endif
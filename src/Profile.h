@@ -0,0 +1,456 @@
+/**
+ * @file Profile.h
+ * @date October 2026
+ * @author Omophagic Content Reader contributors
+ * @brief The interface and documentation of the Profile class.
+ * @see Profile.cpp for the implementation.
+ * @version $Id$
+ */
+/*
+ * Copyright 2026 Omophagic Content Reader contributors
+ *
+ * This file is part of Omophagic Content Reader.
+ *
+ * Omophagic Content Reader is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Omophagic Content Reader is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Omophagic Content Reader.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef OCR_PROFILE_H_
+#define OCR_PROFILE_H_
+#include <string>
+#include <vector>
+#include <iostream>
+#include <atomic>
+#include <mutex>
+#include <chrono>
+
+namespace OCR
+{
+
+/**
+ * The time and work spent reading, by stage, summed over every thread,
+ * and optionally the hardware events counted by the processor in each
+ * stage and a trace of each time a stage was entered.
+ *
+ * Nothing is recorded until enabled, and then only where the OCR_PROFILE
+ * macros below are placed, so a program that never enables it pays one
+ * relaxed atomic load and untaken branch at each, and writes nothing.
+ * Building with OCR_NO_PROFILE defined removes even that. Stages nest:
+ * a page includes its lines, and a line the stages of reading it, so
+ * their times overlap.
+ */
+class Profile
+{
+public:
+	/**
+	 * A part of reading that is timed
+	 */
+	enum Stage
+	{
+		/// Decoding the image file
+		DECODE,
+		/// Page::Read, everything but decoding
+		PAGE,
+		/// Finding the rows holding lines of text
+		ROWS,
+		/// Line::Read
+		LINE,
+		/// Copying part of an image to a BinaryImage
+		BINARIZE,
+		/// Dividing a line into symbols
+		SPLIT,
+		/// Extracting the statistics of symbols
+		EXTRACT,
+		/// Counting holes, by flood fills
+		HOLES,
+		/// Comparing a symbol to those of the font
+		MATCH,
+		/// Extracting the statistics of one symbol, or finding them cached
+		GRAPHEME,
+		/// Number of stages
+		STAGES
+	};
+
+	/**
+	 * An amount of work that is counted
+	 */
+	enum Counter
+	{
+		/// Pixels of the image examined or copied
+		PIXELS,
+		/// Pixels queued by flood fills
+		PUSHES,
+		/// Lines of text found
+		LINES,
+		/// Symbols found on those lines
+		GLYPHS,
+		/// Calls to operator new
+		ALLOCATIONS,
+		/// Bytes asked of operator new
+		ALLOCATED,
+		/// Number of counters
+		COUNTERS
+	};
+
+	/**
+	 * An event counted by the processor
+	 */
+	enum Hardware
+	{
+		/// Clock cycles
+		CYCLES,
+		/// Instructions completed
+		INSTRUCTIONS,
+		/// Accesses that missed the last level of cache
+		CACHE_MISSES,
+		/// Mispredicted branches
+		BRANCH_MISSES,
+		/// Number of events
+		HARDWARE_EVENTS
+	};
+
+	/// Name of each Stage, as written
+	static const char * const STAGE_NAMES[STAGES];
+	/// Name of each Counter, as written
+	static const char * const COUNTER_NAMES[COUNTERS];
+	/// Name of each Hardware event, as written
+	static const char * const HARDWARE_NAMES[HARDWARE_EVENTS];
+
+	/**
+	 * Totals so far
+	 */
+	struct Totals
+	{
+		/// Number of times each Stage was entered
+		unsigned long long calls[STAGES];
+		/// Seconds spent in each Stage
+		double seconds[STAGES];
+		/// Each Counter, and any others added by name
+		std::vector<std::pair<std::string, unsigned long long> > counters;
+		/// Whether Hardware events were to be counted
+		bool hardwareAsked;
+		/// Which Hardware events could be counted, as bits by Hardware
+		unsigned hardwareCounted;
+		/// Why some could not be, if any could not
+		std::string hardwareError;
+		/// Each Hardware event during each Stage
+		unsigned long long hardware[STAGES][HARDWARE_EVENTS];
+	};
+
+	/**
+	 * Times one Stage, from construction to destruction,
+	 * if recording was enabled when constructed
+	 */
+	class Timer
+	{
+	public:
+		/**
+		 * Starts timing
+		 * @param stage the Stage being entered
+		 */
+		explicit Timer(Stage stage) :
+			stage(stage), timing(enabled()), counting(false)
+		{
+			if (!timing)
+				return;
+			counting = readHardware(startEvents);
+			start = std::chrono::steady_clock::now();
+		}
+
+		/**
+		 * Adds the time and Hardware events since construction
+		 * to the Stage, and to the trace if tracing
+		 */
+		~Timer()
+		{
+			if (!timing)
+				return;
+			add(stage, start, std::chrono::steady_clock::now());
+			if (counting)
+				addHardware(stage, startEvents);
+		}
+
+	private:
+		Timer(const Timer &);
+		Timer & operator=(const Timer &);
+
+		/// The Stage being timed
+		Stage stage;
+		/// Whether recording was enabled at the start
+		bool timing;
+		/// Whether Hardware events were counted at the start
+		bool counting;
+		/// When the Stage was entered
+		std::chrono::steady_clock::time_point start;
+		/// Hardware events counted on this thread when the Stage was entered
+		unsigned long long startEvents[HARDWARE_EVENTS];
+	};
+
+	/**
+	 * Marks the line, or the symbol within its line, that the calling
+	 * thread is reading, from construction to destruction, so that
+	 * traced stages entered meanwhile are tagged with it. Nothing is
+	 * marked unless tracing when constructed.
+	 */
+	class Position
+	{
+	public:
+		/**
+		 * Marks a line or symbol
+		 * @param glyph whether marking a symbol rather than a line
+		 * @param index index of the line in its page,
+		 *              or of the symbol in its line
+		 */
+		Position(bool glyph, int index) :
+			current(NULL), previous(-1)
+		{
+			if (!tracing())
+				return;
+			current = glyph ? &glyphIndex : &lineIndex;
+			previous = *current;
+			*current = index;
+		}
+
+		/**
+		 * Restores the mark from before construction, if marked
+		 */
+		~Position()
+		{
+			if (current)
+				*current = previous;
+		}
+
+	private:
+		Position(const Position &);
+		Position & operator=(const Position &);
+
+		/// The mark changed, or NULL if not tracing
+		int * current;
+		/// Its value before
+		int previous;
+	};
+
+	/**
+	 * Starts or stops recording totals
+	 * @param on whether to record
+	 */
+	static void enable(bool on = true)
+	{
+		setMode(TOTALS, on);
+	}
+
+	/**
+	 * Starts or stops recording a trace, which also records totals.
+	 * Starting empties any trace recorded before.
+	 * @param on whether to trace
+	 */
+	static void trace(bool on = true);
+
+	/**
+	 * Starts or stops counting Hardware events in each Stage, which also
+	 * records totals. The counters are read with perf_event_open, so only
+	 * on Linux, and only where the processor, any virtual machine and
+	 * /proc/sys/kernel/perf_event_paranoid allow it; otherwise nothing
+	 * is counted and the totals say why.
+	 * @param on whether to count
+	 */
+	static void countHardware(bool on = true)
+	{
+		setMode(HARDWARE, on);
+	}
+
+	/**
+	 * Reads the Hardware events counted on the calling thread so far,
+	 * starting to count them the first time
+	 * @param[out] values each Hardware event, 0 for those not counted
+	 * @return whether counting, and any could be counted
+	 */
+	static bool readHardware(unsigned long long values[HARDWARE_EVENTS]);
+
+	/**
+	 * Adds Hardware events counted on the calling thread to a Stage
+	 * @param stage the Stage
+	 * @param start the events counted when the Stage was entered,
+	 *              as from readHardware
+	 */
+	static void addHardware(Stage stage,
+	        const unsigned long long start[HARDWARE_EVENTS]);
+
+	/**
+	 * Determines whether anything is being recorded
+	 * @return whether recording totals or a trace
+	 */
+	static bool enabled()
+	{
+		return mode.load(std::memory_order_relaxed) != 0;
+	}
+
+	/**
+	 * Determines whether a trace is being recorded
+	 * @return whether tracing
+	 */
+	static bool tracing()
+	{
+		return mode.load(std::memory_order_relaxed) & TRACE;
+	}
+
+	/**
+	 * Adds to a Counter, if recording
+	 * @param counter the Counter
+	 * @param amount  amount of work done
+	 */
+	static void count(Counter counter, unsigned long long amount)
+	{
+		if (enabled())
+			counts[counter].fetch_add(amount, std::memory_order_relaxed);
+	}
+
+	/**
+	 * Adds time spent in a Stage
+	 * @param stage the Stage
+	 * @param start when the Stage was entered
+	 * @param end   when the Stage was left
+	 */
+	static void add(Stage stage, std::chrono::steady_clock::time_point start,
+	        std::chrono::steady_clock::time_point end);
+
+	/**
+	 * Get the totals so far
+	 * @return time in each Stage and every Counter
+	 */
+	static Totals totals();
+
+	/**
+	 * Sets every total back to zero
+	 */
+	static void clear();
+
+	/**
+	 * Writes totals as JSON
+	 * @param outs   output stream
+	 * @param totals totals to write
+	 */
+	static void writeJSON(std::ostream & outs, const Totals & totals);
+
+	/**
+	 * Writes the trace recorded so far in the Chrome trace event format,
+	 * which chrome://tracing and Perfetto display as a timeline
+	 * @param outs output stream
+	 */
+	static void writeTrace(std::ostream & outs);
+
+private:
+	/// What is recorded, as bits of mode
+	enum Mode
+	{
+		TOTALS = 1, TRACE = 2, HARDWARE = 4
+	};
+
+	/**
+	 * One time a Stage was entered, for the trace
+	 */
+	struct Event
+	{
+		/// The Stage entered
+		Stage stage;
+		/// Number of the thread that entered it, from 1
+		unsigned thread;
+		/// Line and symbol being read then, or -1 if not known
+		int line, glyph;
+		/// Microseconds from the start of the trace to entering and leaving
+		double begin, end;
+	};
+
+	/**
+	 * Starts or stops recording something
+	 * @param bit what to record
+	 * @param on  whether to record it
+	 */
+	static void setMode(Mode bit, bool on)
+	{
+		if (on)
+			mode.fetch_or(bit, std::memory_order_relaxed);
+		else
+			mode.fetch_and(~bit, std::memory_order_relaxed);
+	}
+
+	/// What is being recorded
+	static std::atomic<unsigned> mode;
+	/// Line and symbol the calling thread is reading, or -1 if not known
+	static thread_local int lineIndex, glyphIndex;
+	/// Times each Stage was entered
+	static std::atomic<unsigned long long> entered[STAGES];
+	/// Nanoseconds spent in each Stage
+	static std::atomic<unsigned long long> nanoseconds[STAGES];
+	/// Each Counter
+	static std::atomic<unsigned long long> counts[COUNTERS];
+	/// Each Hardware event counted during each Stage
+	static std::atomic<unsigned long long> hardware[STAGES][HARDWARE_EVENTS];
+	/// Which Hardware events any thread could count, as bits by Hardware
+	static std::atomic<unsigned> hardwareCounted;
+	/// The error from the first Hardware event that could not be counted
+	static std::atomic<int> hardwareError;
+	/// Every time a Stage was entered since tracing started,
+	/// in order of leaving
+	static std::vector<Event> events;
+	/// When tracing started
+	static std::chrono::steady_clock::time_point traceStart;
+	/// Guards events and traceStart
+	static std::mutex traceLock;
+};
+
+/**
+ * Writes totals as a table, one row per Stage then per counter
+ * @param outs   output stream
+ * @param totals totals to write
+ * @return output stream
+ */
+std::ostream & operator<<(std::ostream & outs, const Profile::Totals & totals);
+
+} // namespace OCR
+
+#ifdef OCR_NO_PROFILE
+#define OCR_PROFILE_TIME(stage)
+#define OCR_PROFILE_COUNT(counter, amount)
+#define OCR_PROFILE_LINE(index)
+#define OCR_PROFILE_GLYPH(index)
+#else
+/**
+ * Times the rest of the enclosing block as a Profile::Stage
+ * @param stage name of the Stage, without Profile::
+ */
+#define OCR_PROFILE_TIME(stage) \
+	OCR::Profile::Timer profileTimer(OCR::Profile::stage)
+/**
+ * Adds to a Profile::Counter
+ * @param counter name of the Counter, without Profile::
+ * @param amount  amount of work done
+ */
+#define OCR_PROFILE_COUNT(counter, amount) \
+	OCR::Profile::count(OCR::Profile::counter, amount)
+/**
+ * Marks the rest of the enclosing block as reading a line
+ * @param index index of the line in its page
+ */
+#define OCR_PROFILE_LINE(index) \
+	OCR::Profile::Position profileLine(false, index)
+/**
+ * Marks the rest of the enclosing block as reading a symbol
+ * @param index index of the symbol in its line
+ */
+#define OCR_PROFILE_GLYPH(index) \
+	OCR::Profile::Position profileGlyph(true, index)
+#endif
+
+#endif /*OCR_PROFILE_H_*/
@@ -0,0 +1,141 @@
+/**
+ * @file QuantizedSymbol.cpp
+ * @date October 2026
+ * @author Omophagic Content Reader contributors
+ * @brief The implementation of the QuantizedSymbol class.
+ * @see QuantizedSymbol.h for the interface and documentation.
+ * @version $Id$
+ */
+/*
+ * Copyright 2026 Omophagic Content Reader contributors
+ *
+ * This file is part of Omophagic Content Reader.
+ *
+ * Omophagic Content Reader is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Omophagic Content Reader is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Omophagic Content Reader.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <string>
+#include <cstdlib>
+#include "QuantizedSymbol.h"
+namespace OCR
+{
+
+const unsigned QuantizedSymbol::SCALE;
+const unsigned QuantizedSymbol::HOLE_WEIGHT;
+const unsigned QuantizedSymbol::LANES;
+
+/**
+ * Initializes all statistics to 0
+ */
+QuantizedSymbol::QuantizedSymbol() :
+	holes(0), unused(0), proportion(0)
+{
+	for (unsigned i = 0; i < LANES; ++i)
+		lanes[i] = 0;
+}
+
+/**
+ * Sets a density
+ * @param f     which density
+ * @param value density, scaled to 0-SCALE
+ */
+void QuantizedSymbol::set(Feature f, unsigned char value)
+{
+	for (unsigned i = 0; i < weight(f); ++i)
+		lanes[lane(f) + i] = value;
+}
+
+/**
+ * Averages several samples of a character
+ * @param samples statistics on the same character
+ * @param weights optionally the number of samples each stands for,
+ *                such as an earlier average of that many
+ * @return statistics with the mean of each, rounded
+ */
+QuantizedSymbol QuantizedSymbol::average(
+        const std::vector<QuantizedSymbol> & samples,
+        const std::vector<unsigned> * weights)
+{
+	QuantizedSymbol result;
+	unsigned long long n = 0, holes = 0, proportion = 0;
+	for (unsigned j = 0; j < samples.size(); ++j)
+	{
+		const unsigned long long w = weights ? (*weights)[j] : 1;
+		n += w;
+		holes += samples[j].holes * w;
+		proportion += samples[j].proportion * w;
+	}
+	if (!n)
+		return result;
+	result.holes = (holes + n / 2) / n;
+	result.proportion = (proportion + n / 2) / n;
+	for (unsigned i = 0; i < LANES; ++i)
+	{
+		unsigned long long sum = 0;
+		for (unsigned j = 0; j < samples.size(); ++j)
+			sum += samples[j].lanes[i] * (weights ? (*weights)[j] : 1ULL);
+		result.lanes[i] = (sum + n / 2) / n;
+	}
+	return result;
+}
+
+/**
+ * Reads statistics from an input stream, as hexadecimal digits:
+ * two for holes, four for proportion, then two for each Feature
+ * @param ins input stream
+ * @param s   statistics
+ * @return input stream
+ */
+std::istream & operator>>(std::istream & ins, QuantizedSymbol & s)
+{
+	std::string digits;
+	if (!(ins >> digits))
+		return ins;
+	if (digits.size() != 6 + 2 * QuantizedSymbol::FEATURES)
+	{
+		ins.setstate(std::ios::failbit);
+		return ins;
+	}
+	s = QuantizedSymbol();
+	s.holes = strtoul(digits.substr(0, 2).c_str(), NULL, 16);
+	s.proportion = strtoul(digits.substr(2, 4).c_str(), NULL, 16);
+	for (unsigned f = 0; f < QuantizedSymbol::FEATURES; ++f)
+		s.set((QuantizedSymbol::Feature) f, strtoul(digits.substr(6 + f * 2,
+		        2).c_str(), NULL, 16));
+	return ins;
+}
+
+/**
+ * Writes statistics to an output stream, as hexadecimal digits:
+ * two for holes, four for proportion, then two for each Feature
+ * @param outs output stream
+ * @param s    statistics
+ * @return output stream
+ */
+std::ostream & operator<<(std::ostream & outs, const QuantizedSymbol & s)
+{
+	const char digits[] = "0123456789abcdef";
+	outs << digits[s.holes >> 4 & 15] << digits[s.holes & 15];
+	for (int shift = 12; shift >= 0; shift -= 4)
+		outs << digits[s.proportion >> shift & 15];
+	for (unsigned f = 0; f < QuantizedSymbol::FEATURES; ++f)
+	{
+		unsigned char value = s.get((QuantizedSymbol::Feature) f);
+		outs << digits[value >> 4] << digits[value & 15];
+	}
+	return outs;
+}
+
+} // namespace OCR
@@ -0,0 +1,182 @@
+/**
+ * @file QuantizedSymbol.h
+ * @date October 2026
+ * @author Omophagic Content Reader contributors
+ * @brief The interface and documentation of the QuantizedSymbol class.
+ * @see QuantizedSymbol.cpp for the implementation.
+ * @version $Id$
+ */
+/*
+ * Copyright 2026 Omophagic Content Reader contributors
+ *
+ * This file is part of Omophagic Content Reader.
+ *
+ * Omophagic Content Reader is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Omophagic Content Reader is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Omophagic Content Reader.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef OCR_QUANTIZEDSYMBOL_H_
+#define OCR_QUANTIZEDSYMBOL_H_
+#include <vector>
+#include <iostream>
+
+namespace OCR
+{
+
+/**
+ * The statistics of Font::Symbol that are used for matching,
+ * stored as small integers instead of doubles.
+ *
+ * Densities and proportion are scaled so that 1 becomes SCALE and rounded.
+ * Each density is stored once per unit of its weight in Symbol::match,
+ * so that the weighted sum of differences is a plain sum of absolute
+ * differences over one 16-byte block.
+ */
+class QuantizedSymbol
+{
+public:
+	/// The stored value of a density or proportion of 1
+	static const unsigned SCALE = 255;
+	/// Score for each difference in holes, on the same scale as densities
+	static const unsigned HOLE_WEIGHT = 10000 * SCALE / 100;
+	/// Number of bytes holding densities
+	static const unsigned LANES = 16;
+
+	/**
+	 * The densities that are compared
+	 */
+	enum Feature
+	{
+		TOTAL, BORDER, Q1, Q2, Q3, Q4, FEATURES
+	};
+
+	/**
+	 * Initializes all statistics to 0
+	 */
+	QuantizedSymbol();
+
+	/**
+	 * Scales a ratio of counts
+	 * @param count numerator, such as foreground pixels
+	 * @param total denominator, such as all pixels
+	 * @return count / total * SCALE, rounded, or 0 if total is 0
+	 */
+	static unsigned ratio(unsigned count, unsigned total)
+	{
+		return total ? (count * SCALE + total / 2) / total : 0;
+	}
+
+	/**
+	 * Get a density
+	 * @param f which density
+	 * @return density, scaled to 0-SCALE
+	 */
+	unsigned char get(Feature f) const
+	{
+		return lanes[lane(f)];
+	}
+
+	/**
+	 * Sets a density
+	 * @param f     which density
+	 * @param value density, scaled to 0-SCALE
+	 */
+	void set(Feature f, unsigned char value);
+
+	/**
+	 * Compares this to another; the same as Font::Symbol::match,
+	 * but SCALE / 100 times larger
+	 * @param other another QuantizedSymbol
+	 * @return match score, lower is better
+	 */
+	unsigned distance(const QuantizedSymbol & other) const
+	{
+		// Written so that compilers can use a sum of absolute differences
+		// instruction over all densities at once
+		unsigned sum = 0;
+		for (unsigned i = 0; i < LANES; ++i)
+		{
+			int difference = lanes[i] - other.lanes[i];
+			sum += difference < 0 ? -difference : difference;
+		}
+		int difference = proportion - other.proportion;
+		sum += difference < 0 ? -difference : difference;
+		difference = holes - other.holes;
+		sum += (difference < 0 ? -difference : difference) * HOLE_WEIGHT;
+		return sum;
+	}
+
+	/**
+	 * Averages several samples of a character
+	 * @param samples statistics on the same character
+	 * @param weights optionally the number of samples each stands for,
+	 *                such as an earlier average of that many
+	 * @return statistics with the mean of each, rounded
+	 */
+	static QuantizedSymbol average(const std::vector<QuantizedSymbol> & samples,
+	        const std::vector<unsigned> * weights = NULL);
+
+	/**
+	 * Reads statistics from an input stream, as hexadecimal digits:
+	 * two for holes, four for proportion, then two for each Feature
+	 * @param ins input stream
+	 * @param s   statistics
+	 * @return input stream
+	 */
+	friend std::istream & operator>>(std::istream & ins, QuantizedSymbol & s);
+
+	/**
+	 * Writes statistics to an output stream, as hexadecimal digits:
+	 * two for holes, four for proportion, then two for each Feature
+	 * @param outs output stream
+	 * @param s    statistics
+	 * @return output stream
+	 */
+	friend std::ostream & operator<<(std::ostream & outs,
+	        const QuantizedSymbol & s);
+
+	/// Number of holes
+	unsigned char holes;
+	/// Always 0, so that the bytes of compiled fonts are reproducible
+	unsigned char unused;
+	/// Height / width, scaled so that 1 is SCALE
+	unsigned short proportion;
+	/// Each Feature, repeated by its weight, followed by zeros
+	unsigned char lanes[LANES];
+
+private:
+	/**
+	 * Get where a density is first stored
+	 * @param f which density
+	 * @return index in lanes
+	 */
+	static unsigned lane(Feature f)
+	{
+		return f < Q1 ? f : 2 * f - Q1;
+	}
+
+	/**
+	 * Get how many times a density is stored
+	 * @param f which density
+	 * @return weight relative to total density
+	 */
+	static unsigned weight(Feature f)
+	{
+		return f < Q1 ? 1 : 2;
+	}
+};
+
+} // namespace OCR
+
+#endif /*OCR_QUANTIZEDSYMBOL_H_*/
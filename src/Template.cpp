@@ -0,0 +1,153 @@
+/**
+ * @file Template.cpp
+ * @date October 2026
+ * @author Omophagic Content Reader contributors
+ * @brief The implementation of the Template class.
+ * @see Template.h for the interface and documentation.
+ * @version $Id$
+ */
+/*
+ * Copyright 2026 Omophagic Content Reader contributors
+ *
+ * This file is part of Omophagic Content Reader.
+ *
+ * Omophagic Content Reader is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Omophagic Content Reader is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Omophagic Content Reader.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "Template.h"
+namespace OCR
+{
+
+const unsigned Template::SIZE;
+const unsigned Template::WORDS;
+
+/**
+ * Initializes an empty template
+ */
+Template::Template()
+{
+	for (unsigned i = 0; i < WORDS; ++i)
+		bits[i] = 0;
+}
+
+/**
+ * Scales part of an image to a template, keeping its proportions.
+ * Each template pixel is foreground if at least half of the image
+ * pixels it covers are foreground.
+ * @param img  binarized image
+ * @param part part of the image containing the character
+ */
+Template::Template(const BinaryImage & img, const Box & part)
+{
+	// Scale the longer side to fit, keeping the character centered
+	const int w = part.width(), h = part.height();
+	const int side = w > h ? w : h;
+	const int left = part.low.x - (side - w) / 2;
+	const int top = part.low.y - (side - h) / 2;
+	for (unsigned i = 0; i < WORDS; ++i)
+		bits[i] = 0;
+
+	for (unsigned row = 0; row < SIZE; ++row)
+	{
+		// Rows of the character covered by this row of the template
+		int y1 = top + (int) row * side / (int) SIZE;
+		int y2 = top + ((int) row + 1) * side / (int) SIZE - 1;
+		if (y2 < y1)
+			y2 = y1;
+		if (y1 < (int) part.low.y)
+			y1 = part.low.y;
+		if (y2 > (int) part.high.y)
+			y2 = part.high.y;
+		if (y1 > y2)
+			continue;
+		for (unsigned col = 0; col < SIZE; ++col)
+		{
+			int x1 = left + (int) col * side / (int) SIZE;
+			int x2 = left + ((int) col + 1) * side / (int) SIZE - 1;
+			if (x2 < x1)
+				x2 = x1;
+			if (x1 < (int) part.low.x)
+				x1 = part.low.x;
+			if (x2 > (int) part.high.x)
+				x2 = part.high.x;
+			if (x1 > x2)
+				continue;
+			Box cell(x1, y1, x2, y2);
+			if (img.count(cell) * 2 >= cell.area())
+			{
+				unsigned bit = row * SIZE + col;
+				bits[bit / 64] |= 1ULL << (bit % 64);
+			}
+		}
+	}
+}
+
+/**
+ * Combines several samples of a character
+ * @param samples templates of the same character
+ * @param weights optionally the number of samples each stands for,
+ *                such as an earlier majority of that many
+ * @return template with each pixel set if set in at least half the samples
+ */
+Template Template::majority(const std::vector<Template> & samples,
+        const std::vector<unsigned> * weights)
+{
+	Template result;
+	unsigned long long n = 0;
+	for (unsigned i = 0; i < samples.size(); ++i)
+		n += weights ? (*weights)[i] : 1;
+	for (unsigned bit = 0; bit < SIZE * SIZE; ++bit)
+	{
+		unsigned long long count = 0;
+		for (unsigned i = 0; i < samples.size(); ++i)
+			if ((samples[i].bits[bit / 64] >> (bit % 64)) & 1)
+				count += weights ? (*weights)[i] : 1;
+		if (count && count * 2 >= n)
+			result.bits[bit / 64] |= 1ULL << (bit % 64);
+	}
+	return result;
+}
+
+/**
+ * Reads a template from an input stream, as hexadecimal words
+ * @param ins input stream
+ * @param t   template
+ * @return input stream
+ */
+std::istream & operator>>(std::istream & ins, Template & t)
+{
+	std::ios::fmtflags flags = ins.flags();
+	for (unsigned i = 0; i < Template::WORDS; ++i)
+		ins >> std::hex >> t.bits[i];
+	ins.flags(flags);
+	return ins;
+}
+
+/**
+ * Writes a template to an output stream, as hexadecimal words
+ * @param outs output stream
+ * @param t    template
+ * @return output stream
+ */
+std::ostream & operator<<(std::ostream & outs, const Template & t)
+{
+	std::ios::fmtflags flags = outs.flags();
+	for (unsigned i = 0; i < Template::WORDS; ++i)
+		outs << (i ? " " : "") << std::hex << t.bits[i];
+	outs.flags(flags);
+	return outs;
+}
+
+} // namespace OCR
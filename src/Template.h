@@ -0,0 +1,129 @@
+/**
+ * @file Template.h
+ * @date October 2026
+ * @author Omophagic Content Reader contributors
+ * @brief The interface and documentation of the Template class.
+ * @see Template.cpp for the implementation.
+ * @version $Id$
+ */
+/*
+ * Copyright 2026 Omophagic Content Reader contributors
+ *
+ * This file is part of Omophagic Content Reader.
+ *
+ * Omophagic Content Reader is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Omophagic Content Reader is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Omophagic Content Reader.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef OCR_TEMPLATE_H_
+#define OCR_TEMPLATE_H_
+#include <vector>
+#include <iostream>
+#include "Box.h"
+#include "BinaryImage.h"
+
+namespace OCR
+{
+
+/**
+ * The shape of a character, scaled to a fixed size
+ * and stored one bit per pixel.
+ */
+class Template
+{
+public:
+	/// Width and height of every template, in pixels
+	static const unsigned SIZE = 32;
+	/// Number of 64-bit words in a template
+	static const unsigned WORDS = SIZE * SIZE / 64;
+
+	/**
+	 * Initializes an empty template
+	 */
+	Template();
+
+	/**
+	 * Scales part of an image to a template, keeping its proportions.
+	 * Each template pixel is foreground if at least half of the image
+	 * pixels it covers are foreground.
+	 * @param img  binarized image
+	 * @param part part of the image containing the character
+	 */
+	Template(const BinaryImage & img, const Box & part);
+
+	/**
+	 * Counts the pixels that differ from another template
+	 * @param other another Template
+	 * @return number of differing pixels, lower is better
+	 */
+	unsigned distance(const Template & other) const
+	{
+		unsigned count = 0;
+		for (unsigned i = 0; i < WORDS; ++i)
+			count += popcount(bits[i] ^ other.bits[i]);
+		return count;
+	}
+
+	/**
+	 * Counts the set bits in a word
+	 * @param word a word
+	 * @return number of bits set
+	 */
+	static unsigned popcount(unsigned long long word)
+	{
+#ifdef __POPCNT__
+		return __builtin_popcountll(word);
+#else
+		// Without the instruction, add up bits in parallel
+		word -= (word >> 1) & 0x5555555555555555ULL;
+		word = (word & 0x3333333333333333ULL) + ((word >> 2)
+		        & 0x3333333333333333ULL);
+		word = (word + (word >> 4)) & 0x0F0F0F0F0F0F0F0FULL;
+		return (word * 0x0101010101010101ULL) >> 56;
+#endif
+	}
+
+	/**
+	 * Combines several samples of a character
+	 * @param samples templates of the same character
+	 * @param weights optionally the number of samples each stands for,
+	 *                such as an earlier majority of that many
+	 * @return template with each pixel set if set in at least half the samples
+	 */
+	static Template majority(const std::vector<Template> & samples,
+	        const std::vector<unsigned> * weights = NULL);
+
+	/**
+	 * Reads a template from an input stream, as hexadecimal words
+	 * @param ins input stream
+	 * @param t   template
+	 * @return input stream
+	 */
+	friend std::istream & operator>>(std::istream & ins, Template & t);
+
+	/**
+	 * Writes a template to an output stream, as hexadecimal words
+	 * @param outs output stream
+	 * @param t    template
+	 * @return output stream
+	 */
+	friend std::ostream & operator<<(std::ostream & outs, const Template & t);
+
+	/// Pixels, row by row, 64 per word
+	unsigned long long bits[WORDS];
+};
+
+} // namespace OCR
+
+#endif /*OCR_TEMPLATE_H_*/
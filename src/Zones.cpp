@@ -0,0 +1,152 @@
+/**
+ * @file Zones.cpp
+ * @date October 2026
+ * @author Omophagic Content Reader contributors
+ * @brief The implementation of the Zones class.
+ * @see Zones.h for the interface and documentation.
+ * @version $Id$
+ */
+/*
+ * Copyright 2026 Omophagic Content Reader contributors
+ *
+ * This file is part of Omophagic Content Reader.
+ *
+ * Omophagic Content Reader is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Omophagic Content Reader is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Omophagic Content Reader.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <string>
+#include <cstdlib>
+#include "Zones.h"
+namespace OCR
+{
+
+const unsigned Zones::MAX_CELLS;
+
+/**
+ * Initializes an empty grid
+ * @param r number of rows
+ * @param c number of columns
+ */
+Zones::Zones(unsigned r, unsigned c) :
+	rows(r), cols(c)
+{
+	for (unsigned i = 0; i < MAX_CELLS; ++i)
+		density[i] = 0;
+}
+
+/**
+ * Finds the density of each cell of a grid over part of an image.
+ * Each cell is counted in constant time from the summed-area table.
+ * @param img  binarized image
+ * @param part part of the image containing the character
+ * @param r    number of rows, such that r * c <= MAX_CELLS
+ * @param c    number of columns
+ */
+Zones::Zones(const BinaryImage & img, const Box & part, unsigned r,
+        unsigned c) :
+	rows(r), cols(c)
+{
+	const unsigned w = part.width(), h = part.height();
+	for (unsigned i = 0; i < MAX_CELLS; ++i)
+		density[i] = 0;
+
+	for (unsigned row = 0; row < rows; ++row)
+	{
+		// Rows of the character covered by this row of the grid
+		unsigned y1 = row * h / rows, y2 = (row + 1) * h / rows;
+		if (y2 > y1)
+			--y2;
+		for (unsigned col = 0; col < cols; ++col)
+		{
+			unsigned x1 = col * w / cols, x2 = (col + 1) * w / cols;
+			if (x2 > x1)
+				--x2;
+			Box cell(part.low.x + x1, part.low.y + y1, part.low.x + x2,
+			        part.low.y + y2);
+			density[row * cols + col] = (img.count(cell) * 255 + cell.area()
+			        / 2) / cell.area();
+		}
+	}
+}
+
+/**
+ * Averages several samples of a character
+ * @param samples grids of the same size over the same character
+ * @param weights optionally the number of samples each stands for,
+ *                such as an earlier average of that many
+ * @return grid with the mean density of each cell
+ */
+Zones Zones::average(const std::vector<Zones> & samples,
+        const std::vector<unsigned> * weights)
+{
+	unsigned long long n = 0;
+	for (unsigned j = 0; j < samples.size(); ++j)
+		n += weights ? (*weights)[j] : 1;
+	if (!n)
+		return Zones();
+	Zones result(samples.front().rows, samples.front().cols);
+	for (unsigned i = 0; i < MAX_CELLS; ++i)
+	{
+		unsigned long long sum = 0;
+		for (unsigned j = 0; j < samples.size(); ++j)
+			sum += samples[j].density[i] * (weights ? (*weights)[j] : 1ULL);
+		result.density[i] = (sum + n / 2) / n;
+	}
+	return result;
+}
+
+/**
+ * Reads a grid from an input stream,
+ * as its size followed by two hexadecimal digits per cell
+ * @param ins input stream
+ * @param z   grid
+ * @return input stream
+ */
+std::istream & operator>>(std::istream & ins, Zones & z)
+{
+	unsigned r = 0, c = 0;
+	char separator;
+	std::string cells;
+	if (!(ins >> r >> separator >> c >> cells))
+		return ins;
+	if (separator != 'x' || r * c > Zones::MAX_CELLS || cells.size() != r * c
+	        * 2)
+	{
+		ins.setstate(std::ios::failbit);
+		return ins;
+	}
+	z = Zones(r, c);
+	for (unsigned i = 0; i < r * c; ++i)
+		z.density[i] = strtoul(cells.substr(i * 2, 2).c_str(), NULL, 16);
+	return ins;
+}
+
+/**
+ * Writes a grid to an output stream,
+ * as its size followed by two hexadecimal digits per cell
+ * @param outs output stream
+ * @param z    grid
+ * @return output stream
+ */
+std::ostream & operator<<(std::ostream & outs, const Zones & z)
+{
+	const char digits[] = "0123456789abcdef";
+	outs << (int) z.rows << 'x' << (int) z.cols << ' ';
+	for (unsigned i = 0; i < (unsigned) z.rows * z.cols; ++i)
+		outs << digits[z.density[i] >> 4] << digits[z.density[i] & 15];
+	return outs;
+}
+
+} // namespace OCR
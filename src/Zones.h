@@ -0,0 +1,123 @@
+/**
+ * @file Zones.h
+ * @date October 2026
+ * @author Omophagic Content Reader contributors
+ * @brief The interface and documentation of the Zones class.
+ * @see Zones.cpp for the implementation.
+ * @version $Id$
+ */
+/*
+ * Copyright 2026 Omophagic Content Reader contributors
+ *
+ * This file is part of Omophagic Content Reader.
+ *
+ * Omophagic Content Reader is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Omophagic Content Reader is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Omophagic Content Reader.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef OCR_ZONES_H_
+#define OCR_ZONES_H_
+#include <vector>
+#include <iostream>
+#include "Box.h"
+#include "BinaryImage.h"
+
+namespace OCR
+{
+
+/**
+ * The density of foreground pixels in each cell of a grid laid over a
+ * character; a generalization of the quadrant densities of Font::Symbol.
+ *
+ * Densities are stored as bytes from 0 to 255, and unused cells are 0,
+ * so that every grid can be compared with the same fixed-length loop.
+ */
+class Zones
+{
+public:
+	/// Maximum number of cells in a grid
+	static const unsigned MAX_CELLS = 64;
+
+	/**
+	 * Initializes an empty grid
+	 * @param r number of rows
+	 * @param c number of columns
+	 */
+	Zones(unsigned r = 0, unsigned c = 0);
+
+	/**
+	 * Finds the density of each cell of a grid over part of an image.
+	 * Each cell is counted in constant time from the summed-area table.
+	 * @param img  binarized image
+	 * @param part part of the image containing the character
+	 * @param r    number of rows, such that r * c <= MAX_CELLS
+	 * @param c    number of columns
+	 */
+	Zones(const BinaryImage & img, const Box & part, unsigned r, unsigned c);
+
+	/**
+	 * Compares this to another grid of the same size
+	 * @param other another Zones
+	 * @return sum of differences in density, lower is better
+	 */
+	unsigned distance(const Zones & other) const
+	{
+		// Written so that compilers can use a sum of absolute differences
+		// instruction over many cells at once
+		unsigned sum = 0;
+		for (unsigned i = 0; i < MAX_CELLS; ++i)
+		{
+			int difference = density[i] - other.density[i];
+			sum += difference < 0 ? -difference : difference;
+		}
+		return sum;
+	}
+
+	/**
+	 * Averages several samples of a character
+	 * @param samples grids of the same size over the same character
+	 * @param weights optionally the number of samples each stands for,
+	 *                such as an earlier average of that many
+	 * @return grid with the mean density of each cell
+	 */
+	static Zones average(const std::vector<Zones> & samples,
+	        const std::vector<unsigned> * weights = NULL);
+
+	/**
+	 * Reads a grid from an input stream,
+	 * as its size followed by two hexadecimal digits per cell
+	 * @param ins input stream
+	 * @param z   grid
+	 * @return input stream
+	 */
+	friend std::istream & operator>>(std::istream & ins, Zones & z);
+
+	/**
+	 * Writes a grid to an output stream,
+	 * as its size followed by two hexadecimal digits per cell
+	 * @param outs output stream
+	 * @param z    grid
+	 * @return output stream
+	 */
+	friend std::ostream & operator<<(std::ostream & outs, const Zones & z);
+
+	/// Size of the grid
+	unsigned char rows, cols;
+	/// Density of each cell, row by row, scaled to 0-255
+	unsigned char density[MAX_CELLS];
+};
+
+} // namespace OCR
+
+#endif /*OCR_ZONES_H_*/
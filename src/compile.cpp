@@ -0,0 +1,146 @@
+/**
+ * @file compile.cpp
+ * @date October 2026
+ * @author Omophagic Content Reader contributors
+ * @brief An application program using the OCR library to compile font data
+ *        files for fast loading, or into the ocr program itself.
+ * @version $Id$
+ */
+/*
+ * Copyright 2026 Omophagic Content Reader contributors
+ *
+ * This file is part of Omophagic Content Reader.
+ *
+ * Omophagic Content Reader is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Omophagic Content Reader is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Omophagic Content Reader.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <unistd.h>
+#include "Font.h"
+#include "FontRegistry.h"
+
+/**
+ * Writes C++ source that builds compiled fonts into a program
+ * @param outs     output stream
+ * @param names    font names
+ * @param compiled each font in the compiled format
+ */
+static void writeEmbedded(std::ostream & outs,
+        const std::vector<std::string> & names,
+        const std::vector<std::string> & compiled)
+{
+	outs << "// Generated by ocr-compile -c; do not edit.\n"
+		"#include \"Font.h\"\n\nnamespace\n{\n";
+	for (unsigned f = 0; f < names.size(); ++f)
+	{
+		// Aligned like a mapped file, so the font is used where it lies
+		const std::string & bytes = compiled[f];
+		outs << "\n// " << names[f] << '\n'
+		        << "alignas(64) constexpr unsigned char font" << f << "[] =\n{";
+		for (unsigned i = 0; i < bytes.size(); ++i)
+			outs << (i % 16 ? " " : "\n\t")
+			        << (unsigned) (unsigned char) bytes[i] << ',';
+		outs << "\n};\n";
+	}
+
+	outs << "\n/// Embeds every font while the program starts\n"
+		"struct Embed\n{\n\tEmbed()\n\t{\n";
+	for (unsigned f = 0; f < names.size(); ++f)
+		outs << "\t\tOCR::Font::embed(\"" << names[f] << "\", font" << f
+		        << ", sizeof(font" << f << "));\n";
+	outs << "\t}\n} embed;\n\n} // namespace\n";
+}
+
+int main(int argc, char * argv[])
+{
+	// Get options
+	const char * source = NULL;
+	int option;
+	while ((option = getopt(argc, argv, "c:")) != -1)
+		switch (option)
+		{
+			case 'c':
+				source = optarg;
+				break;
+			default:
+				std::cerr << "Usage: " << argv[0]
+				        << " [-c source.cpp] <font name>...\n";
+				return 1;
+		}
+	if (optind >= argc && !source)
+	{
+		std::cerr << "Usage: " << argv[0]
+		        << " [-c source.cpp] <font name>...\n";
+		return 1;
+	}
+
+	int status = 0;
+	std::vector<std::string> names, compiled;
+	for (int i = optind; i < argc; ++i)
+	{
+		const std::string name = argv[i];
+		const std::string text = OCR::FontRegistry::textFile(name);
+		if (text.empty())
+		{
+			std::cerr << argv[0] << ": no font data file for " << name
+			        << " in the font search path\n";
+			status = 1;
+			continue;
+		}
+		if (!std::ifstream(text.c_str()))
+		{
+			std::cerr << argv[0] << ": cannot read " << text << '\n';
+			status = 1;
+			continue;
+		}
+
+		// Reading builds the index, which is compiled with the symbols.
+		// Only the text font is read, never a built-in or compiled one.
+		OCR::Font font = OCR::Font::fromText(text);
+		if (source)
+		{
+			std::ostringstream bytes;
+			font.compile(bytes);
+			names.push_back(name);
+			compiled.push_back(bytes.str());
+			continue;
+		}
+		// Beside the text font, where Font finds it first
+		const std::string file = text.substr(0, text.size() - 4) + "cfont";
+		if (!font.compile(file))
+		{
+			std::cerr << argv[0] << ": cannot write " << file << '\n';
+			status = 1;
+		}
+	}
+
+	if (source)
+	{
+		std::ofstream outfile(source);
+		writeEmbedded(outfile, names, compiled);
+		outfile.close();
+		if (outfile.fail())
+		{
+			std::cerr << argv[0] << ": cannot write " << source << '\n';
+			status = 1;
+		}
+	}
+	return status;
+}
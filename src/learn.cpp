@@ -30,71 +30,465 @@
 #include <vector>
 #include <string>
 #include <map>
+#include <algorithm>
+#include <set>
+#include <sstream>
+#include <thread>
+#include <atomic>
+#include <deque>
+#include <cctype>
+#include <unistd.h>
+#include <getopt.h>
 #include "EasyBMP/EasyBMP.h"
 #include "Font.h"
+#include "Moments.h"
 #include "Page.h"
 
 /**
  * All supported characters.
  *
- * The input file should contain these characters in order,
- * or any initial part of this string.
+ * An input file without a transcript should contain these characters
+ * in order, or any initial part of this string.
  */
 const std::string ALPHABET =
         "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789.,?!/@_";
 
-int main(int argc, char * argv[])
+/**
+ * What a font already learned of a character
+ */
+struct Learned
 {
-	if (argc < 3)
+	/// Mean and variance of the samples of each prototype, in font order
+	std::vector<OCR::Moments> prototypes;
+	/// Whether the font has the shape, grid and quantized statistics
+	bool extra;
+	/// Majority of the shapes of the samples
+	OCR::Template shape;
+	/// Average grid of densities of the samples
+	OCR::Zones grid;
+	/// Average quantized statistics of the samples
+	OCR::QuantizedSymbol rounded;
+};
+
+/**
+ * Reads what a font data file written by ocr-learn learned
+ * @param[in]  file    file name
+ * @param[out] learned what was learned of each character
+ * @return whether the file exists and every line has the number
+ *         and variance of its samples
+ */
+static bool readFont(const std::string & file,
+        std::map<char, Learned> & learned)
+{
+	std::ifstream infile(file.c_str());
+	if (!infile)
+		return false;
+	std::string line, tag;
+	while (std::getline(infile, line))
 	{
-		std::cerr << "Usage: " << argv[0] << " <font name> <font image>...\n";
-		return 1;
+		std::istringstream fields(line);
+		char character;
+		OCR::Font::Symbol mean;
+		if (!(fields >> character >> mean))
+			continue;
+		Learned & l = learned[character];
+		if (l.prototypes.empty())
+			l.extra = false;
+		unsigned count = 0;
+		double means[OCR::Moments::STATISTICS];
+		double variance[OCR::Moments::STATISTICS];
+		double squares[OCR::Moments::STATISTICS];
+		bool hasMeans = false, hasVariance = false, hasSquares = false,
+		        hasShape = false, hasGrid = false, hasRounded = false;
+		while (fields >> tag)
+			if (tag == "n")
+				fields >> count;
+			else if (tag == "m")
+			{
+				for (unsigned i = 0; i < OCR::Moments::STATISTICS; ++i)
+					fields >> means[i];
+				hasMeans = !fields.fail();
+			}
+			else if (tag == "v")
+			{
+				for (unsigned i = 0; i < OCR::Moments::STATISTICS; ++i)
+					fields >> variance[i];
+				hasVariance = !fields.fail();
+			}
+			else if (tag == "s")
+			{
+				for (unsigned i = 0; i < OCR::Moments::STATISTICS; ++i)
+					fields >> squares[i];
+				hasSquares = !fields.fail();
+			}
+			else if (tag == "t")
+				hasShape = !(fields >> l.shape).fail();
+			else if (tag == "z")
+				hasGrid = !(fields >> l.grid).fail();
+			else if (tag == "q")
+				hasRounded = !(fields >> l.rounded).fail();
+		if (!count || !hasVariance)
+			return false;
+		l.extra |= hasShape && hasGrid && hasRounded;
+		// Fonts learned before the sums of squares were kept only have
+		// the variance, and before the unrounded means were kept only
+		// the statistics of the line
+		if (hasMeans && !hasSquares)
+			for (unsigned i = 0; i < OCR::Moments::STATISTICS; ++i)
+				squares[i] = count > 1 ? variance[i] * (count - 1) : 0;
+		l.prototypes.push_back(hasMeans ? OCR::Moments(count, means,
+		        squares) : OCR::Moments(count, mean, variance));
 	}
+	return true;
+}
 
-	// Average symbol information
-	std::map<char, OCR::Font::Symbol> average;
+/**
+ * Reads the transcript of an image: a text file of the same name
+ * with the extension .txt
+ * @param[in]  image file name of the image
+ * @param[out] lines the characters of each line of text, without spaces,
+ *                   leaving out lines with none
+ * @return whether the image has a transcript
+ */
+static bool readTranscript(const std::string & image,
+        std::vector<std::string> & lines)
+{
+	std::ifstream infile((image.substr(0, image.rfind('.')) + ".txt").c_str());
+	if (!infile)
+		return false;
+	std::string text, line;
+	while (std::getline(infile, text))
+	{
+		line.clear();
+		for (unsigned i = 0; i < text.size(); ++i)
+			if (!isspace((unsigned char) text[i]))
+				line += text[i];
+		if (!line.empty())
+			lines.push_back(line);
+	}
+	return true;
+}
 
-	// Image
+/**
+ * Matches the characters read on a page to its transcript, line by line.
+ * Lines are paired in order so that as many as possible have as many
+ * characters as their line of the transcript. Only a line that cannot
+ * be paired is left out, even if the page has lines the transcript
+ * does not, or the other way around.
+ * @param[in]  page       page already read
+ * @param[in]  transcript characters of each line of the page
+ * @param[out] labels     the character of each one read, or '\0' if unused
+ * @return index of each line with characters that was left out
+ */
+static std::vector<unsigned> align(const OCR::Page & page,
+        const std::vector<std::string> & transcript, std::string & labels)
+{
+	const std::deque<OCR::Line> & lines = page.textLines();
+	const unsigned n = lines.size(), m = transcript.size();
+
+	// Most lines from l on that can be paired with the transcript from t on
+	std::vector<std::vector<unsigned> > paired(n + 1, std::vector<unsigned>(
+	        m + 1, 0));
+	for (unsigned l = n; l-- > 0;)
+		for (unsigned t = m; t-- > 0;)
+		{
+			paired[l][t] = std::max(paired[l + 1][t], paired[l][t + 1]);
+			const unsigned glyphs = lines[l].glyphCount();
+			if (glyphs && glyphs == transcript[t].size())
+				paired[l][t] = std::max(paired[l][t], paired[l + 1][t + 1]
+				        + 1);
+		}
+
+	// Follow the pairing, pairing a line with the next line of the
+	// transcript whenever that is one of the best pairings
+	std::vector<unsigned> unused;
+	for (unsigned l = 0, t = 0; l < n;)
+	{
+		const unsigned glyphs = lines[l].glyphCount();
+		if (t < m && glyphs && glyphs == transcript[t].size()
+		        && paired[l][t] == paired[l + 1][t + 1] + 1)
+		{
+			labels += transcript[t];
+			++l;
+			++t;
+		}
+		else if (t < m && paired[l][t] == paired[l][t + 1])
+			++t;
+		else
+		{
+			labels.append(glyphs, '\0');
+			if (glyphs)
+				unused.push_back(l);
+			++l;
+		}
+	}
+	return unused;
+}
+
+/**
+ * Reads font images until none are left, on one of several threads.
+ * An image with a transcript is read as a page of several lines of any
+ * characters, and one without as one line of the ALPHABET.
+ * @param[in]     names    file name of each image
+ * @param[in,out] next     index of the next image no thread has taken
+ * @param[in]     font     font to read with
+ * @param[out]    features information extracted from each image, each
+ *                         already asking for the Optional information
+ * @param[out]    labels   the character of each one in features,
+ *                         or '\0' if it is not to be learned
+ * @param[out]    skipped  index of each line of each image not learned
+ */
+static void readImages(const std::vector<std::string> * names,
+        std::atomic<unsigned> * next, const OCR::Font * font,
+        std::vector<OCR::FeatureBatch> * features,
+        std::vector<std::string> * labels,
+        std::vector<std::vector<unsigned> > * skipped)
+{
 	BMP img;
+	for (unsigned i = (*next)++; i < names->size(); i = (*next)++)
+	{
+		img.ReadFromFile((*names)[i].c_str());
+		std::vector<std::string> transcript;
+		if (readTranscript((*names)[i], transcript))
+		{
+			OCR::Page page(img, *font);
+			page.Read(NULL, &(*features)[i]);
+			(*skipped)[i] = align(page, transcript, (*labels)[i]);
+		}
+		else
+		{
+			OCR::Line line(img, *font);
+			line.Read(NULL, &(*features)[i]);
+			(*labels)[i] = ALPHABET.substr(0, (*features)[i].size());
+		}
+	}
+}
+
+int main(int argc, char * argv[])
+{
+	// Size of the grid of densities
+	unsigned zoneRows = 4, zoneCols = 4;
+	// Most prototypes of each character
+	unsigned prototypes = 1;
+	// Number of images read at once
+	unsigned threads = std::thread::hardware_concurrency();
+	// Whether to add to the font instead of replacing it
+	bool update = false;
+	// Whether the size of the grid was chosen
+	bool gridGiven = false;
+	const struct option longOptions[] =
+	{
+	{ "update", no_argument, NULL, 'u' },
+	{ NULL, 0, NULL, 0 } };
+	int option;
+	char separator;
+	while ((option = getopt_long(argc, argv, "j:k:uz:", longOptions, NULL))
+	        != -1)
+	{
+		std::istringstream value(option == 'j' || option == 'k' || option
+		        == 'z' ? optarg : "");
+		gridGiven |= option == 'z';
+		if (option == 'u')
+			update = true;
+		else if (option == 'j' ? !(value >> threads) || !threads : option == 'k'
+		        ? !(value >> prototypes) || !prototypes : !(value >> zoneRows
+		                >> separator >> zoneCols) || separator != 'x'
+		                || !zoneRows || !zoneCols || zoneRows * zoneCols
+		                > OCR::Zones::MAX_CELLS)
+			argc = 0;
+	}
+	if (argc - optind < 2)
+	{
+		std::cerr << "Usage: " << argv[0] << " [-j <threads>] [-k <prototypes>]"
+		        << " [-u|--update] [-z <rows>x<columns>] <font name>"
+		        << " <font image>...\n"
+		        << "An image with a .txt transcript of the same name may be"
+		        << " a page of any text.\n";
+		return 1;
+	}
+
+	// Mean and variance of the symbol information
+	std::map<char, OCR::Moments> moments;
+	// Every set of statistics of each symbol
+	std::map<char, std::vector<OCR::Font::Symbol> > samples;
+	// Every template of each symbol
+	std::map<char, std::vector<OCR::Template> > shapes;
+	// Every grid of densities of each symbol
+	std::map<char, std::vector<OCR::Zones> > grids;
+	// Every set of quantized statistics of each symbol
+	std::map<char, std::vector<OCR::QuantizedSymbol> > rounded;
 
 	// Load a non-existent font
 	OCR::Font bogus("BOGUS");
 
-	// Open file for output
-	std::string outFileName = argv[1];
+	// What the font learned before, if adding to it
+	std::string outFileName = argv[optind];
 	outFileName = "font/" + outFileName + ".font";
-	std::ofstream outFile(outFileName.c_str());
+	std::map<char, Learned> learned;
+	if (update && !readFont(outFileName, learned))
+	{
+		std::cerr << argv[0] << ": " << outFileName << " does not exist or"
+		        << " has no sample counts; learn it without --update\n";
+		return 1;
+	}
 
-	// Load each line and read its statistics
-	for (int fileNum = 2; fileNum < argc; ++fileNum)
+	// Grids are only combined with grids of the same size,
+	// which is that of the font unless chosen
+	for (std::map<char, Learned>::const_iterator itr = learned.begin(); itr
+	        != learned.end(); ++itr)
 	{
-		// Create line
-		img.ReadFromFile(argv[fileNum]);
-		OCR::Line line(img, bogus);
+		const OCR::Zones & grid = itr->second.grid;
+		if (!itr->second.extra || (grid.rows == zoneRows && grid.cols
+		        == zoneCols))
+			continue;
+		if (gridGiven)
+		{
+			std::cerr << argv[0] << ": " << outFileName << " has a "
+			        << (unsigned) grid.rows << 'x' << (unsigned) grid.cols
+			        << " grid, not " << zoneRows << 'x' << zoneCols << '\n';
+			return 1;
+		}
+		zoneRows = grid.rows;
+		zoneCols = grid.cols;
+		gridGiven = true;
+	}
 
-		// Create vector for symbol info
-		std::vector<OCR::Font::Symbol> symbols;
-		symbols.reserve(ALPHABET.size());
+	// Read the images on several threads, each into its own batch
+	const std::vector<std::string> names(argv + optind + 1, argv + argc);
+	std::vector<OCR::FeatureBatch> batches(names.size(), OCR::FeatureBatch(
+	        OCR::FeatureBatch::RASTER | OCR::FeatureBatch::ZONES
+	                | OCR::FeatureBatch::QUANTIZED, OCR::Zones(zoneRows,
+	                zoneCols)));
+	std::vector<std::string> labels(names.size());
+	std::vector<std::vector<unsigned> > skipped(names.size());
+	std::atomic<unsigned> next(0);
+	std::vector<std::thread> readers;
+	for (unsigned t = 1; t < threads && t < names.size(); ++t)
+		readers.push_back(std::thread(readImages, &names, &next, &bogus,
+		        &batches, &labels, &skipped));
+	readImages(&names, &next, &bogus, &batches, &labels, &skipped);
+	for (unsigned t = 0; t < readers.size(); ++t)
+		readers[t].join();
 
-		// Do the reading
-		line.Read(&symbols);
+	// Combine the batches in the order of the images,
+	// so the sums are the same however many threads read them
+	for (unsigned fileNum = 0; fileNum < batches.size(); ++fileNum)
+	{
+		const OCR::FeatureBatch & features = batches[fileNum];
+		const std::vector<unsigned> & unused = skipped[fileNum];
+		if (!unused.empty() && labels[fileNum].find_first_not_of('\0')
+		        == std::string::npos)
+			std::cerr << names[fileNum] << ": no line matches the "
+			        << "transcript, page skipped\n";
+		else if (!unused.empty())
+		{
+			std::cerr << names[fileNum] << ": line"
+			        << (unused.size() > 1 ? "s" : "");
+			for (unsigned i = 0; i < unused.size(); ++i)
+				std::cerr << (i ? ", " : " ") << unused[i] + 1;
+			std::cerr << (unused.size() > 1 ? " do" : " does")
+			        << " not match the transcript, skipped\n";
+		}
 
-		// Loop through and add to the "average"
-		std::vector<OCR::Font::Symbol>::iterator itr = symbols.begin();
-		for (unsigned charIndex = 0; itr != symbols.end() && charIndex
-		        < ALPHABET .size(); ++itr, ++charIndex)
+		// Loop through and add to the mean and variance
+		for (unsigned charIndex = 0; charIndex < labels[fileNum].size();
+		        ++charIndex)
 		{
-			average[ALPHABET[charIndex]] += *itr;
+			const char c = labels[fileNum][charIndex];
+			if (!c)
+				continue;
+			moments[c].add(features.symbol(charIndex));
+			samples[c].push_back(features.symbol(charIndex));
+			shapes[c].push_back(features.templates[charIndex]);
+			grids[c].push_back(features.zones[charIndex]);
+			rounded[c].push_back(features.quantized[charIndex]);
 		}
 	}
 
-	for (std::map<char, OCR::Font::Symbol>::iterator itr = average.begin(); itr
-	        != average.end(); ++itr)
+	// Every character learned before or now
+	std::set<char> characters;
+	for (std::map<char, Learned>::iterator itr = learned.begin(); itr
+	        != learned.end(); ++itr)
+		characters.insert(itr->first);
+	for (std::map<char, OCR::Moments>::iterator itr = moments.begin(); itr
+	        != moments.end(); ++itr)
+		characters.insert(itr->first);
+
+	std::ofstream outFile(outFileName.c_str());
+	for (std::set<char>::iterator itr = characters.begin(); itr
+	        != characters.end(); ++itr)
 	{
-		// Divide all statistics by number of lines read
-		itr->second /= (argc - 2);
-		// Print the character and its statistics to the file
-		outFile << itr->first << ' ' << itr->second << std::endl;
+		const char c = *itr;
+		const std::vector<OCR::Font::Symbol> & all = samples[c];
+		std::vector<OCR::Font::Symbol> clusters;
+		std::vector<OCR::Moments> spread;
+		// Number of samples each template, grid and quantized statistics
+		// stand for
+		std::vector<unsigned> weights(shapes[c].size(), 1);
+		std::map<char, Learned>::const_iterator old = learned.find(c);
+		if (old != learned.end())
+		{
+			// Add each new sample to the closest prototype learned before,
+			// and count what was learned before once for each of its samples.
+			// Only the majority shape and the rounded averages were kept,
+			// so those are merged as if every earlier sample had them.
+			spread = old->second.prototypes;
+			unsigned count = 0;
+			for (unsigned p = 0; p < spread.size(); ++p)
+			{
+				clusters.push_back(spread[p].mean());
+				count += spread[p].count();
+			}
+			for (unsigned i = 0; i < all.size(); ++i)
+			{
+				unsigned closest = 0;
+				for (unsigned p = 1; p < clusters.size(); ++p)
+					if (clusters[p].match(all[i]) < clusters[closest].match(
+					        all[i]))
+						closest = p;
+				spread[closest].add(all[i]);
+			}
+			for (unsigned p = 0; p < spread.size(); ++p)
+				clusters[p] = spread[p].mean();
+			if (old->second.extra)
+			{
+				shapes[c].insert(shapes[c].begin(), old->second.shape);
+				grids[c].insert(grids[c].begin(), old->second.grid);
+				rounded[c].insert(rounded[c].begin(), old->second.rounded);
+				weights.insert(weights.begin(), count);
+			}
+		}
+		else if (prototypes > 1)
+		{
+			// Group the samples into several prototypes,
+			// each with the mean and variance of its own samples
+			std::vector<unsigned> group;
+			clusters = OCR::Font::Symbol::cluster(all, prototypes, &group);
+			spread.assign(clusters.size(), OCR::Moments());
+			for (unsigned i = 0; i < all.size(); ++i)
+				spread[group[i]].add(all[i]);
+		}
+		else
+		{
+			// Use the mean of all samples
+			clusters.assign(1, moments[c].mean());
+			spread.assign(1, moments[c]);
+		}
+
+		// Print the character, its statistics, their number and variance,
+		// template, grid and quantized statistics to the file,
+		// then the same statistics of any other prototypes
+		outFile << c << ' ' << clusters[0] << " n " << spread[0].count()
+		        << ' ' << spread[0];
+		if (!shapes[c].empty())
+			outFile << " t " << OCR::Template::majority(shapes[c], &weights)
+			        << " z " << OCR::Zones::average(grids[c], &weights)
+			        << " q " << OCR::QuantizedSymbol::average(rounded[c],
+			        &weights);
+		outFile << std::endl;
+		for (unsigned p = 1; p < clusters.size(); ++p)
+			outFile << c << ' ' << clusters[p] << " n " << spread[p].count()
+			        << ' ' << spread[p] << std::endl;
 	}
 
 	outFile.close();
@@ -27,9 +27,18 @@
 
 #include <iostream>
 #include <string>
+#include <fstream>
+#include <sstream>
+#include <iomanip>
+#include <vector>
+#include <memory>
+#include <getopt.h>
 #include "EasyBMP/EasyBMP.h"
 #include "Font.h"
 #include "Page.h"
+#include "FontIdentifier.h"
+#include "FontRegistry.h"
+#include "Profile.h"
 using std::cout;
 using std::cerr;
 using std::endl;
@@ -40,23 +49,169 @@ using OCR::Font;
 int main(int argc, char * argv[])
 {
 	string result;
-	if (argc != 3)
+	Font::Engine engine = Font::STATISTICS;
+	bool showConfidence = false, identifyFont = false;
+	unsigned margin = Font::DEFAULT_MARGIN;
+	// How to show the time and work spent reading, if at all
+	string stats;
+	// File to write a trace of reading to, if any
+	string trace;
+	// Whether to count hardware events in each stage
+	bool hardware = false;
+	const struct option longOptions[] =
 	{
-		cerr << "Usage: " << argv[0] << " <font name> <bitmap name>\n";
+	{ "stats", optional_argument, NULL, 's' },
+	{ "trace", required_argument, NULL, 't' },
+	{ "perf", no_argument, NULL, 'p' },
+	{ NULL, 0, NULL, 0 } };
+	int option;
+	while ((option = getopt_long(argc, argv, "ace:m:", longOptions, NULL))
+	        != -1)
+	{
+		std::istringstream value(option == 'm' ? optarg : "");
+		if (option == 's' && (!optarg || string(optarg) == "table"))
+			stats = "table";
+		else if (option == 's' && string(optarg) == "json")
+			stats = "json";
+		else if (option == 't' && *optarg)
+			trace = optarg;
+		else if (option == 'p')
+			hardware = true;
+		else if (option == 'a')
+			identifyFont = true;
+		else if (option == 'c')
+			showConfidence = true;
+		else if (option == 'e' && string(optarg) == "statistics")
+			engine = Font::STATISTICS;
+		else if (option == 'e' && string(optarg) == "template")
+			engine = Font::TEMPLATE;
+		else if (option == 'e' && string(optarg) == "zoning")
+			engine = Font::ZONING;
+		else if (option == 'e' && string(optarg) == "quantized")
+			engine = Font::QUANTIZED;
+		else if (option == 'e' && string(optarg) == "cascade")
+			engine = Font::CASCADE;
+		else if (option == 'e' && string(optarg) == "normalized")
+			engine = Font::NORMALIZED;
+		else if (option == 'm' && value >> margin)
+			continue;
+		else
+			argc = 0;
+	}
+	if (argc - optind != (identifyFont ? 1 : 2))
+	{
+		const string engines =
+		        " [-e statistics|template|zoning|quantized|cascade|normalized]";
+		cerr << "Usage: " << argv[0] << " [-c]" << engines
+		        << " [-m <margin>] [--stats[=table|json]] [--perf]"
+		        << " [--trace=<file>] <font name> <bitmap name>\n"
+		        << "       " << argv[0] << " -a [-c]" << engines
+		        << " [-m <margin>] [--stats[=table|json]] [--perf]"
+		        << " [--trace=<file>] <bitmap name>\n";
 		return 1;
 	}
-
-	// Load the font
-	Font f(argv[1]);
+#ifdef OCR_NO_PROFILE
+	if (!stats.empty() || !trace.empty() || hardware)
+	{
+		cerr << argv[0] << ": built without --stats, --trace or --perf\n";
+		return 1;
+	}
+#endif
+	if (hardware && stats.empty())
+		stats = "table";
+	OCR::Profile::enable(!stats.empty());
+	OCR::Profile::trace(!trace.empty());
+	OCR::Profile::countHardware(hardware);
 
 	// Load the page from a bitmap file
 	BMP img;
-	img.ReadFromFile(argv[2]);
+	{
+		OCR_PROFILE_TIME(DECODE);
+		img.ReadFromFile(argv[argc - 1]);
+	}
+
+	// Choose the font, if not named
+	string fontName = identifyFont ? "" : argv[optind];
+	if (identifyFont)
+	{
+		fontName = OCR::FontIdentifier().identify(img, engine);
+		if (fontName.empty())
+		{
+			cerr << argv[0] << ": no font in the font directory"
+			        << " has data for this engine\n";
+			return 1;
+		}
+	}
+
+	// Load the font, unless identifying it already did
+	OCR::FontRegistry & fonts = OCR::FontRegistry::global();
+	if (fonts.get(fontName)->empty())
+	{
+		cerr << argv[0] << ": no font named " << fontName << '\n';
+		return 1;
+	}
+	if (!fonts.get(fontName)->supports(engine))
+	{
+		cerr << argv[0] << ": font " << fontName
+		        << " has no data for this engine\n";
+		return 1;
+	}
+	std::shared_ptr<const Font> f = fonts.get(fontName, engine);
+	if (margin != f->margin())
+	{
+		// A margin of its own needs a font of its own
+		Font * tuned = new Font(*f);
+		tuned->setMargin(margin);
+		f.reset(tuned);
+	}
 
 	// Read the page
-	Page page(img, f);
+	Page page(img, *f);
 	result = page.Read();
-	cout << result << endl;
+	if (showConfidence)
+	{
+		// Show the confidence in each line before it
+		std::vector<double> confidence = page.lineConfidence();
+		std::istringstream text(result);
+		string line;
+		for (unsigned i = 0; std::getline(text, line); ++i)
+			cout << std::fixed << std::setprecision(2) << (i
+			        < confidence.size() ? confidence[i] : 1) << '\t' << line
+			        << '\n';
+		cout << endl;
+	}
+	else
+		cout << result << endl;
+
+	// Show the time and work spent, after the text
+	OCR::Profile::trace(false);
+	if (!trace.empty())
+	{
+		std::ofstream outfile(trace.c_str());
+		OCR::Profile::writeTrace(outfile);
+		if (outfile.fail())
+		{
+			cerr << argv[0] << ": cannot write " << trace << '\n';
+			return 1;
+		}
+	}
+	if (!stats.empty())
+	{
+		OCR::Profile::Totals totals = OCR::Profile::totals();
+		OCR::Profile::enable(false);
+		OCR::Profile::countHardware(false);
+		const Font::Stats matching = f->stats();
+		totals.counters.push_back(std::make_pair("symbols matched",
+		        matching.searches));
+		totals.counters.push_back(std::make_pair("prototypes scored",
+		        matching.evaluations));
+		totals.counters.push_back(std::make_pair("cache hits",
+		        f->cache().stats().hits));
+		if (stats == "json")
+			OCR::Profile::writeJSON(cerr, totals);
+		else
+			cerr << totals;
+	}
 
 	return 0;
 }
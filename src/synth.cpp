@@ -0,0 +1,380 @@
+/**
+ * @file synth.cpp
+ * @date October 2026
+ * @author Omophagic Content Reader contributors
+ * @brief An application program using the OCR library to compose synthetic
+ *        pages, with their text, from the characters of font images.
+ * @version $Id$
+ */
+/*
+ * Copyright 2026 Omophagic Content Reader contributors
+ *
+ * This file is part of Omophagic Content Reader.
+ *
+ * Omophagic Content Reader is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Omophagic Content Reader is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Omophagic Content Reader.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <cmath>
+#include <climits>
+#include <unistd.h>
+#include "EasyBMP/EasyBMP.h"
+#include "BinaryImage.h"
+#include "Line.h"
+
+/**
+ * Characters of the font images, in order, as ocr-learn expects
+ */
+const std::string ALPHABET =
+        "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789.,?!/@_";
+
+/// Longest word composed, in characters
+const unsigned MAX_WORD = 8;
+/// Width of a space between words, relative to the height of the line;
+/// well over what ocr takes as a space
+const double WORD_SPACE = 0.6;
+/// Rows left blank between lines, relative to the height of a line
+const double LINE_SPACE = 0.5;
+/// Blank pixels around the text
+const unsigned MARGIN = 20;
+
+/**
+ * The pixels of one character, cut from a font image
+ */
+struct Sprite
+{
+	/// The character
+	char character;
+	/// Size in pixels
+	unsigned width, height;
+	/// Rows between the top of the line and the top of the character
+	unsigned top;
+	/// Whether each pixel is foreground, row by row
+	std::vector<bool> pixels;
+};
+
+/**
+ * The characters of one font image, in one size
+ */
+struct Sheet
+{
+	/// Every character of the image
+	std::vector<Sprite> sprites;
+	/// Rows from the top of the highest character to the bottom of the lowest
+	unsigned height;
+};
+
+/**
+ * Generates the next number of a sequence that depends only on its seed,
+ * by SplitMix64
+ * @param state the seed, then the state of the sequence
+ * @return the next number
+ */
+static unsigned long long random(unsigned long long & state)
+{
+	unsigned long long z = (state += 0x9E3779B97F4A7C15ULL);
+	z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+	z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+	return z ^ (z >> 31);
+}
+
+/**
+ * Generates a number from 0 up to 1
+ * @param state state of the sequence
+ * @return a number at least 0 and less than 1
+ */
+static double randomUnit(unsigned long long & state)
+{
+	return (random(state) >> 11) * (1.0 / (1ULL << 53));
+}
+
+/**
+ * Cuts the characters out of a font image
+ * @param[in]  file  file name of an image of the ALPHABET, as ocr-learn reads
+ * @param[out] sheet the characters found
+ * @return whether any characters were found
+ */
+static bool cutSprites(const std::string & file, Sheet & sheet)
+{
+	BMP img;
+	if (!img.ReadFromFile(file.c_str()))
+		return false;
+	const OCR::Box area(0, 0, img.TellWidth() - 1, img.TellHeight() - 1);
+	OCR::BinaryImage binary(img, area);
+	std::vector<OCR::Box> parts = OCR::Line::split(binary, area);
+	if (parts.size() > ALPHABET.size())
+		parts.resize(ALPHABET.size());
+	if (parts.empty())
+		return false;
+
+	// Keep each character's place within the line
+	unsigned top = area.high.y, bottom = 0;
+	for (unsigned i = 0; i < parts.size(); ++i)
+	{
+		binary.pareDown(parts[i]);
+		top = std::min(top, parts[i].low.y);
+		bottom = std::max(bottom, parts[i].high.y);
+	}
+	sheet.height = bottom - top + 1;
+	sheet.sprites.resize(parts.size());
+	for (unsigned i = 0; i < parts.size(); ++i)
+	{
+		const OCR::Box & part = parts[i];
+		Sprite & sprite = sheet.sprites[i];
+		sprite.character = ALPHABET[i];
+		sprite.width = part.width();
+		sprite.height = part.height();
+		sprite.top = part.low.y - top;
+		sprite.pixels.clear();
+		for (unsigned y = part.low.y; y <= part.high.y; ++y)
+			for (unsigned x = part.low.x; x <= part.high.x; ++x)
+				sprite.pixels.push_back(binary(x, y));
+	}
+	return true;
+}
+
+/**
+ * Get the size of a length once scaled
+ * @param length length in pixels
+ * @param scale  factor to scale by
+ * @return scaled length, at least 1
+ */
+static unsigned scaled(unsigned length, double scale)
+{
+	return std::max(1.0, std::floor(length * scale + 0.5));
+}
+
+/**
+ * A page being composed, one bit per pixel
+ */
+struct Canvas
+{
+	/// Size in pixels
+	unsigned width, height;
+	/// Whether each pixel is foreground, row by row
+	std::vector<bool> pixels;
+
+	/**
+	 * Draws a character, scaled
+	 * @param sprite the character
+	 * @param left   column of its left side
+	 * @param top    row of the top of its line
+	 * @param scale  factor to scale it by
+	 */
+	void draw(const Sprite & sprite, unsigned left, unsigned top,
+	        double scale)
+	{
+		const unsigned w = scaled(sprite.width, scale);
+		const unsigned h = scaled(sprite.height, scale);
+		top += std::floor(sprite.top * scale + 0.5);
+		// Nearest neighbor
+		for (unsigned y = 0; y < h; ++y)
+			for (unsigned x = 0; x < w; ++x)
+				if (sprite.pixels[std::min(y * sprite.height / h,
+				        sprite.height - 1) * sprite.width + std::min(x
+				        * sprite.width / w, sprite.width - 1)])
+					pixels[(top + y) * width + left + x] = true;
+	}
+};
+
+int main(int argc, char * argv[])
+{
+	// Seed of every random choice
+	unsigned long long seed = 1;
+	// Size of the page in pixels, and number of lines of text
+	unsigned width = 1700, lines = 20;
+	// Pixels between characters, before scaling
+	unsigned gap = 3;
+	// Factor to scale the characters by
+	double scale = 1;
+	// Chance of each pixel being flipped
+	double noise = 0;
+	int option;
+	while ((option = getopt(argc, argv, "g:l:n:s:w:x:")) != -1)
+	{
+		std::istringstream value(optarg ? optarg : "");
+		bool valid;
+		switch (option)
+		{
+		case 'g':
+			valid = value >> gap && gap;
+			break;
+		case 'l':
+			valid = value >> lines && lines;
+			break;
+		case 'n':
+			valid = value >> noise && noise >= 0 && noise <= 1;
+			break;
+		case 's':
+			valid = !!(value >> seed);
+			break;
+		case 'w':
+			valid = value >> width && width > 2 * MARGIN;
+			break;
+		case 'x':
+			valid = value >> scale && scale > 0;
+			break;
+		default:
+			valid = false;
+		}
+		if (!valid)
+			argc = 0;
+	}
+	if (argc - optind < 2)
+	{
+		std::cerr << "Usage: " << argv[0] << " [-s <seed>] [-w <width>]"
+		        << " [-l <lines>] [-x <scale>] [-g <gap>] [-n <noise>]"
+		        << " <page image> <font image>...\n"
+		        << "The text of the page is written beside it, to a file of the"
+		        << " same name ending in .txt.\n";
+		return 1;
+	}
+
+	// Cut the characters out of every font image
+	std::vector<Sheet> sheets;
+	for (int i = optind + 1; i < argc; ++i)
+	{
+		Sheet sheet;
+		if (cutSprites(argv[i], sheet))
+			sheets.push_back(sheet);
+		else
+			std::cerr << argv[0] << ": no characters in " << argv[i] << '\n';
+	}
+	if (sheets.empty())
+		return 1;
+
+	// Every character must fit on a line between the margins
+	unsigned widest = 0;
+	for (unsigned s = 0; s < sheets.size(); ++s)
+		for (unsigned c = 0; c < sheets[s].sprites.size(); ++c)
+			widest = std::max(widest, scaled(sheets[s].sprites[c].width,
+			        scale));
+	if (width < 2 * MARGIN + widest)
+	{
+		std::cerr << argv[0] << ": pages must be at least "
+		        << 2 * MARGIN + widest << " pixels wide for these characters\n";
+		return 1;
+	}
+
+	// Choose the size and text of each line; every line is in the size
+	// of one image, so that its characters share a baseline
+	unsigned long long state = seed;
+	const unsigned space = std::max(1.0, gap * scale);
+	std::vector<unsigned> sheetOf(lines);
+	std::vector<std::vector<unsigned> > words(lines);
+	std::string text;
+	unsigned height = MARGIN;
+	for (unsigned l = 0; l < lines; ++l)
+	{
+		const Sheet & sheet = sheets[sheetOf[l] = random(state) % sheets.size()];
+		const unsigned lineHeight = scaled(sheet.height, scale);
+		const unsigned wordSpace = std::max(space + 1.0, lineHeight
+		        * WORD_SPACE);
+		unsigned x = MARGIN;
+		while (true)
+		{
+			// A word of characters of the image, if it fits on the line
+			std::vector<unsigned> word(1 + random(state) % MAX_WORD);
+			unsigned wordWidth = 0;
+			for (unsigned c = 0; c < word.size(); ++c)
+			{
+				word[c] = random(state) % sheet.sprites.size();
+				wordWidth += (c ? space : 0) + scaled(
+				        sheet.sprites[word[c]].width, scale);
+			}
+			if (x + (words[l].empty() ? 0 : wordSpace) + wordWidth + MARGIN
+			        > width)
+				break;
+			if (!words[l].empty())
+			{
+				x += wordSpace;
+				text += ' ';
+				words[l].push_back(sheet.sprites.size());
+			}
+			x += wordWidth;
+			for (unsigned c = 0; c < word.size(); ++c)
+			{
+				text += sheet.sprites[word[c]].character;
+				words[l].push_back(word[c]);
+			}
+		}
+		text += '\n';
+		height += lineHeight + scaled(sheet.height * LINE_SPACE, scale);
+	}
+	height += MARGIN;
+	BMP img;
+	if ((unsigned long long) width * height > UINT_MAX || !img.SetSize(
+	        width, height))
+	{
+		std::cerr << argv[0] << ": cannot make a page of " << width << " by "
+		        << height << " pixels\n";
+		return 1;
+	}
+
+	// Draw the lines
+	Canvas page;
+	page.width = width;
+	page.height = height;
+	page.pixels.assign(width * height, false);
+	unsigned top = MARGIN;
+	for (unsigned l = 0; l < lines; ++l)
+	{
+		const Sheet & sheet = sheets[sheetOf[l]];
+		const unsigned lineHeight = scaled(sheet.height, scale);
+		const unsigned wordSpace = std::max(space + 1.0, lineHeight
+		        * WORD_SPACE);
+		unsigned x = MARGIN;
+		for (unsigned i = 0; i < words[l].size(); ++i)
+		{
+			// Each word is followed by a marker for the space after it
+			if (words[l][i] == sheet.sprites.size())
+			{
+				x += wordSpace - space;
+				continue;
+			}
+			const Sprite & sprite = sheet.sprites[words[l][i]];
+			page.draw(sprite, x, top, scale);
+			x += scaled(sprite.width, scale) + space;
+		}
+		top += lineHeight + scaled(sheet.height * LINE_SPACE, scale);
+	}
+
+	// Flip pixels at random, then write the page and its text
+	for (unsigned i = 0; noise > 0 && i < page.pixels.size(); ++i)
+		if (randomUnit(state) < noise)
+			page.pixels[i] = !page.pixels[i];
+	RGBApixel ink, paper;
+	ink.Red = ink.Green = ink.Blue = 0;
+	paper.Red = paper.Green = paper.Blue = 255;
+	ink.Alpha = paper.Alpha = 0;
+	for (unsigned y = 0; y < height; ++y)
+		for (unsigned x = 0; x < width; ++x)
+			img.SetPixel(x, y, page.pixels[y * width + x] ? ink : paper);
+	const std::string image = argv[optind];
+	std::ofstream textFile((image.substr(0, image.rfind('.')) + ".txt").c_str());
+	textFile << text;
+	textFile.close();
+	if (!img.WriteToFile(image.c_str()) || textFile.fail())
+	{
+		std::cerr << argv[0] << ": cannot write " << image << '\n';
+		return 1;
+	}
+	return 0;
+}